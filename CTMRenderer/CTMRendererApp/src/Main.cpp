@@ -2,12 +2,40 @@
 
 #include <iostream>
 
-int main()
+#ifdef CTM_NO_DX
+#include <charconv>
+#include <cstring>
+
+// Without a window to close, a headless run ends after a frame budget. 10 seconds at 60 FPS unless given on the command line.
+constexpr uint64_t S_DEFAULT_MAX_FRAMES = 600;
+#endif
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
 {
+#ifdef CTM_NO_DX
+	// Without DirectX there's no window, so frames are rasterized on the CPU.
+	CTMRenderer::CTMSoftware::SWRendererSettings settings(60u);
+	settings.MaxFrames = S_DEFAULT_MAX_FRAMES;
+
+	if (argc > 1)
+	{
+		const char* pEnd = argv[1] + std::strlen(argv[1]);
+		const std::from_chars_result result = std::from_chars(argv[1], pEnd, settings.MaxFrames);
+
+		if (result.ec != std::errc() || result.ptr != pEnd || settings.MaxFrames == 0)
+		{
+			std::cerr << "Usage : " << argv[0] << " [frames]  (frames > 0, " << S_DEFAULT_MAX_FRAMES << " by default)\n";
+			return 1;
+		}
+	}
+
+	CTMRenderer::CTMSoftware::SWRenderer renderer(settings);
+#else
 	CTMRenderer::CTMRenderer renderer(CTMRenderer::RendererType::CTM_DIRECTX, 60u);
+#endif
 
 	renderer.Start();
 	renderer.JoinForShutdown();
 
 	std::cout << "Main end.\n";
-}
\ No newline at end of file
+}
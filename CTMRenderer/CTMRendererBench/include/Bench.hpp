@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+
+namespace CTMRendererBench
+{
+	// Returns the average milliseconds per call of func over iterations calls, after one warm-up call.
+	template <typename Func>
+	inline double TimeMillis(unsigned int iterations, Func&& func)
+	{
+		func();
+
+		const auto start = std::chrono::steady_clock::now();
+		for (unsigned int i = 0; i < iterations; ++i)
+			func();
+		const auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+	}
+
+	/* Records the outcome of a correctness check, returning it so it can be printed in place. Once any check failed,
+	 * the run exits with a nonzero code, so CI catches a regression the output only reports. */
+	bool Check(bool passed) noexcept;
+
+	void BenchTaskGraph();
+	void BenchNullRenderer();
+	void BenchRendererHost();
+	void BenchSoftwareRenderer();
+	void BenchTiledRaster();
+	void BenchSpanKernels();
+	void BenchCompositor();
+	void BenchFrameCapture();
+	void BenchFrameRing();
+	void BenchDeltaEncoder();
+	void BenchFrameGraph();
+	void BenchShapeRaster();
+	void BenchInstanceBuilder();
+	void BenchShapeRegistry();
+	void BenchSpatialGrid();
+	void BenchDamage();
+	void BenchSceneGraph();
+	void BenchChunkedCanvas();
+	void BenchRectLod();
+	void BenchRectMerger();
+	void BenchClipStack();
+	void BenchDynamicResolution();
+	void BenchThreadConfig();
+}
@@ -0,0 +1,184 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/ChunkedCanvas.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchChunkedCanvas()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr float S_WIDTH = 1920.0f, S_HEIGHT = 1080.0f;
+		constexpr size_t S_RECT_COUNT = 10000000;
+		constexpr double S_WORLD_ORIGIN = 1e7; // Far from 0, where floats are 1 unit apart.
+		constexpr double S_WORLD_SIZE = 200000.0;
+		constexpr unsigned int S_FRAMES = 240;
+		constexpr unsigned int S_CHECKED_FRAMES = 8; // Also culled by testing every rect, to check no visible rect is missed.
+
+		const Geometry::DXAABB baseQuad(0, 0, 1, 1);
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<double> position(S_WORLD_ORIGIN, S_WORLD_ORIGIN + S_WORLD_SIZE);
+		std::uniform_real_distribution<double> size(1.0, 20.0);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		ChunkedCanvas canvas;
+		canvas.Reserve(S_RECT_COUNT);
+
+		for (size_t i = 0; i < S_RECT_COUNT; ++i)
+		{
+			const double left = position(random), top = position(random);
+			canvas.Add(left, top, left + size(random), top + size(random), DXColor((unsigned char)channel(random), (unsigned char)channel(random), 128, 255));
+		}
+
+		Timer::Timer timer;
+		canvas.Build();
+		const double buildMillis = timer.ElapsedMillis();
+
+		// Pans across the world, zooms out until most of it is visible, then back in.
+		Camera2D camera(S_WIDTH, S_HEIGHT);
+		std::vector<Camera2D> path;
+
+		camera.SetCenter(S_WORLD_ORIGIN + 1000.0, S_WORLD_ORIGIN + 1000.0);
+		for (unsigned int frame = 0; frame < S_FRAMES; ++frame)
+		{
+			if (frame < S_FRAMES / 3)
+				camera.Pan(-24.0f, -12.0f);
+			else if (frame < S_FRAMES * 2 / 3)
+				camera.ZoomAt(0.95, S_WIDTH * 0.5f, S_HEIGHT * 0.5f);
+			else
+				camera.ZoomAt(1.0 / 0.95, 200.0f, 300.0f);
+
+			path.push_back(camera);
+		}
+
+		std::vector<InstanceData> instances;
+		std::vector<uint32_t> visibleChunks;
+		size_t submittedRects = 0, visibleChunkCount = 0, maxSubmittedRects = 0;
+		bool isComplete = true;
+
+		timer.Reset();
+		for (const Camera2D& view : path)
+		{
+			canvas.Submit(view, baseQuad, instances);
+			submittedRects += canvas.Stats().submittedRects;
+			visibleChunkCount += canvas.Stats().visibleChunks;
+			maxSubmittedRects = std::max(maxSubmittedRects, canvas.Stats().submittedRects);
+		}
+		const double submitMillis = timer.ElapsedMillis() / S_FRAMES;
+
+		// Every rect intersecting the view must be in a visible chunk.
+		for (unsigned int frame = 0; frame < S_FRAMES; frame += S_FRAMES / S_CHECKED_FRAMES)
+		{
+			const WorldRect view = path[frame].View();
+			auto intersects = [&](size_t i) {
+				return canvas.Lefts()[i] < view.right && canvas.Rights()[i] > view.left && canvas.Tops()[i] < view.bottom && canvas.Bottoms()[i] > view.top;
+			};
+
+			size_t expected = 0, found = 0;
+			for (size_t i = 0; i < canvas.Size(); ++i)
+				expected += intersects(i) ? 1 : 0;
+
+			canvas.Cull(path[frame], visibleChunks);
+			for (uint32_t chunkIndex : visibleChunks)
+			{
+				const CanvasChunk& chunk = canvas.Chunks()[chunkIndex];
+				for (size_t i = chunk.first; i < (size_t)chunk.first + chunk.count; ++i)
+					found += intersects(i) ? 1 : 0;
+			}
+
+			isComplete = isComplete && found == expected;
+		}
+
+		// Submitting everything, like drawing without culling.
+		Camera2D everything(S_WIDTH, S_HEIGHT);
+		everything.SetCenter(S_WORLD_ORIGIN + S_WORLD_SIZE * 0.5, S_WORLD_ORIGIN + S_WORLD_SIZE * 0.5);
+		everything.SetZoom(S_WIDTH / (S_WORLD_SIZE + 40.0));
+
+		timer.Reset();
+		canvas.Submit(everything, baseQuad, instances);
+		const double everythingMillis = timer.ElapsedMillis();
+
+		// The visible rects must come in the order they were added, whichever chunks they landed in. Ranking the visible
+		// rects' sequences gives each one's expected position.
+		std::vector<uint32_t> rectBySequence(canvas.Size(), UINT32_MAX);
+		canvas.Cull(everything, visibleChunks);
+		for (uint32_t chunkIndex : visibleChunks)
+		{
+			const CanvasChunk& chunk = canvas.Chunks()[chunkIndex];
+			for (uint32_t i = chunk.first; i < chunk.first + chunk.count; ++i)
+				rectBySequence[canvas.Sequences()[i]] = i;
+		}
+
+		size_t submitted = 0;
+		bool isInAddOrder = true;
+		for (size_t sequence = 0; sequence < rectBySequence.size() && isInAddOrder; ++sequence)
+		{
+			const uint32_t i = rectBySequence[sequence];
+			if (i == UINT32_MAX)
+				continue;
+
+			const InstanceData& instance = instances[submitted++];
+			isInAddOrder = std::memcmp(&instance.color, &canvas.Colors()[i], sizeof(DXColor)) == 0
+				&& instance.offsetXY.x == (float)((canvas.Lefts()[i] - everything.OriginX()) * everything.Zoom());
+		}
+		isInAddOrder = isInAddOrder && submitted == instances.size();
+
+		// Zoomed in, compares the submitted positions to exact ones, and to positions computed from float world coordinates.
+		Camera2D closeUp(S_WIDTH, S_HEIGHT);
+		closeUp.SetCenter(canvas.Lefts()[S_RECT_COUNT / 2] + 3.21, canvas.Tops()[S_RECT_COUNT / 2] + 1.23);
+		closeUp.SetZoom(8.0);
+		canvas.Submit(closeUp, baseQuad, instances);
+
+		const double originX = closeUp.OriginX(), originY = closeUp.OriginY();
+		double rebasedError = 0.0, floatError = 0.0;
+		size_t checkedRects = 0;
+
+		// Instances come in add order, so the visible rects are walked in that order too.
+		std::vector<size_t> visibleRects;
+		canvas.Cull(closeUp, visibleChunks);
+		for (uint32_t chunkIndex : visibleChunks)
+		{
+			const CanvasChunk& chunk = canvas.Chunks()[chunkIndex];
+			for (size_t i = chunk.first; i < (size_t)chunk.first + chunk.count; ++i)
+				visibleRects.push_back(i);
+		}
+
+		std::sort(visibleRects.begin(), visibleRects.end(), [&](size_t a, size_t b) { return canvas.Sequences()[a] < canvas.Sequences()[b]; });
+
+		for (size_t written = 0; written < visibleRects.size(); ++written)
+		{
+			const size_t i = visibleRects[written];
+			const double exactX = (canvas.Lefts()[i] - originX) * closeUp.Zoom(), exactY = (canvas.Tops()[i] - originY) * closeUp.Zoom();
+			if (exactX < -S_WIDTH || exactX > S_WIDTH || exactY < -S_HEIGHT || exactY > S_HEIGHT)
+				continue;
+
+			++checkedRects;
+
+			rebasedError = std::max(rebasedError, std::max(std::abs(instances[written].offsetXY.x - exactX), std::abs(instances[written].offsetXY.y - exactY)));
+
+			const float floatX = ((float)canvas.Lefts()[i] - (float)originX) * (float)closeUp.Zoom();
+			const float floatY = ((float)canvas.Tops()[i] - (float)originY) * (float)closeUp.Zoom();
+			floatError = std::max(floatError, std::max(std::abs(floatX - exactX), std::abs(floatY - exactY)));
+		}
+
+		std::cout << S_RECT_COUNT << " rects over " << S_WORLD_SIZE << " units square, " << canvas.Chunks().size() << " chunks of "
+			<< canvas.ChunkCapacity() << ", viewport " << S_WIDTH << 'x' << S_HEIGHT << '\n';
+		std::cout << "Build : " << buildMillis << "ms\n";
+		std::cout << "Submitting everything : " << everythingMillis << "ms\n";
+		std::cout << "Submitting the view : " << submitMillis << "ms per frame (" << (everythingMillis / submitMillis) << "x), "
+			<< (visibleChunkCount / S_FRAMES) << " chunks and " << (submittedRects / S_FRAMES) << " rects on average, " << maxSubmittedRects << " at most\n";
+		std::cout << "Visible chunks hold every visible rect : " << (Check(isComplete) ? "yes" : "no") << '\n';
+		std::cout << "Submitted in add order, across chunks : " << (Check(isInAddOrder) ? "yes" : "no") << '\n';
+		std::cout << "Largest position error of " << checkedRects << " rects at zoom " << closeUp.Zoom() << " : " << rebasedError << "px rebased, " << floatError << "px from float world coordinates\n";
+	}
+}
@@ -0,0 +1,167 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/ClipStack.hpp"
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+#include "CTMRenderer/Software/SWShapeRasterizer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchClipStack()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr size_t S_ROW_COUNT = 10000;
+		constexpr float S_ROW_HEIGHT = 24.0f;
+		constexpr unsigned int S_ITERATIONS = 50;
+
+		const Geometry::DXAABB baseQuad(0, 0, 1, 1);
+		const ClipRect screen = { 0.0f, 0.0f, (float)S_WIDTH, (float)S_HEIGHT };
+		const ClipRect panel = { 200.0f, 100.0f, 1000.0f, 900.0f };
+		const ClipRect list = { 220.25f, 140.0f, 980.0f, 1000.0f }; // Runs past the panel, which clips it further.
+
+		// A list scrolled far down, each row a background, a text bar running past the list's right edge, and a badge.
+		const float firstTop = list.top - 123456.7f;
+
+		std::vector<float> lefts, tops, rights, bottoms;
+		std::vector<DXColor> colors;
+		std::vector<ShapeInstanceData> badges;
+
+		for (size_t row = 0; row < S_ROW_COUNT; ++row)
+		{
+			const float top = firstTop + row * S_ROW_HEIGHT;
+
+			lefts.push_back(list.left);
+			tops.push_back(top);
+			rights.push_back(list.right);
+			bottoms.push_back(top + S_ROW_HEIGHT);
+			colors.push_back((row % 2) == 0 ? DXColor(250, 250, 250, 255) : DXColor(236, 240, 244, 255));
+
+			lefts.push_back(list.left + 20.0f);
+			tops.push_back(top + 6.0f);
+			rights.push_back(list.left + 20.0f + (float)(400 + (row * 37) % 400));
+			bottoms.push_back(top + 18.0f);
+			colors.push_back(DXColor(40, 40, 40, 255));
+
+			ShapeInstanceData badge;
+			badge.centerXY = { list.right - 16.0f, top + S_ROW_HEIGHT * 0.5f };
+			badge.halfSizeXY = { 8.0f, 8.0f };
+			badge.cornerRadius = 8.0f;
+			badge.fillColor = DXColor(DXColorType::RED);
+			badges.push_back(badge);
+		}
+
+		auto rowRects = [&](size_t first, size_t end) {
+			RectBatch batch;
+			batch.pLeft = lefts.data() + first * 2;
+			batch.pTop = tops.data() + first * 2;
+			batch.pRight = rights.data() + first * 2;
+			batch.pBottom = bottoms.data() + first * 2;
+			batch.pColors = colors.data() + first * 2;
+			batch.count = (end - first) * 2;
+			return batch;
+		};
+
+		ClipStack clips(screen);
+		std::vector<InstanceData> instances;
+		std::vector<ShapeInstanceData> shapes;
+		bool isScissored = false;
+
+		auto unclipped = [&]() {
+			instances.resize(lefts.size());
+			BuildInstances(rowRects(0, S_ROW_COUNT), baseQuad, instances.data());
+			shapes = badges;
+		};
+
+		auto clipEveryRow = [&]() {
+			instances.clear();
+			shapes.clear();
+
+			clips.Clear(screen);
+			clips.Push(panel);
+			clips.Push(list);
+			clips.Build(rowRects(0, S_ROW_COUNT), baseQuad, instances);
+			isScissored = clips.Build(badges.data(), badges.size(), shapes);
+			clips.Pop();
+			clips.Pop();
+		};
+
+		auto clipVisibleRows = [&]() {
+			instances.clear();
+			shapes.clear();
+
+			clips.Clear(screen);
+			clips.Push(panel);
+			clips.Push(list);
+			const ClipRowRange rows = clips.VisibleRows(firstTop, S_ROW_HEIGHT, S_ROW_COUNT);
+			clips.Build(rowRects(rows.first, rows.end), baseQuad, instances);
+			isScissored = clips.Build(badges.data() + rows.first, rows.end - rows.first, shapes);
+			clips.Pop();
+			clips.Pop();
+		};
+
+		const CTMDirectX::Window::Geometry::WindowArea screenArea(S_WIDTH, S_HEIGHT);
+		SWRasterizer rasterizer(screenArea);
+		rasterizer.SetBaseQuad(baseQuad);
+		SWFramebuffer target(S_WIDTH, S_HEIGHT);
+
+		// The pixels the nested clip rects keep, as the scissor rect of shape batches.
+		ClipStack nested(screen);
+		nested.Push(panel);
+		nested.Push(list);
+		const SWPixelRect scissor = CoveredPixels(nested.Current().left, nested.Current().top, nested.Current().right, nested.Current().bottom, S_WIDTH, S_HEIGHT);
+
+		auto draw = [&](bool useScissor) {
+			target.Clear(0);
+			rasterizer.DrawInstances(target, instances.data(), instances.size());
+
+			if (useScissor)
+				DrawShapes(target, shapes.data(), shapes.size(), scissor);
+			else
+				DrawShapes(target, shapes.data(), shapes.size());
+		};
+
+		std::cout << S_ROW_COUNT << " rows of 2 rects and a badge, in a list within a panel, " << S_WIDTH << 'x' << S_HEIGHT << '\n';
+
+		const double unclippedMillis = TimeMillis(S_ITERATIONS, unclipped);
+		const double unclippedDrawMillis = TimeMillis(S_ITERATIONS, [&] { draw(false); });
+
+		// Drawn unclipped and masked by the clip rects afterwards, as the reference.
+		SWFramebuffer reference(S_WIDTH, S_HEIGHT);
+		reference.Clear(0);
+		for (int y = scissor.top; y < scissor.bottom; ++y)
+			std::memcpy(reference.Row((unsigned int)y) + scissor.left, target.Row((unsigned int)y) + scissor.left, (size_t)(scissor.right - scissor.left) * sizeof(uint32_t));
+
+		auto matchesReference = [&]() {
+			for (unsigned int y = 0; y < S_HEIGHT; ++y)
+				if (std::memcmp(reference.Row(y), target.Row(y), S_WIDTH * sizeof(uint32_t)) != 0)
+					return false;
+
+			return true;
+		};
+
+		std::cout << "Unclipped : build " << unclippedMillis << "ms, draw " << unclippedDrawMillis << "ms, " << instances.size() << " rects and "
+			<< shapes.size() << " shapes\n";
+
+		auto run = [&](const char* name, auto&& build) {
+			const double buildMillis = TimeMillis(S_ITERATIONS, build);
+			const double drawMillis = TimeMillis(S_ITERATIONS, [&] { draw(isScissored); });
+			const ClipStats& stats = clips.Stats();
+
+			std::cout << name << " : build " << buildMillis << "ms, draw " << drawMillis << "ms, " << instances.size() << " rects and " << shapes.size() << " shapes\n";
+			std::cout << "  Rects : " << stats.keptRects << " kept, " << stats.trimmedRects << " trimmed, " << stats.discardedRects << " discarded | Shapes : "
+				<< stats.keptShapes << " kept, " << stats.scissoredShapes << " scissored, " << stats.discardedShapes << " discarded\n";
+			std::cout << "  Matches the masked reference : " << (Check(matchesReference()) ? "yes" : "no") << '\n';
+		};
+
+		run("Clipping every row", clipEveryRow);
+		run("Clipping the visible rows", clipVisibleRows);
+	}
+}
@@ -0,0 +1,117 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWCompositor.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		// Every premultiplied source alpha and channel value against every destination value, plus random malformed pixels.
+		bool MatchesReference(const CTMRenderer::CTMSoftware::SWSpanKernels& kernels)
+		{
+			using namespace CTMRenderer::CTMSoftware;
+
+			std::vector<uint32_t> src, dst;
+
+			for (uint32_t a = 0; a < 256; ++a)
+			{
+				for (uint32_t c = 0; c <= a; ++c)
+				{
+					for (uint32_t d = 0; d < 256; d += 3)
+					{
+						src.emplace_back((a << 24) | (c << 16) | ((c / 2) << 8) | (a - c));
+						dst.emplace_back((d << 24) | ((255 - d) << 16) | (d << 8) | (d ^ 0x5A));
+					}
+				}
+			}
+
+			std::mt19937 random(1738u);
+			for (size_t i = 0; i < 100000; ++i)
+			{
+				src.emplace_back((uint32_t)random());
+				dst.emplace_back((uint32_t)random());
+			}
+
+			std::vector<uint32_t> expected(dst.size()), actual(dst.size());
+
+			for (unsigned char opacity : { (unsigned char)255, (unsigned char)254, (unsigned char)128, (unsigned char)77, (unsigned char)1, (unsigned char)0 })
+			{
+				for (size_t i = 0; i < dst.size(); ++i)
+					expected[i] = BlendOverReference(dst[i], src[i], opacity);
+
+				// Odd span lengths, so every tail path runs.
+				actual = dst;
+				for (size_t first = 0; first < actual.size(); first += 1021)
+					kernels.BlendSpan(actual.data() + first, src.data() + first, std::min<size_t>(1021, actual.size() - first), opacity);
+
+				if (expected != actual)
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	void BenchCompositor()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+
+		// A translucent overlay, premultiplied.
+		std::mt19937 random(42u);
+		SWFramebuffer overlay(S_WIDTH, S_HEIGHT);
+		for (unsigned int y = 0; y < S_HEIGHT; ++y)
+			for (unsigned int x = 0; x < S_WIDTH; ++x)
+				overlay.Row(y)[x] = PremultiplyBGRA8(((uint32_t)(64 + random() % 128) << 24) | ((uint32_t)random() & 0xFFFFFF));
+
+		SWFramebuffer target(S_WIDTH, S_HEIGHT);
+		const SWSpanKernels& activeKernels = ActiveSpanKernels();
+
+		for (SWKernelISA isa : { SWKernelISA::SCALAR, SWKernelISA::SSE2, SWKernelISA::AVX2, SWKernelISA::AVX512 })
+		{
+			const SWSpanKernels* pKernels = SpanKernels(isa);
+
+			if (pKernels == nullptr)
+				continue;
+
+			const bool isExact = MatchesReference(*pKernels);
+
+			SelectSpanKernels(isa);
+			target.Clear(PackBGRA8(0, 0, 26, 255));
+
+			const double overMillis = TimeMillis(50, [&] { CompositeOver(target, overlay, 0, 0); });
+			const double opacityMillis = TimeMillis(50, [&] { CompositeOver(target, overlay, 0, 0, 160); });
+
+			const double megapixels = (double)S_WIDTH * S_HEIGHT / 1e6;
+			std::cout << pKernels->name << (Check(isExact) ? " (exact)" : " MISMATCH") << " : source-over 1080p " << overMillis << "ms ("
+				<< megapixels / overMillis * 1000.0 << " Mpx/s), with opacity " << opacityMillis << "ms ("
+				<< megapixels / opacityMillis * 1000.0 << " Mpx/s)\n";
+		}
+
+		SelectSpanKernels(activeKernels.isa);
+
+		// Three overlapping layers through the banded parallel path.
+		Threading::WorkerPool pool;
+		std::vector<SWLayer> layers(3);
+
+		for (size_t i = 0; i < layers.size(); ++i)
+		{
+			layers[i].pixels.Resize(S_WIDTH / 2, S_HEIGHT / 2);
+			BlitNearest(overlay, layers[i].pixels);
+			layers[i].x = (int)(i * S_WIDTH / 4);
+			layers[i].y = (int)(i * S_HEIGHT / 4);
+			layers[i].opacity = (unsigned char)(255 - i * 60);
+		}
+
+		const double layerMillis = TimeMillis(50, [&] { CompositeLayers(pool, target, layers); });
+		std::cout << "3 layers of " << S_WIDTH / 2 << 'x' << S_HEIGHT / 2 << " with " << activeKernels.name << " on " << pool.ThreadCount()
+			<< " worker(s) + caller : " << layerMillis << "ms\n";
+	}
+}
@@ -0,0 +1,198 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWDamageRenderer.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchDamage()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr size_t S_SHAPE_COUNT = 20000;
+		constexpr unsigned int S_FRAMES = 200;
+		constexpr size_t S_MOVES_PER_FRAME = 16;   // Animated widgets.
+		constexpr size_t S_RECOLORS_PER_FRAME = 8; // Hover highlights.
+		constexpr unsigned int S_CHURN_INTERVAL = 8; // Frames between a few shapes being replaced.
+		constexpr unsigned int S_BURST_FRAME = 100;  // Moves most shapes at once, like a page scrolling.
+		constexpr size_t S_BUFFER_COUNT = 2;        // Targets drawn in turn, like a swap chain.
+
+		const uint32_t clearBgra = PackBGRA8(0, 0, 26, 255);
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> positionX(-60.0f, (float)S_WIDTH), positionY(-60.0f, (float)S_HEIGHT);
+		std::uniform_real_distribution<float> size(8.0f, 120.0f);
+		std::uniform_real_distribution<float> nudge(-3.0f, 3.0f);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		auto randomColor = [&] { return DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), 255); };
+
+		ShapeRegistry registry;
+		SpatialGrid grid((float)S_WIDTH, (float)S_HEIGHT, 64.0f);
+		DamageTracker tracker;
+
+		auto addShape = [&] {
+			const float left = positionX(random), top = positionY(random);
+			const float right = left + size(random), bottom = top + size(random);
+
+			const ShapeHandle handle = registry.Add(left, top, right, bottom, randomColor());
+			grid.Insert(handle, left, top, right, bottom);
+			tracker.Add(left, top, right, bottom);
+		};
+
+		auto randomShape = [&] { return registry.Handle(std::uniform_int_distribution<size_t>(0, registry.Size() - 1)(random)); };
+
+		auto moveShape = [&](ShapeHandle handle) {
+			const size_t i = registry.DenseIndex(handle);
+			const RectBatch batch = registry.Batch();
+			const float dx = nudge(random), dy = nudge(random);
+			const float left = batch.pLeft[i], top = batch.pTop[i], right = batch.pRight[i], bottom = batch.pBottom[i];
+
+			registry.SetBounds(handle, left + dx, top + dy, right + dx, bottom + dy);
+			grid.Update(handle, left + dx, top + dy, right + dx, bottom + dy);
+			tracker.AddChange(left, top, right, bottom, left + dx, top + dy, right + dx, bottom + dy);
+		};
+
+		for (size_t i = 0; i < S_SHAPE_COUNT; ++i)
+			addShape();
+
+		std::vector<SWFramebuffer> targets;
+		for (size_t i = 0; i < S_BUFFER_COUNT; ++i)
+			targets.emplace_back(S_WIDTH, S_HEIGHT);
+
+		std::vector<uint64_t> drawnFrame(S_BUFFER_COUNT, 0); // Frame each target last held, 0 for never.
+
+		SWDamageRenderer renderer;
+		SWFramebuffer reference(S_WIDTH, S_HEIGHT);
+		SWDamageRenderer referenceRenderer;
+
+		double damageMillis = 0.0, fullMillis = 0.0;
+		uint64_t damagePixels = 0;
+		size_t fullFrames = 0, drawnShapes = 0;
+		bool isIdentical = true;
+
+		for (unsigned int frame = 1; frame <= S_FRAMES; ++frame)
+		{
+			for (size_t i = 0; i < S_MOVES_PER_FRAME; ++i)
+				moveShape(randomShape());
+
+			for (size_t i = 0; i < S_RECOLORS_PER_FRAME; ++i)
+			{
+				const ShapeHandle handle = randomShape();
+				const RectBatch batch = registry.Batch();
+				const size_t dense = registry.DenseIndex(handle);
+
+				registry.SetColor(handle, randomColor());
+				tracker.Add(batch.pLeft[dense], batch.pTop[dense], batch.pRight[dense], batch.pBottom[dense]);
+			}
+
+			if (frame % S_CHURN_INTERVAL == 0)
+			{
+				for (size_t i = 0; i < 2; ++i)
+				{
+					const ShapeHandle handle = randomShape();
+					const RectBatch batch = registry.Batch();
+					const size_t dense = registry.DenseIndex(handle);
+
+					tracker.Add(batch.pLeft[dense], batch.pTop[dense], batch.pRight[dense], batch.pBottom[dense]);
+					grid.Remove(handle);
+					registry.Remove(handle);
+					addShape();
+				}
+			}
+
+			if (frame == S_BURST_FRAME)
+				for (size_t i = 0; i < S_SHAPE_COUNT / 2; ++i)
+					moveShape(randomShape());
+
+			const size_t buffer = frame % S_BUFFER_COUNT;
+			const unsigned int bufferAge = drawnFrame[buffer] == 0 ? 0 : (unsigned int)(frame - drawnFrame[buffer]);
+
+			Timer::Timer timer;
+			renderer.Draw(targets[buffer], clearBgra, registry, grid, tracker.Resolve(S_WIDTH, S_HEIGHT, bufferAge));
+			damageMillis += timer.ElapsedMillis();
+
+			drawnFrame[buffer] = frame;
+			damagePixels += renderer.Stats().pixels;
+			drawnShapes += renderer.Stats().drawnShapes;
+			fullFrames += renderer.Stats().isFull ? 1 : 0;
+
+			timer.Reset();
+			referenceRenderer.DrawAll(reference, clearBgra, registry);
+			fullMillis += timer.ElapsedMillis();
+
+			for (unsigned int y = 0; y < S_HEIGHT && isIdentical; ++y)
+				isIdentical = std::memcmp(targets[buffer].Row(y), reference.Row(y), S_WIDTH * sizeof(uint32_t)) == 0;
+		}
+
+		// A shape added into the lowest freed slot must still land above the older shapes it covers.
+		bool isNewestOnTop = true;
+		{
+			size_t lowestDense = 0;
+			for (size_t i = 1; i < registry.Size(); ++i)
+				if (registry.Handle(i).slot < registry.Handle(lowestDense).slot)
+					lowestDense = i;
+
+			const ShapeHandle freed = registry.Handle(lowestDense);
+			const RectBatch batch = registry.Batch();
+
+			tracker.Add(batch.pLeft[lowestDense], batch.pTop[lowestDense], batch.pRight[lowestDense], batch.pBottom[lowestDense]);
+			grid.Remove(freed);
+			registry.Remove(freed);
+
+			// Any shape covering the middle of the target now has a higher slot than the one the new shape gets.
+			const float left = S_WIDTH * 0.5f - 16.0f, top = S_HEIGHT * 0.5f - 16.0f, right = left + 32.0f, bottom = top + 32.0f;
+			const DXColor color(1, 2, 3, 255);
+
+			const ShapeHandle newest = registry.Add(left, top, right, bottom, color);
+			grid.Insert(newest, left, top, right, bottom);
+			tracker.Add(left, top, right, bottom);
+
+			const unsigned int frame = S_FRAMES + 1;
+			const size_t buffer = frame % S_BUFFER_COUNT;
+			renderer.Draw(targets[buffer], clearBgra, registry, grid, tracker.Resolve(S_WIDTH, S_HEIGHT, frame - (unsigned int)drawnFrame[buffer]));
+			referenceRenderer.DrawAll(reference, clearBgra, registry);
+
+			isNewestOnTop = newest.slot == freed.slot && targets[buffer].Row(S_HEIGHT / 2)[S_WIDTH / 2] == PackBGRA8(color)
+				&& reference.Row(S_HEIGHT / 2)[S_WIDTH / 2] == PackBGRA8(color);
+		}
+
+		// Strips spanning the whole clamped coordinate range, far below the target, past MaxRects so they get merged.
+		bool isFarDamageClipped = false;
+		{
+			DamageTracker farTracker;
+			farTracker.Resolve(S_WIDTH, S_HEIGHT, 0); // Its first frame is a full redraw.
+
+			for (unsigned int i = 0; i < 80; ++i)
+				farTracker.Add(-1e12f, 1e6f + i * 10.0f, 1e12f, 1e6f + i * 10.0f + 5.0f);
+
+			farTracker.Add(10.0f, 10.0f, 20.0f, 20.0f);
+
+			const DamageRegion& farRegion = farTracker.Resolve(S_WIDTH, S_HEIGHT, 1);
+			isFarDamageClipped = !farRegion.isFull && farRegion.pixels == 100;
+		}
+
+		const bool isWideAreaExact = DamageRect{ -(1 << 30), -(1 << 30), 1 << 30, 1 << 30 }.Area() == (uint64_t)1 << 62;
+
+		const double screenPixels = (double)S_WIDTH * S_HEIGHT;
+
+		std::cout << S_SHAPE_COUNT << " shapes at " << S_WIDTH << 'x' << S_HEIGHT << ", " << S_BUFFER_COUNT << " targets in turn, "
+			<< S_MOVES_PER_FRAME << " moves and " << S_RECOLORS_PER_FRAME << " recolors per frame\n";
+		std::cout << "Full redraw : " << (fullMillis / S_FRAMES) << "ms per frame, " << S_SHAPE_COUNT << " shapes\n";
+		std::cout << "Damage redraw : " << (damageMillis / S_FRAMES) << "ms per frame (" << (fullMillis / damageMillis) << "x), "
+			<< (100.0 * damagePixels / (screenPixels * S_FRAMES)) << "% of pixels, " << (drawnShapes / S_FRAMES) << " shapes, "
+			<< fullFrames << " full redraws\n";
+		std::cout << "Matches full redraw every frame : " << (Check(isIdentical) ? "yes" : "no") << '\n';
+		std::cout << "New shape in a reused slot drawn above older ones : " << (Check(isNewestOnTop) ? "yes" : "no") << '\n';
+		std::cout << "Area of a rect spanning the clamped range : " << (Check(isWideAreaExact) ? "yes" : "no") << '\n';
+		std::cout << "Merged damage far off screen clipped away : " << (Check(isFarDamageClipped) ? "yes" : "no") << '\n';
+	}
+}
@@ -0,0 +1,172 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWDeltaEncoder.hpp"
+#include "CTMRenderer/Software/SWRenderer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		// Counts packets instead of keeping them, for the renderer run.
+		class CountingDeltaSink : public CTMRenderer::CTMSoftware::IDeltaSink
+		{
+		public:
+			virtual bool Write(const unsigned char*, size_t size) noexcept override
+			{
+				bytes += size;
+				++packets;
+				return true;
+			}
+		public:
+			uint64_t bytes = 0;
+			uint64_t packets = 0;
+		};
+
+		// Hashes odd lengths and offsets with every supported ISA, which must produce the scalar lanes.
+		bool HashMatchesScalar()
+		{
+			using namespace CTMRenderer::CTMSoftware;
+
+			const SWSpanKernels& scalar = *SpanKernels(SWKernelISA::SCALAR);
+			std::vector<uint32_t> pixels(512);
+			std::mt19937 random(1738u);
+
+			for (uint32_t& pixel : pixels)
+				pixel = random();
+
+			for (SWKernelISA isa : { SWKernelISA::SSE2, SWKernelISA::AVX2, SWKernelISA::AVX512 })
+			{
+				const SWSpanKernels* pKernels = SpanKernels(isa);
+				if (pKernels == nullptr)
+					continue;
+
+				for (size_t count = 0; count <= 100; ++count)
+				{
+					uint32_t expected[S_HASH_LANES] = { 1, 2, 3, 4, 5, 6, 7, 8 }, actual[S_HASH_LANES] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+					scalar.HashSpan(expected, pixels.data() + count % 7, count);
+					pKernels->HashSpan(actual, pixels.data() + count % 7, count);
+
+					if (std::memcmp(expected, actual, sizeof(expected)) != 0)
+					{
+						std::cout << pKernels->name << " hash differs from scalar at " << count << " pixels.\n";
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		// A dashboard : static panels, with a few counters and a scrolling sparkline redrawn every frame.
+		void DrawDashboard(CTMRenderer::CTMSoftware::SWFramebuffer& frame, uint64_t frameIndex)
+		{
+			using namespace CTMRenderer::CTMSoftware;
+
+			const unsigned int width = frame.Width(), height = frame.Height();
+
+			if (frameIndex == 0)
+			{
+				frame.Clear(PackBGRA8(0, 0, 26, 255));
+
+				for (unsigned int panel = 0; panel < 12; ++panel)
+				{
+					const int x = 20 + (int)(panel % 4) * 470, y = 20 + (int)(panel / 4) * 350;
+					FillRect(frame, { x, y, x + 450, y + 330 }, PackBGRA8(40, 44, 52, 255));
+				}
+			}
+
+			for (unsigned int counter = 0; counter < 12; ++counter)
+			{
+				const int x = 40 + (int)(counter % 4) * 470, y = 40 + (int)(counter / 4) * 350;
+				const unsigned char value = (unsigned char)(frameIndex * (counter + 1));
+
+				FillRect(frame, { x, y, x + 120, y + 24 }, PackBGRA8(value, 200, 255 - value, 255));
+			}
+
+			// A one pixel wide column of new data per frame, with the rest scrolled left.
+			for (unsigned int y = 0; y < 200; ++y)
+			{
+				uint32_t* pRow = frame.Row(height - 40 - 200 + y) + 40;
+
+				std::memmove(pRow, pRow + 1, (width / 2 - 1) * sizeof(uint32_t));
+				pRow[width / 2 - 1] = (y * 7 + frameIndex * 13) % 200 > 100 ? PackBGRA8(90, 220, 120, 255) : PackBGRA8(40, 44, 52, 255);
+			}
+		}
+	}
+
+	void BenchDeltaEncoder()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr uint64_t S_FRAMES = 120;
+
+		std::cout << "Hash kernels match scalar : " << (Check(HashMatchesScalar()) ? "yes" : "NO") << '\n';
+
+		Threading::WorkerPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+
+		for (SWDeltaCompare compare : { SWDeltaCompare::HASH, SWDeltaCompare::MEMCMP })
+		{
+			std::shared_ptr<MemoryDeltaSink> pSink = std::make_shared<MemoryDeltaSink>();
+
+			SWDeltaSettings settings;
+			settings.Sink = pSink;
+			settings.Compare = compare;
+
+			SWDeltaEncoder encoder(settings);
+			SWFramebuffer frame(S_WIDTH, S_HEIGHT), decoded;
+			bool isExact = true;
+			Timer::Timer timer;
+
+			for (uint64_t frameIndex = 0; frameIndex < S_FRAMES; ++frameIndex)
+			{
+				DrawDashboard(frame, frameIndex);
+				encoder.Encode(pool, frame, frameIndex);
+
+				// Round trip through the reference consumer, which must rebuild every frame exactly.
+				const std::vector<unsigned char>& packet = pSink->Packets().back();
+				isExact &= ApplyDeltaPacket(packet.data(), packet.size(), decoded);
+
+				for (unsigned int y = 0; y < S_HEIGHT && isExact; ++y)
+					isExact = std::memcmp(frame.Row(y), decoded.Row(y), S_WIDTH * sizeof(uint32_t)) == 0;
+
+				pSink->Clear();
+			}
+
+			const SWDeltaStats& stats = encoder.Stats();
+			const uint64_t deltaFrames = stats.frames - stats.keyframes;
+
+			std::cout << (compare == SWDeltaCompare::HASH ? "Hash" : "Memcmp") << " : "
+				<< (double)stats.bytes / stats.frames / 1024.0 << "KiB per frame (" << 100.0 * stats.bytes / stats.frameBytes << "% of raw frames), "
+				<< (double)(stats.changedTiles - stats.keyframes * (stats.tiles / stats.frames)) / deltaFrames << " changed tiles per delta frame, "
+				<< stats.rleTiles << " RLE tiles, "
+				<< stats.encodeMillis / stats.frames << "ms encoding per frame, round trip exact : " << (Check(isExact) ? "yes" : "NO") << '\n';
+		}
+
+		// Streaming from the renderer. The test scene is static, so everything after the keyframe is headers.
+		std::shared_ptr<CountingDeltaSink> pSink = std::make_shared<CountingDeltaSink>();
+
+		SWRendererSettings settings(0u);
+		settings.Width = S_WIDTH;
+		settings.Height = S_HEIGHT;
+		settings.MaxFrames = S_FRAMES;
+		settings.Delta.Sink = pSink;
+
+		SWRenderer renderer(settings);
+		renderer.Start();
+		renderer.JoinForShutdown();
+
+		const SWDeltaStats& stats = renderer.DeltaStats();
+		std::cout << "Renderer : " << stats.frames << " frames streamed in " << pSink->packets << " packets, " << pSink->bytes << " bytes for "
+			<< stats.frameBytes << " bytes of frames, " << stats.encodeMillis / stats.frames << "ms encoding per frame\n";
+	}
+}
@@ -0,0 +1,131 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/DynamicResolution.hpp"
+#include "CTMRenderer/Software/SWRenderer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		struct ControllerRun
+		{
+			unsigned int changes = 0;
+			unsigned int firstChangeFrame = 0; // 1-based, 0 if the scale never changed.
+			float minScale = 1.0f, maxScale = 0.0f;
+		};
+
+		// Feeds frames costing fullScaleMillis * scale^2, like a fill-bound renderer, into the controller.
+		ControllerRun Feed(CTMRenderer::DynamicResolution& controller, double fullScaleMillis, unsigned int frames)
+		{
+			ControllerRun run;
+
+			for (unsigned int frame = 1; frame <= frames; ++frame)
+			{
+				const double scale = controller.Scale();
+
+				if (controller.Update(fullScaleMillis * scale * scale))
+				{
+					if (run.changes++ == 0)
+						run.firstChangeFrame = frame;
+				}
+
+				run.minScale = std::min(run.minScale, controller.Scale());
+				run.maxScale = std::max(run.maxScale, controller.Scale());
+			}
+
+			return run;
+		}
+
+		void BenchController()
+		{
+			using namespace CTMRenderer;
+
+			const DynamicResolutionSettings settings; // 60 FPS budget, 0.5 to 1.0 in steps of 0.1.
+
+			// 20ms at full scale is over budget, while the 16.2ms at 0.9 sits between the thresholds : under the budget,
+			// but predicted above UpscaleThreshold at full scale again. It must step down once, then hold.
+			DynamicResolution holding(settings);
+			const ControllerRun holdRun = Feed(holding, 20.0, 1000);
+
+			const bool isHeldFirst = holdRun.firstChangeFrame == settings.DownscaleFrames;
+			const bool isStable = holdRun.changes == 1 && holding.Scale() < settings.MaxScale;
+
+			std::cout << "Over budget : stepped down after " << holdRun.firstChangeFrame << " frames to " << holding.Scale()
+				<< ", " << holdRun.changes << " change(s) over 1000 frames\n";
+			std::cout << "  Waits DownscaleFrames before stepping down : " << (Check(isHeldFirst) ? "yes" : "no") << '\n';
+			std::cout << "  Holds between the thresholds without oscillating : " << (Check(isStable) ? "yes" : "no") << '\n';
+
+			// Far over budget at any scale, so it steps down to MinScale and stays there.
+			DynamicResolution overloaded(settings);
+			const ControllerRun downRun = Feed(overloaded, 200.0, 1000);
+			const bool isClampedMin = overloaded.Scale() == settings.MinScale && downRun.minScale >= settings.MinScale;
+
+			std::cout << "Overloaded : " << downRun.changes << " change(s), settled at " << overloaded.Scale() << '\n';
+			std::cout << "  Clamped at MinScale : " << (Check(isClampedMin) ? "yes" : "no") << '\n';
+
+			// Then nearly free, so it steps back up to MaxScale and no further. The first step also waits for the average to decay.
+			const ControllerRun upRun = Feed(overloaded, 1.0, 1000);
+			const bool isClampedMax = overloaded.Scale() == settings.MaxScale && upRun.maxScale <= settings.MaxScale;
+			const bool isUpscaleHeld = upRun.firstChangeFrame >= settings.UpscaleFrames;
+
+			std::cout << "Idle : " << upRun.changes << " change(s), first after " << upRun.firstChangeFrame << " frames, settled at " << overloaded.Scale() << '\n';
+			std::cout << "  Waits at least UpscaleFrames before stepping up : " << (Check(isUpscaleHeld) ? "yes" : "no") << '\n';
+			std::cout << "  Clamped at MaxScale : " << (Check(isClampedMax) ? "yes" : "no") << '\n';
+		}
+
+		void BenchScaledRenderer()
+		{
+			using namespace CTMRenderer;
+			using namespace CTMRenderer::CTMSoftware;
+
+			// Paced to a 1ms budget at 1080p, more than a single core clears in time, so frames are rendered at a reduced scale.
+			SWRendererSettings settings(1000u);
+			settings.Width = 1920;
+			settings.Height = 1080;
+			settings.MaxFrames = 300;
+			settings.UseDynamicResolution = true;
+
+			SWRenderer renderer(settings);
+			renderer.Start();
+			renderer.JoinForShutdown();
+
+			const SWScaledTarget& scaledTarget = renderer.ScaledTarget();
+			const bool isBudgetFromFPS = scaledTarget.Controller().Settings().TargetFrameMillis == 1000.0 / settings.TargetFPS;
+
+			// The last frame, rendered again at the size it was rendered at, then upscaled like SWScaledTarget does.
+			const CTMDirectX::Window::Geometry::WindowArea screenArea(settings.Width, settings.Height);
+			SWRasterizer rasterizer(screenArea);
+			rasterizer.SetBaseQuad(ToAABB(S_TEST_SCENE.baseQuad));
+
+			SWFramebuffer frame = scaledTarget.IsScaled() ? SWFramebuffer(scaledTarget.Offscreen().Width(), scaledTarget.Offscreen().Height())
+				: SWFramebuffer(settings.Width, settings.Height);
+			frame.Clear(PackBGRA8(CTMDirectX::Graphics::DXNormColor(0, 0, .1f, 1.0f)));
+			rasterizer.DrawInstances(frame, S_TEST_SCENE.instances.data(), S_TEST_SCENE.instances.size());
+
+			SWFramebuffer reference(settings.Width, settings.Height);
+			BlitNearest(frame, reference);
+
+			const SWFramebuffer& output = renderer.Framebuffer();
+
+			bool isIdentical = output.Width() == settings.Width && output.Height() == settings.Height;
+			for (unsigned int y = 0; y < settings.Height && isIdentical; ++y)
+				isIdentical = std::memcmp(output.Row(y), reference.Row(y), settings.Width * sizeof(uint32_t)) == 0;
+
+			std::cout << "Paced " << settings.Width << 'x' << settings.Height << " at " << settings.TargetFPS << " FPS : last frame at "
+				<< frame.Width() << 'x' << frame.Height() << ", scale now " << scaledTarget.Controller().Scale()
+				<< " (average " << scaledTarget.Controller().AverageMillis() << "ms)\n";
+			std::cout << "  Budget derived from TargetFPS : " << (Check(isBudgetFromFPS) ? "yes" : "no") << '\n';
+			std::cout << "  Matches an upscaled render at the same scale : " << (Check(isIdentical) ? "yes" : "no") << '\n';
+		}
+	}
+
+	void BenchDynamicResolution()
+	{
+		BenchController();
+		BenchScaledRenderer();
+	}
+}
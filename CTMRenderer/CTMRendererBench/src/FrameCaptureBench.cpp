@@ -0,0 +1,86 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWRenderer.hpp"
+#include "CTMRenderer/Software/SWFrameDump.hpp"
+
+#include <filesystem>
+#include <iostream>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		constexpr uint64_t S_FRAMES = 300;
+
+		CTMRenderer::CTMSoftware::SWRendererSettings MakeSettings()
+		{
+			// Paced to 60, like an offline report render, so the writer has the frame budget's slack to work in.
+			CTMRenderer::CTMSoftware::SWRendererSettings settings(60u);
+			settings.Width = 1920;
+			settings.Height = 1080;
+			settings.MaxFrames = S_FRAMES;
+			return settings;
+		}
+
+		// Returns the average frame time, measured as the renderer's wall time per frame.
+		double RunRenderer(CTMRenderer::CTMSoftware::SWRenderer& renderer)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			renderer.Start();
+			renderer.JoinForShutdown();
+			const auto end = std::chrono::steady_clock::now();
+
+			return std::chrono::duration<double, std::milli>(end - start).count() / (double)renderer.FrameCount();
+		}
+	}
+
+	void BenchFrameCapture()
+	{
+		using namespace CTMRenderer::CTMSoftware;
+
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ctm_capture_bench";
+
+		{
+			SWRendererSettings settings = MakeSettings();
+			SWRenderer renderer(settings);
+			std::cout << "No capture : " << RunRenderer(renderer) << "ms per frame\n";
+		}
+
+		struct Format
+		{
+			SWCaptureFormat format;
+			const char* name;
+		};
+
+		for (const Format& format : { Format{ SWCaptureFormat::PPM_SEQUENCE, "PPM" }, Format{ SWCaptureFormat::PNG_SEQUENCE, "PNG" }, Format{ SWCaptureFormat::Y4M_STREAM, "Y4M" } })
+		{
+			std::filesystem::remove_all(directory);
+
+			SWRendererSettings settings = MakeSettings();
+			settings.Capture.Interval = 1;
+			settings.Capture.Format = format.format;
+			settings.Capture.Directory = directory;
+
+			SWRenderer renderer(settings);
+			const double frameMillis = RunRenderer(renderer);
+			const SWCaptureStats& stats = renderer.CaptureStats();
+
+			std::cout << "Async " << format.name << " : " << frameMillis << "ms per frame, " << stats.written << " written, " << stats.dropped
+				<< " dropped, copy " << stats.copyMillis / (double)stats.submitted << "ms per frame on the frame loop, encode "
+				<< stats.encodeMillis / std::max<double>((double)stats.written, 1.0) << "ms per frame on the writer\n";
+		}
+
+		// The old path, for comparison : every frame written synchronously.
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+
+		SWRendererSettings settings = MakeSettings();
+		SWFramebuffer frame(settings.Width, settings.Height);
+		frame.Clear(PackBGRA8(0, 0, 26, 255));
+
+		const double syncMillis = TimeMillis(20, [&] { (void)WritePPM(frame, directory / "sync.ppm"); });
+		std::cout << "Synchronous PPM write : " << syncMillis << "ms per frame, on the frame loop\n";
+
+		std::filesystem::remove_all(directory);
+	}
+}
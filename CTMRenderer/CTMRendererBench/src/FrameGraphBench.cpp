@@ -0,0 +1,148 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/FrameGraph.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+#include "CTMRenderer/Software/SWCompositor.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+
+		std::vector<CTMDirectX::Graphics::InstanceData> MakeRects(size_t count, unsigned int seed)
+		{
+			std::mt19937 random(seed);
+			std::uniform_real_distribution<float> position(-32.0f, (float)S_WIDTH);
+			std::uniform_real_distribution<float> size(4.0f, 96.0f);
+			std::uniform_int_distribution<int> channel(0, 255);
+
+			std::vector<CTMDirectX::Graphics::InstanceData> instances(count);
+			for (CTMDirectX::Graphics::InstanceData& instance : instances)
+			{
+				instance.scalarXY = { size(random), size(random) };
+				instance.offsetXY = { position(random), position(random) * S_HEIGHT / S_WIDTH };
+				instance.color = CTMDirectX::Graphics::DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), 255);
+			}
+
+			return instances;
+		}
+
+		// A dashboard view : a background, chart and label layers composited over it, then a HUD. The debug overlay
+		// is declared but not presented by this view, so it must be culled.
+		struct DashboardView
+		{
+			const SWRasterizer& rasterizer;
+			std::vector<CTMDirectX::Graphics::InstanceData> background = MakeRects(20000, 1);
+			std::vector<CTMDirectX::Graphics::InstanceData> charts = MakeRects(20000, 2);
+			std::vector<CTMDirectX::Graphics::InstanceData> labels = MakeRects(20000, 3);
+			std::vector<CTMDirectX::Graphics::InstanceData> hud = MakeRects(5000, 4);
+			std::atomic<unsigned int> debugPassRuns = 0;
+
+			void DrawLayer(SWFramebuffer& layer, const std::vector<CTMDirectX::Graphics::InstanceData>& instances) const
+			{
+				layer.Clear(0);
+				rasterizer.DrawInstances(layer, instances.data(), instances.size());
+			}
+
+			// Declares the view. Every pass runs on the caller when serial, otherwise on any thread.
+			void Declare(FrameGraph& graph, SWFramebuffer& output, SWFramebuffer& debugTarget, std::vector<SWFramebuffer>& physicals, bool isSerial)
+			{
+				const Threading::TaskAffinity affinity = isSerial ? Threading::TaskAffinity::CALLER : Threading::TaskAffinity::ANY;
+				const FrameResourceDesc layerDesc = { S_WIDTH, S_HEIGHT };
+
+				const FrameResourceID frame = graph.Import("Frame");
+				const FrameResourceID debugFrame = graph.Import("DebugFrame");
+				const FrameResourceID chartLayer = graph.CreateTransient("ChartLayer", layerDesc);
+				const FrameResourceID labelLayer = graph.CreateTransient("LabelLayer", layerDesc);
+				const FrameResourceID hudLayer = graph.CreateTransient("HudLayer", layerDesc);
+				const FrameResourceID debugLayer = graph.CreateTransient("DebugLayer", layerDesc);
+
+				auto physical = [&graph, &physicals](FrameResourceID id) -> SWFramebuffer& { return physicals[graph.PhysicalIndex(id)]; };
+
+				graph.AddPass("Background", {}, { frame }, [this, &output] {
+					output.Clear(PackBGRA8(0, 0, 26, 255));
+					rasterizer.DrawInstances(output, background.data(), background.size());
+				}, affinity);
+				graph.AddPass("Charts", {}, { chartLayer }, [=, this] { DrawLayer(physical(chartLayer), charts); }, affinity);
+				graph.AddPass("Labels", {}, { labelLayer }, [=, this] { DrawLayer(physical(labelLayer), labels); }, affinity);
+				graph.AddPass("CompositeLayers", { chartLayer, labelLayer, frame }, { frame }, [=, &output] {
+					CompositeOver(output, physical(chartLayer), 0, 0, 160);
+					CompositeOver(output, physical(labelLayer), 0, 0, 255);
+				}, affinity);
+				graph.AddPass("Hud", {}, { hudLayer }, [=, this] { DrawLayer(physical(hudLayer), hud); }, affinity);
+				graph.AddPass("CompositeHud", { hudLayer, frame }, { frame }, [=, &output] { CompositeOver(output, physical(hudLayer), 0, 0, 200); }, affinity);
+				graph.AddPass("DebugOverlay", {}, { debugLayer }, [=, this] { ++debugPassRuns; DrawLayer(physical(debugLayer), hud); }, affinity);
+				graph.AddPass("CompositeDebug", { debugLayer, frame }, { debugFrame }, [=, this, &debugTarget] {
+					++debugPassRuns;
+					CompositeOver(debugTarget, physical(debugLayer), 0, 0, 255);
+				}, affinity);
+
+				graph.MarkOutput(frame);
+				graph.Compile();
+
+				for (const FrameResourceDesc& desc : graph.PhysicalDescs())
+					physicals.emplace_back(desc.width, desc.height);
+			}
+		};
+	}
+
+	void BenchFrameGraph()
+	{
+		constexpr unsigned int S_ITERATIONS = 20;
+
+		const CTMDirectX::Window::Geometry::WindowArea screenArea(S_WIDTH, S_HEIGHT);
+		SWRasterizer rasterizer(screenArea);
+		rasterizer.SetBaseQuad(CTMDirectX::Graphics::Geometry::DXAABB(0, 0, 1, 1));
+
+		DashboardView view{ rasterizer };
+
+		// Reference : every layer in its own buffer, drawn and composited in declaration order.
+		SWFramebuffer reference(S_WIDTH, S_HEIGHT), chartLayer(S_WIDTH, S_HEIGHT), labelLayer(S_WIDTH, S_HEIGHT), hudLayer(S_WIDTH, S_HEIGHT);
+		reference.Clear(PackBGRA8(0, 0, 26, 255));
+		rasterizer.DrawInstances(reference, view.background.data(), view.background.size());
+		view.DrawLayer(chartLayer, view.charts);
+		view.DrawLayer(labelLayer, view.labels);
+		CompositeOver(reference, chartLayer, 0, 0, 160);
+		CompositeOver(reference, labelLayer, 0, 0, 255);
+		view.DrawLayer(hudLayer, view.hud);
+		CompositeOver(reference, hudLayer, 0, 0, 200);
+
+		Threading::WorkerPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+
+		for (bool isSerial : { true, false })
+		{
+			FrameGraph graph;
+			SWFramebuffer output(S_WIDTH, S_HEIGHT), debugTarget(S_WIDTH, S_HEIGHT);
+			std::vector<SWFramebuffer> physicals;
+
+			view.debugPassRuns = 0;
+			view.Declare(graph, output, debugTarget, physicals, isSerial);
+
+			const double millis = TimeMillis(S_ITERATIONS, [&] { graph.Execute(pool); });
+
+			bool isExact = true;
+			for (unsigned int y = 0; y < S_HEIGHT && isExact; ++y)
+				isExact = std::memcmp(reference.Row(y), output.Row(y), S_WIDTH * sizeof(uint32_t)) == 0;
+
+			if (!isSerial)
+				graph.PrintReport(std::cout);
+
+			const FrameGraphStats& stats = graph.Stats();
+			std::cout << (isSerial ? "Serial" : "Parallel") << " : " << millis << "ms per frame, " << stats.culledPasses << " of " << stats.passes << " passes culled, "
+				<< stats.physicalTransients << " physical layers for " << stats.transients << ", culled passes ran " << view.debugPassRuns.load()
+				<< " times, matches reference : " << (Check(isExact) ? "yes" : "NO") << '\n';
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWRenderer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchFrameRing()
+	{
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr unsigned int S_WIDTH = 3840, S_HEIGHT = 2160;
+		constexpr unsigned int S_STRIDE = S_WIDTH + 64; // Padded, like a shared memory or encoder surface.
+		constexpr uint64_t S_FRAMES = 300;
+		constexpr size_t S_SLOTS = 3;
+
+		// What a consumer of the internal framebuffer pays per frame : one full frame copy.
+		SWFramebuffer source(S_WIDTH, S_HEIGHT), copy(S_WIDTH, S_HEIGHT);
+		source.Clear(PackBGRA8(0, 0, 26, 255));
+
+		const double copyMillis = TimeMillis(50, [&] { BlitNearest(source, copy); });
+		std::cout << "4K frame copy : " << copyMillis << "ms per frame\n";
+
+		// Caller-owned ring, consumed by a thread waiting on the fence.
+		std::vector<std::vector<uint32_t>> memory(S_SLOTS, std::vector<uint32_t>((size_t)S_STRIDE * S_HEIGHT));
+		std::vector<uint32_t*> slotPixels;
+		for (std::vector<uint32_t>& slot : memory)
+			slotPixels.emplace_back(slot.data());
+
+		std::shared_ptr<SWFrameRing> pRing = std::make_shared<SWFrameRing>(slotPixels, S_WIDTH, S_HEIGHT, S_STRIDE);
+
+		SWRendererSettings settings(0u);
+		settings.Width = S_WIDTH;
+		settings.Height = S_HEIGHT;
+		settings.MaxFrames = S_FRAMES;
+		settings.OutputRing = pRing;
+
+		uint64_t consumedFrames = 0;
+		uint64_t checksum = 0;
+
+		std::thread consumer([&] {
+			for (uint64_t frame = 1; frame <= S_FRAMES; ++frame)
+			{
+				pRing->Fence().Wait(frame);
+
+				// Frames are rendered into the slots in order, and a slot isn't reused before its release.
+				const size_t slot = pRing->SlotOfFrame(frame);
+
+				checksum += pRing->Slot(slot).Row(S_HEIGHT / 2)[S_WIDTH / 2];
+				++consumedFrames;
+
+				pRing->Release(slot);
+			}
+		});
+
+		SWRenderer renderer(settings);
+
+		const auto start = std::chrono::steady_clock::now();
+		renderer.Start();
+		renderer.JoinForShutdown();
+		const auto end = std::chrono::steady_clock::now();
+
+		consumer.join();
+
+		const double totalMillis = std::chrono::duration<double, std::milli>(end - start).count();
+
+		std::cout << "Ring of " << S_SLOTS << " 4K slots : " << renderer.FrameCount() << " frames in " << totalMillis << "ms ("
+			<< totalMillis / (double)renderer.FrameCount() << "ms per frame), " << consumedFrames << " consumed, "
+			<< pRing->SkippedFrames() << " skipped while held (checksum " << checksum << ")\n";
+	}
+}
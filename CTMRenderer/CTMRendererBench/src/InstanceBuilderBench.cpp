@@ -0,0 +1,155 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/StaticScene.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchInstanceBuilder()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr size_t S_RECT_COUNT = 1000000;
+		constexpr size_t S_ODD_RECT_COUNT = S_RECT_COUNT + 3; // Leaves a tail after every vector width.
+		constexpr size_t S_CACHED_RECT_COUNT = 2048; // Stays in L2 together with its instances.
+		constexpr unsigned int S_ITERATIONS = 50;
+
+		const Geometry::DXAABB baseQuad(0, 0, 1920, 1080);
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(-32.0f, 1920.0f);
+		std::uniform_real_distribution<float> size(1.0f, 64.0f);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		std::vector<float> lefts(S_ODD_RECT_COUNT), tops(S_ODD_RECT_COUNT), rights(S_ODD_RECT_COUNT), bottoms(S_ODD_RECT_COUNT);
+		std::vector<DXColor> colors(S_ODD_RECT_COUNT);
+
+		for (size_t i = 0; i < S_ODD_RECT_COUNT; ++i)
+		{
+			lefts[i] = position(random);
+			tops[i] = position(random) * 1080.0f / 1920.0f;
+			rights[i] = lefts[i] + size(random);
+			bottoms[i] = tops[i] + size(random);
+			colors[i] = DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), 255);
+		}
+
+		RectBatch rects;
+		rects.pLeft = lefts.data();
+		rects.pTop = tops.data();
+		rects.pRight = rights.data();
+		rects.pBottom = bottoms.data();
+		rects.pColors = colors.data();
+		rects.count = S_RECT_COUNT;
+
+		// One spare instance on each side of an odd batch, to write it off the buffer's alignment and catch overruns.
+		std::vector<InstanceData> reference(S_ODD_RECT_COUNT + 2), instances(S_ODD_RECT_COUNT + 2);
+
+		auto matchesReference = [&](size_t count) {
+			return std::memcmp(instances.data(), reference.data(), count * sizeof(InstanceData)) == 0;
+		};
+
+		const double referenceMillis = TimeMillis(S_ITERATIONS, [&] { BuildInstancesReference(rects, baseQuad, reference.data()); });
+		const double simdMillis = TimeMillis(S_ITERATIONS, [&] { BuildInstances(rects, baseQuad, instances.data()); });
+
+		std::cout << S_RECT_COUNT << " rects, " << InstanceBuilderISA() << " builder\n";
+		std::cout << "One rect at a time : " << referenceMillis << "ms\n";
+		std::cout << "SIMD : " << simdMillis << "ms (" << (referenceMillis / simdMillis) << "x), matches reference : " << (Check(matchesReference(S_RECT_COUNT)) ? "yes" : "no") << '\n';
+
+		const unsigned int maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+		for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+		{
+			Threading::WorkerPool pool(threads);
+
+			std::fill(instances.begin(), instances.end(), InstanceData());
+			const double millis = TimeMillis(S_ITERATIONS, [&] { BuildInstances(pool, rects, baseQuad, instances.data()); });
+
+			std::cout << "SIMD, " << threads << " worker(s) + caller : " << millis << "ms, matches reference : " << (Check(matchesReference(S_RECT_COUNT)) ? "yes" : "no") << '\n';
+		}
+
+		// A batch small enough to stay in cache shows the cost of the conversion itself, without the trip to memory.
+		RectBatch cached = rects;
+		cached.count = S_CACHED_RECT_COUNT;
+
+		const double cachedReferenceMillis = TimeMillis(S_ITERATIONS * 200, [&] { BuildInstancesReference(cached, baseQuad, reference.data()); });
+		const double cachedSimdMillis = TimeMillis(S_ITERATIONS * 200, [&] { BuildInstances(cached, baseQuad, instances.data()); });
+		const double toPerMillion = 1000000.0 / S_CACHED_RECT_COUNT;
+
+		std::cout << "Cache resident, per 1M rects : one at a time " << cachedReferenceMillis * toPerMillion << "ms, SIMD "
+			<< cachedSimdMillis * toPerMillion << "ms, matches reference : " << (Check(matchesReference(S_CACHED_RECT_COUNT)) ? "yes" : "no") << '\n';
+
+		/* Counts off the vector width go through the scalar tail, and writing one instance into the buffer moves every
+		 * store off its alignment. Both builders must still match the reference and leave the instances around the batch alone. */
+		{
+			Threading::WorkerPool pool(std::max(maxThreads / 2, 1u));
+			bool isOddMatching = true;
+
+			for (const size_t count : { (size_t)1, (size_t)7, (size_t)9, S_ODD_RECT_COUNT })
+			{
+				RectBatch odd = rects;
+				odd.count = count;
+
+				BuildInstancesReference(odd, baseQuad, reference.data());
+
+				auto matchesOffsetReference = [&] {
+					const InstanceData untouched = {};
+					return std::memcmp(instances.data() + 1, reference.data(), count * sizeof(InstanceData)) == 0
+						&& std::memcmp(&instances[0], &untouched, sizeof(InstanceData)) == 0
+						&& std::memcmp(&instances[count + 1], &untouched, sizeof(InstanceData)) == 0;
+				};
+
+				std::fill(instances.begin(), instances.end(), InstanceData());
+				BuildInstances(odd, baseQuad, instances.data() + 1);
+				isOddMatching = isOddMatching && matchesOffsetReference();
+
+				std::fill(instances.begin(), instances.end(), InstanceData());
+				BuildInstances(pool, odd, baseQuad, instances.data() + 1);
+				isOddMatching = isOddMatching && matchesOffsetReference();
+			}
+
+			std::cout << "1, 7, 9 and " << S_ODD_RECT_COUNT << " rects, written one instance in, alone and across the pool, match reference : "
+				<< (Check(isOddMatching) ? "yes" : "no") << '\n';
+		}
+
+		// Static chrome baked at compile time must match the same rects built at runtime, bit for bit.
+		static constexpr StaticRect S_CHROME_RECTS[] = {
+			{ 0.0f, 0.0f, 1920.0f, 32.0f, DXColor(40, 40, 40, 255) },
+			{ 0.0f, 32.0f, 240.5f, 1080.0f, DXColor(56, 56, 60, 255) },
+			{ 12.25f, 44.75f, 228.125f, 71.3f, DXColor(DXColorType::BLUE) },
+			{ 1871.0f, 6.5f, 1913.7f, 25.1f, DXColor(DXColorType::RED) }
+		};
+		static constexpr auto S_CHROME = BakeScene(S_CHROME_RECTS, { 0.0f, 0.0f, 1920.0f, 1080.0f });
+
+		float chromeLefts[std::size(S_CHROME_RECTS)], chromeTops[std::size(S_CHROME_RECTS)], chromeRights[std::size(S_CHROME_RECTS)], chromeBottoms[std::size(S_CHROME_RECTS)];
+		DXColor chromeColors[std::size(S_CHROME_RECTS)];
+
+		for (size_t i = 0; i < std::size(S_CHROME_RECTS); ++i)
+		{
+			chromeLefts[i] = S_CHROME_RECTS[i].left;
+			chromeTops[i] = S_CHROME_RECTS[i].top;
+			chromeRights[i] = S_CHROME_RECTS[i].right;
+			chromeBottoms[i] = S_CHROME_RECTS[i].bottom;
+			chromeColors[i] = S_CHROME_RECTS[i].color;
+		}
+
+		RectBatch chrome;
+		chrome.pLeft = chromeLefts;
+		chrome.pTop = chromeTops;
+		chrome.pRight = chromeRights;
+		chrome.pBottom = chromeBottoms;
+		chrome.pColors = chromeColors;
+		chrome.count = std::size(S_CHROME_RECTS);
+
+		BuildInstancesReference(chrome, baseQuad, reference.data());
+
+		std::cout << "Baked at compile time, " << S_CHROME.instances.size() << " rects, matches reference : "
+			<< (Check(std::memcmp(S_CHROME.instances.data(), reference.data(), sizeof(S_CHROME.instances)) == 0) ? "yes" : "no") << '\n';
+	}
+}
@@ -0,0 +1,77 @@
+#include "Bench.hpp"
+
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+	struct Benchmark
+	{
+		std::string_view name;
+		void (*func)();
+	};
+
+	constexpr Benchmark S_BENCHMARKS[] = {
+		{ "taskgraph", CTMRendererBench::BenchTaskGraph },
+		{ "null", CTMRendererBench::BenchNullRenderer },
+		{ "host", CTMRendererBench::BenchRendererHost },
+		{ "software", CTMRendererBench::BenchSoftwareRenderer },
+		{ "tiled", CTMRendererBench::BenchTiledRaster },
+		{ "span", CTMRendererBench::BenchSpanKernels },
+		{ "compositor", CTMRendererBench::BenchCompositor },
+		{ "capture", CTMRendererBench::BenchFrameCapture },
+		{ "ring", CTMRendererBench::BenchFrameRing },
+		{ "delta", CTMRendererBench::BenchDeltaEncoder },
+		{ "framegraph", CTMRendererBench::BenchFrameGraph },
+		{ "shapes", CTMRendererBench::BenchShapeRaster },
+		{ "instances", CTMRendererBench::BenchInstanceBuilder },
+		{ "registry", CTMRendererBench::BenchShapeRegistry },
+		{ "picking", CTMRendererBench::BenchSpatialGrid },
+		{ "damage", CTMRendererBench::BenchDamage },
+		{ "scene", CTMRendererBench::BenchSceneGraph },
+		{ "canvas", CTMRendererBench::BenchChunkedCanvas },
+		{ "lod", CTMRendererBench::BenchRectLod },
+		{ "merge", CTMRendererBench::BenchRectMerger },
+		{ "clip", CTMRendererBench::BenchClipStack },
+		{ "resolution", CTMRendererBench::BenchDynamicResolution },
+		{ "threads", CTMRendererBench::BenchThreadConfig },
+	};
+
+	unsigned int s_FailedChecks = 0;
+}
+
+namespace CTMRendererBench
+{
+	bool Check(bool passed) noexcept
+	{
+		if (!passed)
+			++s_FailedChecks;
+
+		return passed;
+	}
+}
+
+// Runs every benchmark, or only the ones named on the command line. Exits with 1 if any correctness check failed.
+int main(int argc, char** argv)
+{
+	for (const Benchmark& benchmark : S_BENCHMARKS)
+	{
+		bool selected = argc <= 1;
+		for (int i = 1; i < argc; ++i)
+			selected |= benchmark.name == argv[i];
+
+		if (!selected)
+			continue;
+
+		std::cout << "== " << benchmark.name << " ==\n";
+		benchmark.func();
+	}
+
+	if (s_FailedChecks != 0)
+	{
+		std::cout << s_FailedChecks << " check(s) failed.\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,74 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Null/NullRenderer.hpp"
+
+#include <iostream>
+#include <string_view>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		constexpr uint64_t S_FRAMES = 100000;
+
+		/* Steps a renderer from the bench thread until it ends, calling damage before every frame, so each frame runs
+		 * real passes instead of resolving to nothing after the first BUFFER_COUNT frames. */
+		template <typename DamageFunction>
+		void RunDamaged(std::string_view name, DamageFunction&& damage)
+		{
+			using namespace CTMRenderer::CTMNull;
+
+			// Unpaced, so the run measures the CPU cost of the shared frame work (graph, damage and batches) alone.
+			NullRendererSettings settings(0u);
+			settings.MaxFrames = S_FRAMES;
+
+			NullRenderer renderer(settings);
+
+			// Dispatches the start event, which runs the startup graph. Frames begin with the next step.
+			renderer.Attach();
+			renderer.Step(0.0);
+
+			uint64_t frame = 0;
+
+			const auto start = std::chrono::steady_clock::now();
+			while (renderer.IsRunning())
+			{
+				damage(renderer.Damage(), frame++);
+				renderer.Step(0.0);
+			}
+			const auto end = std::chrono::steady_clock::now();
+
+			renderer.Detach();
+
+			const double totalMillis = std::chrono::duration<double, std::milli>(end - start).count();
+			const NullDrawStats& stats = renderer.Sink().Stats();
+
+			std::cout << name << " : " << stats.frames << " frames in " << totalMillis << "ms ("
+				<< (totalMillis * 1000.0 / stats.frames) << "us per frame)\n";
+			std::cout << "  Clears : " << stats.clears << " (" << stats.clearRects << " rects), draw calls : " << stats.drawCalls
+				<< ", instances : " << stats.instances << ", instance bytes : " << stats.instanceBytes << '\n';
+			std::cout << "  Text draws : " << stats.textDraws << " (" << stats.textCharacters << " characters)\n";
+
+			// Every frame was damaged, so every frame clears, and each pass draws every damage rect : the rects, the shapes and the text.
+			const bool isEveryFrameCleared = stats.frames == S_FRAMES && stats.clears == stats.frames;
+			const bool isEveryPassDrawn = stats.drawCalls == 2 * stats.clearRects && stats.textDraws == stats.clearRects;
+
+			std::cout << "  Every frame cleared : " << (Check(isEveryFrameCleared) ? "yes" : "no") << '\n';
+			std::cout << "  Every pass drawn per damage rect : " << (Check(isEveryPassDrawn) ? "yes" : "no") << '\n';
+		}
+	}
+
+	void BenchNullRenderer()
+	{
+		RunDamaged("Full damage", [](CTMRenderer::DamageTracker& damage, uint64_t) { damage.AddFull(); });
+
+		// A 64x64 box sweeping across the 800x600 screen, 8px per frame. With a buffer age of 2, each frame also repairs the previous one.
+		RunDamaged("Moving box", [](CTMRenderer::DamageTracker& damage, uint64_t frame) {
+			const float oldLeft = (float)((frame * 8) % 736);
+			const float newLeft = (float)(((frame + 1) * 8) % 736);
+			const float top = (float)((frame / 92 * 64) % 536);
+
+			damage.AddChange(oldLeft, top, oldLeft + 64.0f, top + 64.0f, newLeft, top, newLeft + 64.0f, top + 64.0f);
+		});
+	}
+}
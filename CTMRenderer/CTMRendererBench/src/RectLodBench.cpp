@@ -0,0 +1,131 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/ChunkedCanvas.hpp"
+#include "CTMRenderer/RectLod.hpp"
+#include "CTMRenderer/Timer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchRectLod()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr size_t S_RECT_COUNT = 2000000;
+		constexpr double S_WORLD_SIZE = 20000.0;
+		constexpr unsigned int S_ITERATIONS = 5;
+
+		const Geometry::DXAABB baseQuad(0, 0, 1, 1);
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<double> position(0.0, S_WORLD_SIZE);
+		std::uniform_real_distribution<double> size(1.0, 20.0);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		ChunkedCanvas canvas;
+		canvas.Reserve(S_RECT_COUNT);
+
+		for (size_t i = 0; i < S_RECT_COUNT; ++i)
+		{
+			const double left = position(random), top = position(random);
+			canvas.Add(left, top, left + size(random), top + size(random), DXColor((unsigned char)channel(random), (unsigned char)channel(random), 128, 255));
+		}
+
+		canvas.Build();
+
+		const CTMDirectX::Window::Geometry::WindowArea screenArea(S_WIDTH, S_HEIGHT);
+		SWRasterizer rasterizer(screenArea);
+		rasterizer.SetBaseQuad(baseQuad);
+		SWFramebuffer target(S_WIDTH, S_HEIGHT);
+
+		std::vector<InstanceData> instances, lodInstances, referenceInstances;
+		std::vector<uint32_t> visibleChunks;
+		std::vector<float> lefts, tops, rights, bottoms;
+		std::vector<DXColor> colors;
+
+		std::vector<size_t> visibleRects;
+
+		// Rebases every visible rect into one batch, in add order like ChunkedCanvas does, for the reference.
+		auto visibleBatch = [&](const Camera2D& camera) {
+			lefts.clear();
+			tops.clear();
+			rights.clear();
+			bottoms.clear();
+			colors.clear();
+			visibleRects.clear();
+
+			canvas.Cull(camera, visibleChunks);
+			for (uint32_t chunkIndex : visibleChunks)
+			{
+				const CanvasChunk& chunk = canvas.Chunks()[chunkIndex];
+				for (size_t i = chunk.first; i < (size_t)chunk.first + chunk.count; ++i)
+					visibleRects.push_back(i);
+			}
+
+			std::sort(visibleRects.begin(), visibleRects.end(), [&](size_t a, size_t b) { return canvas.Sequences()[a] < canvas.Sequences()[b]; });
+
+			for (size_t i : visibleRects)
+			{
+				lefts.push_back((float)((canvas.Lefts()[i] - camera.OriginX()) * camera.Zoom()));
+				tops.push_back((float)((canvas.Tops()[i] - camera.OriginY()) * camera.Zoom()));
+				rights.push_back((float)((canvas.Rights()[i] - camera.OriginX()) * camera.Zoom()));
+				bottoms.push_back((float)((canvas.Bottoms()[i] - camera.OriginY()) * camera.Zoom()));
+				colors.push_back(canvas.Colors()[i]);
+			}
+
+			RectBatch batch;
+			batch.pLeft = lefts.data();
+			batch.pTop = tops.data();
+			batch.pRight = rights.data();
+			batch.pBottom = bottoms.data();
+			batch.pColors = colors.data();
+			batch.count = colors.size();
+
+			return batch;
+		};
+
+		auto run = [&](const char* name, double zoom, const LodSettings& settings) {
+			Camera2D camera((float)S_WIDTH, (float)S_HEIGHT);
+			camera.SetCenter(S_WORLD_SIZE * 0.5, S_WORLD_SIZE * 0.5);
+			camera.SetZoom(zoom);
+
+			RectLod lod(settings);
+
+			const double submitMillis = TimeMillis(S_ITERATIONS, [&] { canvas.Submit(camera, baseQuad, instances); });
+			const double lodMillis = TimeMillis(S_ITERATIONS, [&] { canvas.Submit(camera, baseQuad, lod, lodInstances); });
+			const double drawMillis = TimeMillis(1, [&] { rasterizer.DrawInstances(target, instances.data(), instances.size()); });
+			const double lodDrawMillis = TimeMillis(1, [&] { rasterizer.DrawInstances(target, lodInstances.data(), lodInstances.size()); });
+
+			AggregateReference(visibleBatch(camera), baseQuad, S_WIDTH, S_HEIGHT, settings, referenceInstances);
+			const bool isReference = referenceInstances.size() == lodInstances.size()
+				&& std::memcmp(referenceInstances.data(), lodInstances.data(), lodInstances.size() * sizeof(InstanceData)) == 0;
+
+			const LodStats& stats = lod.Stats();
+
+			std::cout << name << ", zoom " << zoom << ", " << settings.CellSize << " pixel cells : " << instances.size() << " -> " << lodInstances.size()
+				<< " instances (" << stats.keptRects << " kept, " << stats.aggregatedRects << " into " << stats.cells << " cells, " << stats.droppedRects << " dropped)\n";
+			std::cout << "  Submit : " << submitMillis << "ms, with LOD " << lodMillis << "ms | Software draw : " << drawMillis << "ms, with LOD "
+				<< lodDrawMillis << "ms (" << (drawMillis / lodDrawMillis) << "x)\n";
+			std::cout << "  Submit and draw : " << (submitMillis + drawMillis) << "ms, with LOD " << (lodMillis + lodDrawMillis) << "ms\n";
+			std::cout << "  Matches the reference : " << (Check(isReference) ? "yes" : "no") << '\n';
+		};
+
+		std::cout << S_RECT_COUNT << " rects of 1 to 20 units over " << S_WORLD_SIZE << " units square, viewport " << S_WIDTH << 'x' << S_HEIGHT << '\n';
+
+		run("Whole canvas", S_HEIGHT / S_WORLD_SIZE, {});
+		run("Whole canvas", S_HEIGHT / S_WORLD_SIZE, { 1.0f, 1 });
+		run("Whole canvas", S_HEIGHT / S_WORLD_SIZE, { 1.0f, 4 });
+		run("Whole canvas", S_HEIGHT / S_WORLD_SIZE, { 1.0f, 16 });
+		run("Quarter of the canvas", S_HEIGHT * 4 / S_WORLD_SIZE, {});
+		run("Close up", 2.0, {});
+	}
+}
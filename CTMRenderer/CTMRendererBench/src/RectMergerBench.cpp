@@ -0,0 +1,149 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/RectMerger.hpp"
+#include "CTMRenderer/Timer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchRectMerger()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr unsigned int S_ITERATIONS = 20;
+
+		const Geometry::DXAABB baseQuad(0, 0, 1, 1);
+
+		const CTMDirectX::Window::Geometry::WindowArea screenArea(S_WIDTH, S_HEIGHT);
+		SWRasterizer rasterizer(screenArea);
+		rasterizer.SetBaseQuad(baseQuad);
+		SWFramebuffer target(S_WIDTH, S_HEIGHT), mergedTarget(S_WIDTH, S_HEIGHT);
+
+		std::vector<float> lefts, tops, rights, bottoms;
+		std::vector<DXColor> colors;
+		std::vector<InstanceData> instances, mergedInstances;
+
+		auto add = [&](float left, float top, float right, float bottom, const DXColor& color) {
+			lefts.push_back(left);
+			tops.push_back(top);
+			rights.push_back(right);
+			bottoms.push_back(bottom);
+			colors.push_back(color);
+		};
+
+		auto clear = [&]() {
+			lefts.clear();
+			tops.clear();
+			rights.clear();
+			bottoms.clear();
+			colors.clear();
+		};
+
+		auto draw = [&](const RectBatch& rects, std::vector<InstanceData>& built, SWFramebuffer& drawn) {
+			built.resize(rects.count);
+			BuildInstances(rects, baseQuad, built.data());
+
+			drawn.Clear(0);
+			return TimeMillis(S_ITERATIONS, [&] { rasterizer.DrawInstances(drawn, built.data(), built.size()); });
+		};
+
+		auto run = [&](const char* name) {
+			RectBatch rects;
+			rects.pLeft = lefts.data();
+			rects.pTop = tops.data();
+			rects.pRight = rights.data();
+			rects.pBottom = bottoms.data();
+			rects.pColors = colors.data();
+			rects.count = colors.size();
+
+			RectMerger merger;
+			RectBatch merged;
+
+			Timer::Timer timer;
+			merged = merger.Merge(rects);
+			const double mergeMillis = timer.ElapsedMillis();
+
+			const double drawMillis = draw(rects, instances, target);
+			const double mergedDrawMillis = draw(merged, mergedInstances, mergedTarget);
+
+			bool isIdentical = true;
+			for (unsigned int y = 0; y < S_HEIGHT && isIdentical; ++y)
+				isIdentical = std::memcmp(target.Row(y), mergedTarget.Row(y), S_WIDTH * sizeof(uint32_t)) == 0;
+
+			const MergeStats& stats = merger.Stats();
+
+			std::cout << name << " : " << stats.inputRects << " -> " << stats.outputRects << " rects, " << stats.cells << " cells"
+				<< (stats.isMerged ? "" : ", over the limit and left as they are") << '\n';
+			std::cout << "  Merge : " << mergeMillis << "ms | Software draw : " << drawMillis << "ms, merged " << mergedDrawMillis << "ms ("
+				<< (drawMillis / mergedDrawMillis) << "x)\n";
+			std::cout << "  Pixel identical : " << (Check(isIdentical) ? "yes" : "no") << '\n';
+		};
+
+		// A heatmap of a smooth field quantized to a few levels, over a background.
+		auto heatmap = [&](float cellSize) {
+			clear();
+			add(0.0f, 0.0f, (float)S_WIDTH, (float)S_HEIGHT, DXColor(24, 24, 24, 255));
+
+			const unsigned int columns = (unsigned int)(S_WIDTH / cellSize), rows = (unsigned int)(S_HEIGHT / cellSize);
+			for (unsigned int y = 0; y < rows; ++y)
+			{
+				for (unsigned int x = 0; x < columns; ++x)
+				{
+					const double field = std::sin(x * 0.05) * std::cos(y * 0.07) + std::sin((x + y) * 0.013);
+					const int level = (int)std::floor((field + 2.0) * 1.5);
+
+					if (level == 0)
+						continue;
+
+					add(x * cellSize, y * cellSize, (x + 1) * cellSize, (y + 1) * cellSize, DXColor((unsigned char)(level * 40), 64, (unsigned char)(255 - level * 40), 255));
+				}
+			}
+		};
+
+		heatmap(8.0f);
+		run("Heatmap of 8 pixel cells");
+
+		heatmap(1.37f);
+		run("Heatmap of 1.37 pixel cells");
+
+		// A table of zebra striped rows, each cell drawing its own background and borders.
+		clear();
+		constexpr float S_CELL_WIDTH = 96.0f, S_CELL_HEIGHT = 18.0f;
+		for (unsigned int row = 0; row < (unsigned int)(S_HEIGHT / S_CELL_HEIGHT); ++row)
+		{
+			for (unsigned int column = 0; column < (unsigned int)(S_WIDTH / S_CELL_WIDTH); ++column)
+			{
+				const float left = column * S_CELL_WIDTH, top = row * S_CELL_HEIGHT;
+				const DXColor stripe = (row % 2) == 0 ? DXColor(250, 250, 250, 255) : DXColor(236, 240, 244, 255);
+				const DXColor border(200, 200, 200, 255);
+
+				add(left, top, left + S_CELL_WIDTH, top + S_CELL_HEIGHT, stripe);
+				add(left, top + S_CELL_HEIGHT - 1.0f, left + S_CELL_WIDTH, top + S_CELL_HEIGHT, border);
+				add(left + S_CELL_WIDTH - 1.0f, top, left + S_CELL_WIDTH, top + S_CELL_HEIGHT, border);
+			}
+		}
+		run("Table with per cell borders");
+
+		// Scattered rects share almost no edges, and would cut the area into too many cells.
+		clear();
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(0.0f, (float)S_WIDTH - 20.0f);
+		std::uniform_real_distribution<float> size(1.0f, 20.0f);
+		for (unsigned int i = 0; i < 20000; ++i)
+		{
+			const float left = position(random), top = position(random) * S_HEIGHT / S_WIDTH;
+			add(left, top, left + size(random), top + size(random), DXColor(200, 100, 50, 255));
+		}
+		run("Scattered rects");
+	}
+}
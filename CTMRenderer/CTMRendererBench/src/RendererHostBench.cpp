@@ -0,0 +1,106 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/RendererHost.hpp"
+#include "CTMRenderer/Null/NullRenderer.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		constexpr unsigned int S_INSTANCES = 16;
+		constexpr unsigned int S_TARGET_FPS = 60;
+		constexpr uint64_t S_MAX_FRAMES = 60; // A second of frames each.
+
+		struct RunCost
+		{
+			double wallMillis = 0.0;
+			double cpuMillis = 0.0; // Of the whole process, so it includes every event thread, host thread and pool.
+		};
+
+		template <typename Function>
+		RunCost Measure(Function&& function)
+		{
+			const std::clock_t cpuStart = std::clock();
+			const auto start = std::chrono::steady_clock::now();
+			function();
+			const auto end = std::chrono::steady_clock::now();
+			const std::clock_t cpuEnd = std::clock();
+
+			return { std::chrono::duration<double, std::milli>(end - start).count(), 1000.0 * (double)(cpuEnd - cpuStart) / CLOCKS_PER_SEC };
+		}
+	}
+
+	void BenchRendererHost()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMNull;
+
+		NullRendererSettings settings(S_TARGET_FPS);
+		settings.MaxFrames = S_MAX_FRAMES;
+
+		// Every instance on its own event thread and worker pool, each sleeping and waking at 60 Hz.
+		std::vector<std::unique_ptr<NullRenderer>> standalone;
+		const RunCost standaloneCost = Measure([&] {
+			for (unsigned int i = 0; i < S_INSTANCES; ++i)
+				standalone.emplace_back(std::make_unique<NullRenderer>(settings))->Start();
+
+			for (std::unique_ptr<NullRenderer>& pRenderer : standalone)
+				pRenderer->JoinForShutdown();
+		});
+
+		bool isStandaloneComplete = true;
+		for (const std::unique_ptr<NullRenderer>& pRenderer : standalone)
+			isStandaloneComplete &= pRenderer->Sink().Stats().frames == S_MAX_FRAMES;
+
+		// The same instances stepped by one host thread on one pool. The last one is added after the host started.
+		std::vector<NullRenderer*> hosted;
+		bool isJoined = false;
+
+		const RunCost hostedCost = Measure([&] {
+			RendererHost host;
+
+			auto add = [&] { hosted.push_back(&static_cast<NullRenderer&>(host.Add(std::make_unique<NullRenderer>(settings, host.WorkerPool())))); };
+
+			for (unsigned int i = 0; i + 1 < S_INSTANCES; ++i)
+				add();
+
+			host.Start();
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			add();
+
+			// A host that misses an instance ending never returns from the join, so give up on it rather than hang the run.
+			std::future<void> join = std::async(std::launch::async, [&host] { host.JoinForShutdown(); });
+			isJoined = join.wait_for(std::chrono::seconds(30)) == std::future_status::ready;
+
+			if (!isJoined)
+			{
+				std::cout << "RendererHost::JoinForShutdown didn't return.\n";
+				std::_Exit(1);
+			}
+		});
+
+		bool isHostedComplete = true;
+		for (const NullRenderer* pRenderer : hosted)
+			isHostedComplete &= pRenderer->Sink().Stats().frames == S_MAX_FRAMES;
+
+		const bool isLateInstanceStepped = hosted.back()->Sink().Stats().frames == S_MAX_FRAMES;
+
+		std::cout << S_INSTANCES << " null renderers at " << S_TARGET_FPS << " FPS for " << S_MAX_FRAMES << " frames each\n";
+		std::cout << "Standalone : " << standaloneCost.wallMillis << "ms wall, " << standaloneCost.cpuMillis << "ms CPU\n";
+		std::cout << "Hosted : " << hostedCost.wallMillis << "ms wall, " << hostedCost.cpuMillis << "ms CPU\n";
+		std::cout << "Every standalone instance reached MaxFrames : " << (Check(isStandaloneComplete) ? "yes" : "no") << '\n';
+		std::cout << "Every hosted instance reached MaxFrames : " << (Check(isHostedComplete) ? "yes" : "no") << '\n';
+		std::cout << "Instance added after Start stepped : " << (Check(isLateInstanceStepped) ? "yes" : "no") << '\n';
+		std::cout << "JoinForShutdown returned : " << (Check(isJoined) ? "yes" : "no") << '\n';
+	}
+}
@@ -0,0 +1,137 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/SceneGraph.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchSceneGraph()
+	{
+		using namespace CTMRenderer;
+
+		constexpr size_t S_PANEL_COUNT = 100;
+		constexpr size_t S_CHILDREN_PER_PANEL = 1000;
+		constexpr size_t S_BIG_PANEL_CHILDREN = 10000;
+		constexpr unsigned int S_FRAMES = 1000;
+		constexpr size_t S_LEAF_MOVES_PER_FRAME = 16; // Animated widgets.
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+		std::uniform_real_distribution<float> angle(-0.2f, 0.2f);
+
+		SceneGraph scene;
+		scene.Reserve(1 + S_PANEL_COUNT * (S_CHILDREN_PER_PANEL + 1) + S_BIG_PANEL_CHILDREN + 1);
+
+		std::vector<SceneNode> leaves;
+
+		// Panels, each holding a column of widgets, some of them rotated like the panels.
+		for (size_t i = 0; i < S_PANEL_COUNT; ++i)
+		{
+			const SceneNode panel = scene.Add(scene.Root(), Combine(Affine2D::Translation(position(random), position(random)), Affine2D::Rotation(angle(random))));
+
+			for (size_t j = 0; j < S_CHILDREN_PER_PANEL; ++j)
+				leaves.push_back(scene.Add(panel, Combine(Affine2D::Translation(8.0f, 24.0f * j), Affine2D::Rotation(angle(random)))));
+		}
+
+		const SceneNode bigPanel = scene.Add(scene.Root(), Affine2D::Translation(200.0f, 100.0f));
+		for (size_t j = 0; j < S_BIG_PANEL_CHILDREN; ++j)
+			scene.Add(bigPanel, Affine2D::Translation(16.0f * (j % 100), 16.0f * (j / 100)));
+
+		Timer::Timer timer;
+		scene.Update();
+		const double layoutMillis = timer.ElapsedMillis();
+
+		// Recomputes a node's world transform from scratch, walking up its parents.
+		auto referenceWorld = [&](SceneNode node) {
+			std::vector<SceneNode> chain;
+			for (; node.index != scene.Root().index; node = scene.Parent(node))
+				chain.push_back(node);
+
+			Affine2D world = scene.Local(scene.Root());
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+				world = Combine(world, scene.Local(*it));
+
+			return world;
+		};
+
+		auto matchesReference = [&] {
+			for (uint32_t order = 0; order < scene.Size(); ++order)
+				if (!(scene.Worlds()[order] == referenceWorld(scene.NodeAt(order))))
+					return false;
+
+			return true;
+		};
+
+		// Dragging the big panel around.
+		size_t panelUpdatedNodes = 0;
+		timer.Reset();
+
+		for (unsigned int frame = 0; frame < S_FRAMES; ++frame)
+		{
+			scene.SetLocal(bigPanel, Affine2D::Translation(200.0f + (float)(frame % 64), 100.0f + (float)(frame % 32)));
+			scene.Update();
+			panelUpdatedNodes += scene.Stats().updatedNodes;
+		}
+
+		const double panelMillis = timer.ElapsedMillis() / S_FRAMES;
+
+		// Moving the root, which every node depends on, like a full recompute.
+		timer.Reset();
+
+		for (unsigned int frame = 0; frame < S_FRAMES; ++frame)
+		{
+			scene.SetLocal(scene.Root(), Affine2D::Translation((float)(frame % 8), 0.0f));
+			scene.Update();
+		}
+
+		const double fullMillis = timer.ElapsedMillis() / S_FRAMES;
+		scene.SetLocal(scene.Root(), {});
+		scene.Update();
+
+		// A few leaves at a time.
+		std::uniform_int_distribution<size_t> pickLeaf(0, leaves.size() - 1);
+		std::vector<size_t> leafPicks(S_FRAMES * S_LEAF_MOVES_PER_FRAME);
+		for (size_t& pick : leafPicks)
+			pick = pickLeaf(random);
+
+		size_t leafUpdatedNodes = 0;
+		timer.Reset();
+
+		for (unsigned int frame = 0; frame < S_FRAMES; ++frame)
+		{
+			for (size_t i = 0; i < S_LEAF_MOVES_PER_FRAME; ++i)
+			{
+				const SceneNode leaf = leaves[leafPicks[frame * S_LEAF_MOVES_PER_FRAME + i]];
+				scene.SetLocal(leaf, Combine(Affine2D::Translation(1.0f, 0.0f), scene.Local(leaf)));
+			}
+
+			scene.Update();
+			leafUpdatedNodes += scene.Stats().updatedNodes;
+		}
+
+		const double leafMillis = timer.ElapsedMillis() / S_FRAMES;
+		const bool isAnimatedMatch = matchesReference();
+
+		// Reparenting a panel's widgets into the big panel, which lays the whole graph out again.
+		for (size_t j = 0; j < S_CHILDREN_PER_PANEL; ++j)
+			scene.SetParent(leaves[j], bigPanel);
+
+		timer.Reset();
+		scene.Update();
+		const double relayoutMillis = timer.ElapsedMillis();
+
+		std::cout << scene.Size() << " nodes : " << S_PANEL_COUNT << " panels of " << S_CHILDREN_PER_PANEL << " widgets and one of " << S_BIG_PANEL_CHILDREN << '\n';
+		std::cout << "First layout : " << layoutMillis << "ms\n";
+		std::cout << "Recomputing every node : " << fullMillis << "ms\n";
+		std::cout << "Moving the big panel : " << panelMillis << "ms (" << (fullMillis / panelMillis) << "x), "
+			<< (panelUpdatedNodes / S_FRAMES) << " nodes updated per frame\n";
+		std::cout << "Moving " << S_LEAF_MOVES_PER_FRAME << " widgets : " << (leafMillis * 1000.0) << "us, "
+			<< (leafUpdatedNodes / S_FRAMES) << " nodes updated per frame\n";
+		std::cout << "Reparenting " << S_CHILDREN_PER_PANEL << " widgets, then laying out : " << relayoutMillis << "ms\n";
+		std::cout << "Matches recomputing from parents : " << (Check(isAnimatedMatch && matchesReference()) ? "yes" : "no") << '\n';
+	}
+}
@@ -0,0 +1,120 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWShapeRasterizer.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXShape.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		struct TessellatedVertex
+		{
+			float x, y;
+			uint32_t color;
+		};
+
+		// What drawing circles without an analytic pipeline costs before any rasterization : a triangle fan per marker.
+		void TessellateCircles(const std::vector<CTMRenderer::CTMDirectX::Graphics::ShapeInstanceData>& shapes, unsigned int segments, std::vector<TessellatedVertex>& vertices)
+		{
+			vertices.clear();
+
+			for (const CTMRenderer::CTMDirectX::Graphics::ShapeInstanceData& shape : shapes)
+			{
+				const uint32_t color = CTMRenderer::CTMSoftware::PackBGRA8(shape.fillColor);
+
+				for (unsigned int segment = 0; segment < segments; ++segment)
+				{
+					const float angle0 = 6.2831853f * segment / segments, angle1 = 6.2831853f * (segment + 1) / segments;
+
+					vertices.push_back({ shape.centerXY.x, shape.centerXY.y, color });
+					vertices.push_back({ shape.centerXY.x + std::cos(angle0) * shape.halfSizeXY.x, shape.centerXY.y + std::sin(angle0) * shape.halfSizeXY.y, color });
+					vertices.push_back({ shape.centerXY.x + std::cos(angle1) * shape.halfSizeXY.x, shape.centerXY.y + std::sin(angle1) * shape.halfSizeXY.y, color });
+				}
+			}
+		}
+	}
+
+	void BenchShapeRaster()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr unsigned int S_ITERATIONS = 20;
+		constexpr unsigned int S_TESSELLATION_SEGMENTS = 32;
+
+		// Scatter plot markers, rounded cards and bordered panels, with some translucency.
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> x(0.0f, (float)S_WIDTH), y(0.0f, (float)S_HEIGHT);
+		std::uniform_real_distribution<float> markerRadius(2.0f, 12.0f), cardSize(20.0f, 200.0f), fraction(0.0f, 1.0f);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		auto randomColor = [&](bool isTranslucent) {
+			return DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), isTranslucent ? (unsigned char)channel(random) : 255);
+		};
+
+		std::vector<ShapeInstanceData> markers, shapes;
+
+		for (unsigned int i = 0; i < 10000; ++i)
+			markers.emplace_back(Geometry::DXCircle(x(random), y(random), markerRadius(random), randomColor(i % 4 == 0)).Instance());
+
+		for (unsigned int i = 0; i < 500; ++i)
+		{
+			const float left = x(random), top = y(random), width = cardSize(random), height = cardSize(random);
+			const float border = i % 2 == 0 ? 1.0f + 4.0f * fraction(random) : 0.0f;
+
+			shapes.emplace_back(Geometry::DXRoundedRect(left, top, left + width, top + height, 12.0f * fraction(random), randomColor(i % 3 == 0), border, randomColor(false)).Instance());
+		}
+
+		shapes.insert(shapes.end(), markers.begin(), markers.end());
+
+		std::cout << markers.size() << " circles and " << shapes.size() - markers.size() << " rounded / bordered rects at " << S_WIDTH << 'x' << S_HEIGHT << '\n';
+
+		const uint32_t clearBgra = PackBGRA8(0, 0, 26, 255);
+		SWFramebuffer reference(S_WIDTH, S_HEIGHT), target(S_WIDTH, S_HEIGHT);
+
+		const double referenceMillis = TimeMillis(S_ITERATIONS, [&] {
+			reference.Clear(clearBgra);
+			DrawShapesReference(reference, shapes.data(), shapes.size());
+		});
+
+		const double spanMillis = TimeMillis(S_ITERATIONS, [&] {
+			target.Clear(clearBgra);
+			DrawShapes(target, shapes.data(), shapes.size());
+		});
+
+		auto matchesReference = [&] {
+			for (unsigned int row = 0; row < S_HEIGHT; ++row)
+				if (std::memcmp(reference.Row(row), target.Row(row), S_WIDTH * sizeof(uint32_t)) != 0)
+					return false;
+			return true;
+		};
+
+		std::cout << "Distance at every pixel : " << referenceMillis << "ms\n";
+		std::cout << "Interior spans : " << spanMillis << "ms, matches reference : " << (Check(matchesReference()) ? "yes" : "NO") << '\n';
+
+		Threading::WorkerPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+
+		const double parallelMillis = TimeMillis(S_ITERATIONS, [&] {
+			target.Clear(clearBgra);
+			DrawShapes(pool, target, shapes.data(), shapes.size());
+		});
+
+		std::cout << "Row bands (" << pool.ThreadCount() << " worker(s) + caller) : " << parallelMillis << "ms, matches reference : " << (Check(matchesReference()) ? "yes" : "NO") << '\n';
+
+		// The per-frame cost analytic shapes avoid, and the data they send instead.
+		std::vector<TessellatedVertex> vertices;
+		const double tessellationMillis = TimeMillis(S_ITERATIONS, [&] { TessellateCircles(markers, S_TESSELLATION_SEGMENTS, vertices); });
+
+		std::cout << "Tessellating the circles (" << S_TESSELLATION_SEGMENTS << " segments) : " << tessellationMillis << "ms, "
+			<< vertices.size() * sizeof(TessellatedVertex) / 1024 << "KiB of vertices, against " << markers.size() * sizeof(ShapeInstanceData) / 1024 << "KiB of instances\n";
+	}
+}
@@ -0,0 +1,138 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/ShapeRegistry.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchShapeRegistry()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr size_t S_SHAPE_COUNT = 300000;
+		constexpr size_t S_CHURN_PER_FRAME = 30000; // Shapes removed and added each frame, plus as many updated.
+		constexpr unsigned int S_FRAMES = 50;
+
+		const Geometry::DXAABB baseQuad(0, 0, 1920, 1080);
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(0.0f, 1900.0f);
+		std::uniform_real_distribution<float> size(1.0f, 32.0f);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		auto randomColor = [&] { return DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), 255); };
+
+		// Shapes as individual heap objects behind IShape, walked one pointer at a time.
+		std::vector<std::unique_ptr<Geometry::IShape>> objects;
+		objects.reserve(S_SHAPE_COUNT);
+
+		ShapeRegistry registry;
+		registry.Reserve(S_SHAPE_COUNT);
+
+		std::vector<ShapeHandle> handles;
+
+		for (size_t i = 0; i < S_SHAPE_COUNT; ++i)
+		{
+			const float left = position(random), top = position(random) * 0.5f;
+			const float right = left + size(random), bottom = top + size(random);
+			const DXColor color = randomColor();
+
+			objects.push_back(std::make_unique<Geometry::DXRect>(left, top, right, bottom, color));
+			handles.push_back(registry.Add(left, top, right, bottom, color));
+		}
+
+		std::vector<InstanceData> instances(S_SHAPE_COUNT);
+
+		const float invBaseWidth = 1.0f / baseQuad.width, invBaseHeight = 1.0f / baseQuad.height;
+
+		const double objectMillis = TimeMillis(S_FRAMES, [&] {
+			for (size_t i = 0; i < objects.size(); ++i)
+			{
+				Geometry::DXRect& rect = static_cast<Geometry::DXRect&>(*objects[i]);
+				const Geometry::DXAABB& aabb = rect.Aabb();
+
+				instances[i].scalarXY = { aabb.width * invBaseWidth, aabb.height * invBaseHeight };
+				instances[i].offsetXY = { aabb.left - baseQuad.left, aabb.top - baseQuad.top };
+				instances[i].color = rect.Color();
+			}
+		});
+
+		const double registryMillis = TimeMillis(S_FRAMES, [&] { BuildInstances(registry.Batch(), baseQuad, instances.data()); });
+
+		std::cout << S_SHAPE_COUNT << " live shapes\n";
+		std::cout << "Instances from IShape objects : " << objectMillis << "ms\n";
+		std::cout << "Instances from registry columns : " << registryMillis << "ms (" << (objectMillis / registryMillis) << "x)\n";
+
+		// Churn : every frame removes random shapes, adds as many and updates as many more. Random picks are drawn up front.
+		constexpr size_t S_PICKS = S_CHURN_PER_FRAME * S_FRAMES;
+		constexpr size_t S_RECT_POOL = 4096;
+
+		std::vector<size_t> victims(S_PICKS), updated(S_PICKS);
+		for (size_t i = 0; i < S_PICKS; ++i)
+		{
+			victims[i] = std::uniform_int_distribution<size_t>(0, handles.size() - 1)(random);
+			updated[i] = std::uniform_int_distribution<size_t>(0, handles.size() - 1)(random);
+		}
+
+		std::vector<Geometry::DXRect> rectPool;
+		rectPool.reserve(S_RECT_POOL);
+		for (size_t i = 0; i < S_RECT_POOL; ++i)
+		{
+			const float left = position(random), top = position(random) * 0.5f;
+			rectPool.emplace_back(left, top, left + size(random), top + size(random), randomColor());
+		}
+
+		std::vector<ShapeHandle> staleHandles;
+		staleHandles.reserve(S_PICKS);
+
+		Timer::Timer timer;
+
+		for (size_t i = 0; i < S_PICKS; ++i)
+		{
+			ShapeHandle& victim = handles[victims[i]];
+			staleHandles.push_back(victim);
+
+			registry.Remove(victim);
+			victim = registry.Add(rectPool[i % S_RECT_POOL]);
+
+			Geometry::DXRect& rect = rectPool[(i + S_RECT_POOL / 2) % S_RECT_POOL];
+			const ShapeHandle handle = handles[updated[i]];
+
+			registry.SetBounds(handle, rect.Aabb().left, rect.Aabb().top, rect.Aabb().right, rect.Aabb().bottom);
+			registry.SetColor(handle, rect.Color());
+		}
+
+		const double churnMillis = timer.ElapsedMillis() / S_FRAMES;
+
+		// Every stale handle must be rejected, and every live one must still reach its own shape.
+		size_t acceptedStale = 0;
+		for (const ShapeHandle& handle : staleHandles)
+			acceptedStale += registry.SetColor(handle, DXColor()) ? 1 : 0;
+
+		for (size_t i = 0; i < handles.size(); ++i)
+		{
+			const uint32_t marker = (uint32_t)i;
+			registry.SetColor(handles[i], DXColor((unsigned char)marker, (unsigned char)(marker >> 8), (unsigned char)(marker >> 16), 255));
+		}
+
+		bool isConsistent = registry.Size() == S_SHAPE_COUNT && acceptedStale == 0;
+		const RectBatch batch = registry.Batch();
+
+		for (size_t i = 0; i < handles.size() && isConsistent; ++i)
+		{
+			const DXColor& color = batch.pColors[registry.DenseIndex(handles[i])];
+			isConsistent = registry.IsAlive(handles[i]) && registry.Handle(registry.DenseIndex(handles[i])) == handles[i]
+				&& ((size_t)color.r() | ((size_t)color.g() << 8) | ((size_t)color.b() << 16)) == (i & 0xFFFFFF);
+		}
+
+		std::cout << "Churn, " << S_CHURN_PER_FRAME << " removes, adds and updates per frame : " << churnMillis << "ms ("
+			<< (churnMillis * 1000000.0 / (S_CHURN_PER_FRAME * 3)) << "ns per operation)\n";
+		std::cout << "Stale handles rejected and live handles consistent : " << (Check(isConsistent) ? "yes" : "no") << '\n';
+	}
+}
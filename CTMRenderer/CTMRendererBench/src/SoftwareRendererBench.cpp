@@ -0,0 +1,36 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWRenderer.hpp"
+
+#include <iostream>
+
+namespace CTMRendererBench
+{
+	void BenchSoftwareRenderer()
+	{
+		using namespace CTMRenderer::CTMSoftware;
+
+		// Unpaced 1080p, so the run measures clear and fill throughput of the rasterizer.
+		SWRendererSettings settings(0u);
+		settings.Width = 1920;
+		settings.Height = 1080;
+		settings.MaxFrames = 2000;
+
+		SWRenderer renderer(settings);
+
+		const auto start = std::chrono::steady_clock::now();
+		renderer.Start();
+		renderer.JoinForShutdown();
+		const auto end = std::chrono::steady_clock::now();
+
+		const double totalMillis = std::chrono::duration<double, std::milli>(end - start).count();
+		const double frames = (double)renderer.FrameCount();
+		const double pixels = (double)settings.Width * settings.Height;
+
+		std::cout << "Frames : " << renderer.FrameCount() << " at " << settings.Width << 'x' << settings.Height << " in " << totalMillis << "ms ("
+			<< (totalMillis / frames) << "ms per frame, " << (frames * pixels / totalMillis / 1000.0) << " Mpx/s cleared)\n";
+
+		if (renderer.DumpFrame("software_bench.ppm"))
+			std::cout << "Last frame written to software_bench.ppm\n";
+	}
+}
@@ -0,0 +1,108 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		constexpr uint32_t S_SENTINEL = 0xDEADBEEF;
+		constexpr uint32_t S_COLOR = 0xFF20C040;
+
+		// Fills every offset and length up to 2 vectors of the widest ISA, comparing against the scalar kernel, sentinels included.
+		bool MatchesScalar(const CTMRenderer::CTMSoftware::SWSpanKernels& kernels)
+		{
+			const CTMRenderer::CTMSoftware::SWSpanKernels& scalar = *CTMRenderer::CTMSoftware::SpanKernels(CTMRenderer::CTMSoftware::SWKernelISA::SCALAR);
+
+			std::vector<uint32_t> expected(256), actual(256);
+
+			for (size_t offset = 0; offset < 16; ++offset)
+			{
+				for (size_t count = 0; count <= 160; ++count)
+				{
+					std::fill(expected.begin(), expected.end(), S_SENTINEL);
+					std::fill(actual.begin(), actual.end(), S_SENTINEL);
+
+					scalar.FillSpan(expected.data() + offset, count, S_COLOR);
+					kernels.FillSpan(actual.data() + offset, count, S_COLOR);
+
+					if (expected != actual)
+						return false;
+				}
+			}
+
+			// Rects, strided and contiguous.
+			for (size_t stride : { 37u, 8u })
+			{
+				std::fill(expected.begin(), expected.end(), S_SENTINEL);
+				std::fill(actual.begin(), actual.end(), S_SENTINEL);
+
+				scalar.FillRect(expected.data() + 3, stride, 8, 5, S_COLOR);
+				kernels.FillRect(actual.data() + 3, stride, 8, 5, S_COLOR);
+
+				if (expected != actual)
+					return false;
+			}
+
+			return true;
+		}
+
+		double GigabytesPerSecond(size_t bytes, double millis)
+		{
+			return (double)bytes / (millis * 1e6);
+		}
+	}
+
+	void BenchSpanKernels()
+	{
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr size_t S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr size_t S_SPAN = 2048; // 8KB, stays in L1.
+		constexpr size_t S_RECT = 64;
+
+		std::vector<uint32_t> framebuffer(S_WIDTH * S_HEIGHT);
+		std::vector<uint32_t> span(S_SPAN + 16);
+
+		std::cout << "Active : " << ActiveSpanKernels().name << '\n';
+
+		for (SWKernelISA isa : { SWKernelISA::SCALAR, SWKernelISA::SSE2, SWKernelISA::AVX2, SWKernelISA::AVX512 })
+		{
+			const SWSpanKernels* pKernels = SpanKernels(isa);
+
+			if (pKernels == nullptr)
+				continue;
+
+			const bool isCorrect = MatchesScalar(*pKernels);
+
+			const double clearMillis = TimeMillis(200, [&] {
+				pKernels->FillRect(framebuffer.data(), S_WIDTH, S_WIDTH, S_HEIGHT, S_COLOR);
+			});
+
+			// Offset by one pixel, so the kernels deal with a misaligned head and tail.
+			const double spanMillis = TimeMillis(200000, [&] {
+				pKernels->FillSpan(span.data() + 1, S_SPAN, S_COLOR);
+			});
+
+			// 64x64 rects walking the framebuffer at odd positions, like the tiled rasterizer fills them.
+			size_t rectIndex = 0;
+			const double rectMillis = TimeMillis(200000, [&] {
+				const size_t x = (rectIndex * 67) % (S_WIDTH - S_RECT);
+				const size_t y = (rectIndex * 29) % (S_HEIGHT - S_RECT);
+				++rectIndex;
+
+				pKernels->FillRect(framebuffer.data() + y * S_WIDTH + x, S_WIDTH, S_RECT, S_RECT, S_COLOR);
+			});
+
+			std::cout << pKernels->name << (Check(isCorrect) ? "" : " MISMATCH") << " : clear 1080p "
+				<< GigabytesPerSecond(S_WIDTH * S_HEIGHT * 4, clearMillis) << " GB/s, span "
+				<< GigabytesPerSecond(S_SPAN * 4, spanMillis) << " GB/s, rect 64x64 "
+				<< GigabytesPerSecond(S_RECT * S_RECT * 4, rectMillis) << " GB/s\n";
+		}
+	}
+}
@@ -0,0 +1,166 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/SpatialGrid.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchSpatialGrid()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMDirectX::Graphics;
+
+		constexpr size_t S_SHAPE_COUNT = 100000;
+		constexpr float S_WORLD_SIZE = 4096.0f;
+		constexpr size_t S_QUERIES = 200000;
+		constexpr size_t S_CHECKED_QUERIES = 1000; // Also answered by looping over every shape, to check the grid.
+		constexpr float S_QUERY_RECT_SIZE = 128.0f;
+
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(0.0f, S_WORLD_SIZE - 48.0f);
+		std::uniform_real_distribution<float> size(4.0f, 48.0f);
+		std::uniform_real_distribution<float> nudge(-4.0f, 4.0f);
+
+		ShapeRegistry registry;
+		SpatialGrid grid(S_WORLD_SIZE, S_WORLD_SIZE);
+		std::vector<ShapeHandle> handles;
+
+		for (size_t i = 0; i < S_SHAPE_COUNT; ++i)
+		{
+			const float left = position(random), top = position(random);
+			const float right = left + size(random), bottom = top + size(random);
+
+			handles.push_back(registry.Add(left, top, right, bottom, DXColor(DXColorType::WHITE)));
+			grid.Insert(handles.back(), left, top, right, bottom);
+		}
+
+		std::vector<float> queryX(S_QUERIES), queryY(S_QUERIES);
+		for (size_t i = 0; i < S_QUERIES; ++i)
+		{
+			queryX[i] = position(random);
+			queryY[i] = position(random);
+		}
+
+		// Answers by looping over every shape, like picking worked without an index.
+		auto bruteForce = [&](float left, float top, float right, float bottom, std::vector<ShapeHandle>& hits) {
+			const RectBatch batch = registry.Batch();
+
+			for (size_t i = 0; i < batch.count; ++i)
+				if (batch.pLeft[i] < right && batch.pRight[i] > left && batch.pTop[i] < bottom && batch.pBottom[i] > top)
+					hits.push_back(registry.Handle(i));
+		};
+
+		auto sortHits = [](std::vector<ShapeHandle>& hits) {
+			std::sort(hits.begin(), hits.end(), [](const ShapeHandle& a, const ShapeHandle& b) { return a.slot < b.slot; });
+		};
+
+		// Checks point and rect queries against the brute force answers.
+		auto matchesBruteForce = [&] {
+			std::vector<ShapeHandle> expected, hits;
+
+			for (size_t i = 0; i < S_CHECKED_QUERIES; ++i)
+			{
+				expected.clear();
+				hits.clear();
+				bruteForce(queryX[i], queryY[i], std::nextafter(queryX[i], S_WORLD_SIZE), std::nextafter(queryY[i], S_WORLD_SIZE), expected);
+				grid.QueryPoint(queryX[i], queryY[i], hits);
+
+				sortHits(expected);
+				sortHits(hits);
+				if (hits != expected)
+					return false;
+
+				expected.clear();
+				hits.clear();
+				bruteForce(queryX[i], queryY[i], queryX[i] + S_QUERY_RECT_SIZE, queryY[i] + S_QUERY_RECT_SIZE, expected);
+				grid.QueryRect(queryX[i], queryY[i], queryX[i] + S_QUERY_RECT_SIZE, queryY[i] + S_QUERY_RECT_SIZE, hits);
+
+				sortHits(expected);
+				sortHits(hits);
+				if (hits != expected)
+					return false;
+			}
+
+			return true;
+		};
+
+		std::vector<ShapeHandle> hits;
+		hits.reserve(S_SHAPE_COUNT);
+
+		size_t pointHits = 0;
+		const double pointMillis = TimeMillis(1, [&] {
+			pointHits = 0;
+			for (size_t i = 0; i < S_QUERIES; ++i)
+			{
+				hits.clear();
+				pointHits += grid.QueryPoint(queryX[i], queryY[i], hits);
+			}
+		});
+
+		// The mouse moves a few pixels between events, so hover queries keep landing in cells still in cache.
+		std::vector<float> pathX(S_QUERIES), pathY(S_QUERIES);
+		pathX[0] = pathY[0] = S_WORLD_SIZE / 2;
+		for (size_t i = 1; i < S_QUERIES; ++i)
+		{
+			pathX[i] = std::clamp(pathX[i - 1] + nudge(random), 0.0f, S_WORLD_SIZE);
+			pathY[i] = std::clamp(pathY[i - 1] + nudge(random), 0.0f, S_WORLD_SIZE);
+		}
+
+		const double hoverMillis = TimeMillis(1, [&] {
+			for (size_t i = 0; i < S_QUERIES; ++i)
+			{
+				hits.clear();
+				grid.QueryPoint(pathX[i], pathY[i], hits);
+			}
+		});
+
+		size_t rectHits = 0;
+		const double rectMillis = TimeMillis(1, [&] {
+			rectHits = 0;
+			for (size_t i = 0; i < S_QUERIES; ++i)
+			{
+				hits.clear();
+				rectHits += grid.QueryRect(queryX[i], queryY[i], queryX[i] + S_QUERY_RECT_SIZE, queryY[i] + S_QUERY_RECT_SIZE, hits);
+			}
+		});
+
+		const double bruteForceMillis = TimeMillis(1, [&] {
+			for (size_t i = 0; i < S_CHECKED_QUERIES; ++i)
+			{
+				hits.clear();
+				bruteForce(queryX[i], queryY[i], std::nextafter(queryX[i], S_WORLD_SIZE), std::nextafter(queryY[i], S_WORLD_SIZE), hits);
+			}
+		});
+
+		std::cout << S_SHAPE_COUNT << " shapes of 4 to 48 pixels over " << S_WORLD_SIZE << 'x' << S_WORLD_SIZE << ", " << grid.CellSize() << " pixel cells\n";
+		std::cout << "Point query, looping over every shape : " << (bruteForceMillis * 1000000.0 / S_CHECKED_QUERIES) << "ns\n";
+		std::cout << "Point query, random points : " << (pointMillis * 1000000.0 / S_QUERIES) << "ns (" << ((double)pointHits / S_QUERIES) << " hits on average)\n";
+		std::cout << "Point query, along a mouse path : " << (hoverMillis * 1000000.0 / S_QUERIES) << "ns\n";
+		std::cout << S_QUERY_RECT_SIZE << " pixel rect query : " << (rectMillis * 1000000.0 / S_QUERIES) << "ns (" << ((double)rectHits / S_QUERIES) << " hits on average)\n";
+		std::cout << "Matches looping over every shape : " << (Check(matchesBruteForce()) ? "yes" : "no") << '\n';
+
+		// Moving every shape by a few pixels, like dragging or animating them.
+		Timer::Timer timer;
+
+		const RectBatch batch = registry.Batch();
+		for (size_t i = 0; i < batch.count; ++i)
+		{
+			const float dx = nudge(random), dy = nudge(random);
+			const ShapeHandle handle = registry.Handle(i);
+			const float left = batch.pLeft[i] + dx, top = batch.pTop[i] + dy, right = batch.pRight[i] + dx, bottom = batch.pBottom[i] + dy;
+
+			registry.SetBounds(handle, left, top, right, bottom);
+			grid.Update(handle, left, top, right, bottom);
+		}
+
+		const double moveMillis = timer.ElapsedMillis();
+
+		std::cout << "Moving every shape : " << moveMillis << "ms (" << (moveMillis * 1000000.0 / S_SHAPE_COUNT) << "ns per shape, registry included)\n";
+		std::cout << "Matches looping over every shape after moving : " << (Check(matchesBruteForce()) ? "yes" : "no") << '\n';
+	}
+}
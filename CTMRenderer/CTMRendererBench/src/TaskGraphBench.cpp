@@ -0,0 +1,63 @@
+#include "Bench.hpp"
+
+#include "Threading/TaskGraph.hpp"
+
+#include <iostream>
+#include <thread>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		void Stub(double millis)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(millis));
+		}
+
+		// Mirrors the shape of DXRenderer's startup graph with stub costs.
+		void AddStartupShape(CTMRenderer::Threading::TaskGraph& graph)
+		{
+			using namespace CTMRenderer::Threading;
+
+			const TaskID window = graph.Add("DXWindow::Start", [] { Stub(8.0); }, {}, TaskAffinity::CALLER);
+			const TaskID shaders = graph.Add("LoadTestShaders", [] { Stub(6.0); });
+			const TaskID textFormat = graph.Add("InitTextFormat", [] { Stub(12.0); });
+			const TaskID sceneData = graph.Add("BuildTestScene", [] { Stub(2.0); });
+			const TaskID device = graph.Add("InitDevice", [] { Stub(20.0); }, { window }, TaskAffinity::CALLER);
+			const TaskID init2D = graph.Add("Init2D", [] { Stub(4.0); }, { device }, TaskAffinity::CALLER);
+			graph.Add("InitTextBrush", [] { Stub(1.0); }, { init2D, textFormat }, TaskAffinity::CALLER);
+			graph.Add("InitTestScene", [] { Stub(3.0); }, { device, shaders, sceneData }, TaskAffinity::CALLER);
+		}
+	}
+
+	void BenchTaskGraph()
+	{
+		using namespace CTMRenderer::Threading;
+
+		WorkerPool pool;
+		std::cout << "Workers : " << pool.ThreadCount() << '\n';
+
+		// Scheduling overhead with empty tasks, fanned out and joined.
+		constexpr unsigned int fanOut = 256;
+		const double overheadMillis = TimeMillis(100, [&pool] {
+			TaskGraph graph;
+			const TaskID root = graph.Add("Root", [] {});
+			for (unsigned int i = 0; i < fanOut; ++i)
+				graph.Add("Leaf", [] {}, { root });
+			graph.Run(pool);
+		});
+		std::cout << "Empty task overhead : " << (overheadMillis * 1000.0) / (fanOut + 1) << "us per task\n";
+
+		// Startup-shaped graph, compared against the sum of its tasks. (What running them serially costs)
+		TaskGraph startup;
+		AddStartupShape(startup);
+		startup.Run(pool);
+
+		double serialMillis = 0.0;
+		for (const TaskRecord& record : startup.Timeline())
+			serialMillis += record.endMillis - record.startMillis;
+
+		std::cout << "Startup graph : " << startup.TotalMillis() << "ms (serial : " << serialMillis << "ms)\n";
+		startup.PrintTimeline(std::cout);
+	}
+}
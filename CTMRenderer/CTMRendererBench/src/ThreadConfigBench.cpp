@@ -0,0 +1,63 @@
+#include "Bench.hpp"
+
+#include "Threading/ThreadConfig.hpp"
+
+#include <climits>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	namespace
+	{
+		constexpr unsigned int S_MAX_CORE = 1023; // What a default cpu_set_t holds.
+
+		void CheckParsedAs(std::string_view list, unsigned int maxCore, const std::vector<unsigned int>& expected)
+		{
+			const std::vector<unsigned int> cores = CTMRenderer::Threading::ParseCpuList(list, maxCore);
+
+			std::cout << "  \"" << list << "\" : " << cores.size() << " core(s)" << (cores.empty() ? "" : ", ");
+			if (!cores.empty())
+				std::cout << cores.front() << " to " << cores.back();
+			std::cout << " : " << (Check(cores == expected) ? "yes" : "no") << '\n';
+		}
+	}
+
+	void BenchThreadConfig()
+	{
+		using namespace CTMRenderer::Threading;
+
+		std::cout << "Cpu lists, capped at core " << S_MAX_CORE << ", parsed as expected\n";
+		CheckParsedAs("0-3,64-67", S_MAX_CORE, { 0, 1, 2, 3, 64, 65, 66, 67 });
+		CheckParsedAs("a", S_MAX_CORE, {});
+		CheckParsedAs("3-", S_MAX_CORE, {});
+		CheckParsedAs(",", S_MAX_CORE, {});
+		CheckParsedAs("0-1,a,3-,,5", S_MAX_CORE, { 0, 1, 5 });
+		CheckParsedAs("1020-4294967295", S_MAX_CORE, { 1020, 1021, 1022, 1023 });
+		CheckParsedAs("4294967295", S_MAX_CORE, {});
+
+		std::cout << "Cpu lists, uncapped, parsed as expected\n";
+		CheckParsedAs("4294967293-4294967295", UINT_MAX, { 4294967293u, 4294967294u, UINT_MAX });
+
+		// A directory that doesn't exist stands for a machine without /sys/devices/system/node.
+		const std::filesystem::path nodeDirectory = std::filesystem::temp_directory_path() / "CTMRendererBenchNodes";
+		std::error_code error;
+		std::filesystem::remove_all(nodeDirectory, error);
+
+		const unsigned int systemNodes = NumaNodeCount();
+		const unsigned int missingNodes = NumaNodeCount(nodeDirectory);
+
+		std::filesystem::create_directories(nodeDirectory / "node0", error);
+		std::filesystem::create_directories(nodeDirectory / "node1", error);
+
+		const unsigned int twoNodes = NumaNodeCount(nodeDirectory);
+		std::filesystem::remove_all(nodeDirectory, error);
+
+		std::cout << "NUMA nodes : " << systemNodes << ", " << missingNodes << " without a node directory, " << twoNodes << " with node0 and node1\n";
+		std::cout << "  At least 1 on this machine : " << (Check(systemNodes >= 1) ? "yes" : "no") << '\n';
+		std::cout << "  1 without a node directory : " << (Check(missingNodes == 1) ? "yes" : "no") << '\n';
+		std::cout << "  Counts every node entry : " << (Check(twoNodes == 2) ? "yes" : "no") << '\n';
+	}
+}
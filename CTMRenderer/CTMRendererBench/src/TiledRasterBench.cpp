@@ -0,0 +1,75 @@
+#include "Bench.hpp"
+
+#include "CTMRenderer/Software/SWTiledRasterizer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTMRendererBench
+{
+	void BenchTiledRaster()
+	{
+		using namespace CTMRenderer;
+		using namespace CTMRenderer::CTMSoftware;
+
+		constexpr unsigned int S_WIDTH = 1920, S_HEIGHT = 1080;
+		constexpr size_t S_RECT_COUNT = 100000;
+		constexpr unsigned int S_ITERATIONS = 20;
+
+		const CTMDirectX::Window::Geometry::WindowArea screenArea(S_WIDTH, S_HEIGHT);
+		SWRasterizer rasterizer(screenArea);
+		rasterizer.SetBaseQuad(CTMDirectX::Graphics::Geometry::DXAABB(0, 0, 1, 1));
+
+		// Rects of 4 to 64 pixels, like a dense dashboard. The base quad is a unit square, so scalars are sizes.
+		std::mt19937 random(1738u);
+		std::uniform_real_distribution<float> position(-32.0f, (float)S_WIDTH);
+		std::uniform_real_distribution<float> size(4.0f, 64.0f);
+		std::uniform_int_distribution<int> channel(0, 255);
+
+		std::vector<CTMDirectX::Graphics::InstanceData> instances(S_RECT_COUNT);
+		for (CTMDirectX::Graphics::InstanceData& instance : instances)
+		{
+			instance.scalarXY = { size(random), size(random) };
+			instance.offsetXY = { position(random), position(random) * S_HEIGHT / S_WIDTH };
+			instance.color = CTMDirectX::Graphics::DXColor((unsigned char)channel(random), (unsigned char)channel(random), (unsigned char)channel(random), 255);
+		}
+
+		const uint32_t clearBgra = PackBGRA8(0, 0, 26, 255);
+
+		SWFramebuffer reference(S_WIDTH, S_HEIGHT);
+		const double referenceMillis = TimeMillis(S_ITERATIONS, [&] {
+			reference.Clear(clearBgra);
+			rasterizer.DrawInstances(reference, instances.data(), instances.size());
+		});
+
+		std::cout << S_RECT_COUNT << " rects at " << S_WIDTH << 'x' << S_HEIGHT << '\n';
+		std::cout << "Single-threaded : " << referenceMillis << "ms\n";
+
+		const unsigned int maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+		for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+		{
+			Threading::WorkerPool pool(threads);
+
+			SWTiledRasterizer tiled(rasterizer);
+			SWFramebuffer target(S_WIDTH, S_HEIGHT);
+
+			const double millis = TimeMillis(S_ITERATIONS, [&] {
+				tiled.Draw(pool, target, clearBgra, instances.data(), instances.size());
+			});
+
+			bool isIdentical = true;
+			for (unsigned int y = 0; y < S_HEIGHT && isIdentical; ++y)
+				isIdentical = std::memcmp(target.Row(y), reference.Row(y), S_WIDTH * sizeof(uint32_t)) == 0;
+
+			const SWTiledStats& stats = tiled.Stats();
+
+			std::cout << "Tiled, " << threads << " worker(s) + caller : " << millis << "ms (" << (referenceMillis / millis) << "x, bin "
+				<< stats.binMillis << "ms, raster " << stats.rasterMillis << "ms, " << stats.binnedRects << " binned, "
+				<< stats.occludedRects << " occluded)" << (Check(isIdentical) ? "" : " MISMATCH") << '\n';
+		}
+	}
+}
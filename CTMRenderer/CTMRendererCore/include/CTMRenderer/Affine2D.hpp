@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace CTMRenderer
+{
+	/* A 2D affine transform, laid out like D2D1_MATRIX_3X2_F : points are row vectors, so
+	 * x' = x * m11 + y * m21 + dx and y' = x * m12 + y * m22 + dy. */
+	struct Affine2D
+	{
+		float m11 = 1, m12 = 0;
+		float m21 = 0, m22 = 1;
+		float dx = 0, dy = 0;
+
+		[[nodiscard]] static inline Affine2D Translation(float x, float y) noexcept { return { 1, 0, 0, 1, x, y }; }
+		[[nodiscard]] static inline Affine2D Scale(float x, float y) noexcept { return { x, 0, 0, y, 0, 0 }; }
+
+		// Clockwise on screen, since Y points down.
+		[[nodiscard]] static inline Affine2D Rotation(float radians) noexcept
+		{
+			const float sin = std::sin(radians), cos = std::cos(radians);
+			return { cos, sin, -sin, cos, 0, 0 };
+		}
+
+		[[nodiscard]] bool operator==(const Affine2D&) const noexcept = default;
+	};
+
+	// Returns the transform applying local first, then parent.
+	[[nodiscard]] inline Affine2D Combine(const Affine2D& parent, const Affine2D& local) noexcept
+	{
+		return {
+			local.m11 * parent.m11 + local.m12 * parent.m21, local.m11 * parent.m12 + local.m12 * parent.m22,
+			local.m21 * parent.m11 + local.m22 * parent.m21, local.m21 * parent.m12 + local.m22 * parent.m22,
+			local.dx * parent.m11 + local.dy * parent.m21 + parent.dx, local.dx * parent.m12 + local.dy * parent.m22 + parent.dy
+		};
+	}
+
+	inline void TransformPoint(const Affine2D& transform, float x, float y, float& outX, float& outY) noexcept
+	{
+		outX = x * transform.m11 + y * transform.m21 + transform.dx;
+		outY = x * transform.m12 + y * transform.m22 + transform.dy;
+	}
+
+	// Returns the axis-aligned bounds of a transformed rect, in place.
+	inline void TransformBounds(const Affine2D& transform, float& left, float& top, float& right, float& bottom) noexcept
+	{
+		// Each output edge takes, per input axis, whichever end the matrix sends furthest that way.
+		const float x0 = left * transform.m11, x1 = right * transform.m11;
+		const float y0 = top * transform.m21, y1 = bottom * transform.m21;
+		const float u0 = left * transform.m12, u1 = right * transform.m12;
+		const float v0 = top * transform.m22, v1 = bottom * transform.m22;
+
+		left = std::min(x0, x1) + std::min(y0, y1) + transform.dx;
+		right = std::max(x0, x1) + std::max(y0, y1) + transform.dx;
+		top = std::min(u0, u1) + std::min(v0, v1) + transform.dy;
+		bottom = std::max(u0, u1) + std::max(v0, v1) + transform.dy;
+	}
+}
@@ -4,6 +4,8 @@
 
 #include "Core/CoreMacros.hpp"
 #include "CTMRenderer/IRenderer.hpp"
+#include "CTMRenderer/Null/NullRenderer.hpp"
+#include "CTMRenderer/Software/SWRenderer.hpp"
 
 #ifdef CTM_NO_DX
 #else
@@ -22,7 +24,7 @@ namespace CTMRenderer
 	class CTMRenderer
 	{
 	public:
-		CTMRenderer(RendererType rendererType, unsigned int targetFPS = 60) noexcept
+		CTMRenderer(RendererType rendererType, unsigned int targetFPS = 60, const Threading::ThreadTopology& threadTopology = {}) noexcept
 		{
 			if (rendererType == RendererType::CTM_DIRECTX)
 			{
@@ -31,15 +33,29 @@ namespace CTMRenderer
 				#else
 					DEBUG_PRINT("Creating Renderer with DirectX.\n");
 
-					m_Renderer = std::make_unique<CTMDirectX::DXRenderer>(targetFPS);
+					m_Renderer = std::make_unique<CTMDirectX::DXRenderer>(CTMDirectX::DXRendererSettings(targetFPS, threadTopology));
 				#endif
 			}
+			else if (rendererType == RendererType::CTM_NULL)
+			{
+				DEBUG_PRINT("Creating headless Renderer.\n");
+
+				m_Renderer = std::make_unique<CTMNull::NullRenderer>(CTMNull::NullRendererSettings(targetFPS, threadTopology));
+			}
+			else if (rendererType == RendererType::CTM_SOFTWARE)
+			{
+				DEBUG_PRINT("Creating Renderer with the software rasterizer.\n");
+
+				m_Renderer = std::make_unique<CTMSoftware::SWRenderer>(CTMSoftware::SWRendererSettings(targetFPS, threadTopology));
+			}
 			else
 				RUNTIME_ASSERT(false, "Failed to initialize CTMRenderer due to the provided renderType being unknown.\n");
 		}
 
 		void Start() noexcept;
 		void JoinForShutdown() noexcept;
+
+		[[nodiscard]] inline IRenderer& Renderer() noexcept { return *m_Renderer; }
 	private:
 		std::unique_ptr<IRenderer> m_Renderer;
 	};
@@ -0,0 +1,62 @@
+#pragma once
+
+namespace CTMRenderer
+{
+	// An axis aligned rect in world units.
+	struct WorldRect
+	{
+		double left = 0, top = 0, right = 0, bottom = 0;
+
+		[[nodiscard]] inline bool Intersects(const WorldRect& other) const noexcept { return left < other.right && right > other.left && top < other.bottom && bottom > other.top; }
+	};
+
+	/* A pan and zoom view onto a world in double precision, mapping it to the screen pixels the renderers take.
+	 *
+	 * Floats can't address a large world finely : past 2^24 units, they can't even tell neighbouring units apart.
+	 * The camera keeps its position in doubles and rebases world positions to its own origin, the world point at the
+	 * top left of the viewport, before converting them to float. Submitted positions are then relative to the screen,
+	 * small and precise, however far from the world's origin the camera is. */
+	class Camera2D
+	{
+	public:
+		Camera2D(float viewportWidth, float viewportHeight) noexcept;
+		~Camera2D() = default;
+	public:
+		void SetViewport(float viewportWidth, float viewportHeight) noexcept;
+
+		// Centers the viewport on a world point.
+		void SetCenter(double x, double y) noexcept;
+
+		// Pixels per world unit, clamped to [S_MIN_ZOOM, S_MAX_ZOOM].
+		void SetZoom(double zoom) noexcept;
+
+		// Moves the content by a number of pixels, like dragging it.
+		void Pan(float dxPixels, float dyPixels) noexcept;
+
+		// Multiplies the zoom, keeping the world point under a screen point in place, like zooming at the mouse.
+		void ZoomAt(double factor, float screenX, float screenY) noexcept;
+
+		// The world area the viewport shows.
+		[[nodiscard]] WorldRect View() const noexcept;
+
+		void WorldToScreen(double worldX, double worldY, float& screenX, float& screenY) const noexcept;
+		void ScreenToWorld(float screenX, float screenY, double& worldX, double& worldY) const noexcept;
+	public:
+		[[nodiscard]] inline double CenterX() const noexcept { return m_CenterX; }
+		[[nodiscard]] inline double CenterY() const noexcept { return m_CenterY; }
+		[[nodiscard]] inline double Zoom() const noexcept { return m_Zoom; }
+		[[nodiscard]] inline float ViewportWidth() const noexcept { return m_ViewportWidth; }
+		[[nodiscard]] inline float ViewportHeight() const noexcept { return m_ViewportHeight; }
+
+		// World point at the top left of the viewport, which world positions are rebased to.
+		[[nodiscard]] inline double OriginX() const noexcept { return m_CenterX - m_ViewportWidth * 0.5 / m_Zoom; }
+		[[nodiscard]] inline double OriginY() const noexcept { return m_CenterY - m_ViewportHeight * 0.5 / m_Zoom; }
+	public:
+		static constexpr double S_MIN_ZOOM = 1e-9;
+		static constexpr double S_MAX_ZOOM = 1e9;
+	private:
+		double m_CenterX = 0, m_CenterY = 0;
+		double m_Zoom = 1;
+		float m_ViewportWidth = 0, m_ViewportHeight = 0;
+	};
+}
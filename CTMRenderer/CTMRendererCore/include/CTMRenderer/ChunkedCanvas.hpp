@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/Camera2D.hpp"
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/RectLod.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	// A run of spatially close rects of a ChunkedCanvas, with their bounds.
+	struct CanvasChunk
+	{
+		WorldRect bounds;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+
+	// Work of the last ChunkedCanvas submission.
+	struct CanvasStats
+	{
+		size_t visibleChunks = 0;
+		size_t submittedRects = 0; // Rects of the visible chunks, some of them possibly just outside the view.
+	};
+
+	/* Stores a large world of rects in double precision, partitioned into chunks whose bounds are computed once,
+	 * so a view only costs the chunks it intersects.
+	 *
+	 * Rects are added, then Build sorts them along a Z order curve over the area they cover, and cuts the sorted run
+	 * into chunks of at most ChunkCapacity rects. Neighbouring rects end up in the same chunk, keeping chunk bounds tight.
+	 * Within a chunk, rects stay in the order they were added. Build only partitions the rects added since the last one,
+	 * so content can be loaded in batches.
+	 *
+	 * Submitting a view tests every chunk's bounds against it, then rebases the rects of the visible chunks to the camera
+	 * and builds their instances. Chunks are only culled as a whole : rects of a visible chunk are all submitted.
+	 * The visible rects are sorted back into add order before being rebased, so overlapping rects are drawn in the order
+	 * they were added, whichever chunks they landed in. */
+	class ChunkedCanvas
+	{
+	public:
+		ChunkedCanvas(uint32_t chunkCapacity = 4096) noexcept;
+		~ChunkedCanvas() = default;
+	public:
+		// Rects must not be empty, and aren't part of the canvas until the next Build.
+		void Add(double left, double top, double right, double bottom, const CTMDirectX::Graphics::DXColor& color) noexcept;
+		void Reserve(size_t count) noexcept;
+
+		// Partitions the rects added since the last call into chunks.
+		void Build() noexcept;
+
+		// Removes every rect, built or not.
+		void Clear() noexcept;
+
+		// Replaces visibleChunks with the indices of the chunks intersecting the camera's view.
+		void Cull(const Camera2D& camera, std::vector<uint32_t>& visibleChunks) const noexcept;
+
+		/* Replaces instances with those of the rects of every chunk intersecting the camera's view, in screen pixels
+		 * relative to the viewport's top left corner, placing baseQuad like BuildInstances does. Returns their count. */
+		size_t Submit(const Camera2D& camera, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+
+		// Same as above, passing the rects through a level of detail pass over the viewport, so rects too small to be seen
+		// are aggregated into cells.
+		size_t Submit(const Camera2D& camera, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, RectLod& lod, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+	public:
+		// Built rects.
+		[[nodiscard]] inline size_t Size() const noexcept { return m_Colors.size(); }
+		[[nodiscard]] inline const std::vector<CanvasChunk>& Chunks() const noexcept { return m_Chunks; }
+		[[nodiscard]] inline uint32_t ChunkCapacity() const noexcept { return m_ChunkCapacity; }
+		[[nodiscard]] inline const CanvasStats& Stats() const noexcept { return m_Stats; }
+
+		// Columns of the built rects, in chunk order, then add order within each chunk.
+		[[nodiscard]] inline const double* Lefts() const noexcept { return m_Lefts.data(); }
+		[[nodiscard]] inline const double* Tops() const noexcept { return m_Tops.data(); }
+		[[nodiscard]] inline const double* Rights() const noexcept { return m_Rights.data(); }
+		[[nodiscard]] inline const double* Bottoms() const noexcept { return m_Bottoms.data(); }
+		[[nodiscard]] inline const CTMDirectX::Graphics::DXColor* Colors() const noexcept { return m_Colors.data(); }
+
+		// Position of each built rect among every rect added since the last Clear, which is the order instances are submitted in.
+		[[nodiscard]] inline const uint32_t* Sequences() const noexcept { return m_Sequences.data(); }
+	private:
+		// Culls, then lists the visible chunks' rects in add order.
+		void SortVisible(const Camera2D& camera) noexcept;
+
+		// Rebases the next ChunkCapacity visible rects, in add order, to the camera's origin into the screen columns.
+		// Returns an empty batch once every visible rect was rebased.
+		[[nodiscard]] RectBatch RebaseNext(double originX, double originY, double zoom) noexcept;
+	private:
+		uint32_t m_ChunkCapacity = 0;
+
+		// Rects added since the last Build.
+		std::vector<double> m_PendingLefts, m_PendingTops, m_PendingRights, m_PendingBottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_PendingColors;
+
+		std::vector<double> m_Lefts, m_Tops, m_Rights, m_Bottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_Colors;
+		std::vector<uint32_t> m_Sequences;
+		std::vector<CanvasChunk> m_Chunks;
+
+		// Rebased rects of the visible chunks, reused across submissions.
+		std::vector<float> m_ScreenLefts, m_ScreenTops, m_ScreenRights, m_ScreenBottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_ScreenColors;
+		std::vector<uint32_t> m_VisibleChunks;
+		std::vector<uint64_t> m_VisibleRects; // Sequence in the high half, rect in the low half.
+		std::vector<uint64_t> m_SortScratch;
+		size_t m_NextVisibleRect = 0;
+
+		CanvasStats m_Stats;
+	};
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	// A clip rect in screen pixels. Pixels whose centers lie in [left, right) x [top, bottom) are kept, like rects cover them.
+	struct ClipRect
+	{
+		float left = 0, top = 0, right = 0, bottom = 0;
+
+		[[nodiscard]] inline bool IsEmpty() const noexcept { return !(right > left && bottom > top); }
+	};
+
+	// Rows of a list visible through a clip rect, [first, end).
+	struct ClipRowRange
+	{
+		size_t first = 0;
+		size_t end = 0;
+	};
+
+	// Work of a ClipStack since the last Clear.
+	struct ClipStats
+	{
+		size_t keptRects = 0;      // Inside the clip rect.
+		size_t trimmedRects = 0;   // Partially clipped, trimmed to the clip rect.
+		size_t discardedRects = 0; // Fully clipped.
+		size_t keptShapes = 0;
+		size_t scissoredShapes = 0; // Partially clipped, kept whole for the scissor to cut.
+		size_t discardedShapes = 0;
+	};
+
+	/* Clip rects of nested panels : each pushed rect is intersected with the current one, so content is clipped by
+	 * every panel it's in. The stack starts with, and never pops, the root clip rect. (e.g. the viewport)
+	 *
+	 * Content is clipped on the CPU as it's built, so fully clipped content never becomes instances. Rects are axis
+	 * aligned, and trimming one to the clip rect covers exactly the pixels a scissor would keep, so rect batches never
+	 * need scissoring. Analytic shapes are antialiased and may be rounded, so trimming would change them : partially
+	 * clipped shapes are kept whole, and the batch is flagged for scissoring.
+	 *
+	 * Lists of evenly spaced rows, like scrolling lists, can skip their hidden rows without looking at them through
+	 * VisibleRows, so thousands of rows scrolled out of view cost nothing. */
+	class ClipStack
+	{
+	public:
+		ClipStack(const ClipRect& root) noexcept;
+		~ClipStack() = default;
+	public:
+		// Clips by the rect within the current clip rect, until the matching Pop.
+		void Push(const ClipRect& clip) noexcept;
+		void Push(float left, float top, float right, float bottom) noexcept;
+		void Pop() noexcept;
+
+		// Pops everything but the root, which is replaced, and resets the stats. (e.g. at the start of a frame)
+		void Clear(const ClipRect& root) noexcept;
+
+		// Appends the instances of the batch's rects clipped to the current clip rect, placing baseQuad like BuildInstances
+		// does. Fully clipped rects are discarded and partially clipped ones trimmed. Returns the count appended.
+		size_t Build(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+
+		/* Appends the shapes not fully clipped by the current clip rect, in order. Returns true if some appended shape is
+		 * partially clipped, so the batch must be drawn with the current clip rect as its scissor rect. */
+		bool Build(const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count, std::vector<CTMDirectX::Graphics::ShapeInstanceData>& shapes) noexcept;
+
+		// Rows of a list whose first row's top is at firstTop, rows being rowHeight apart, that may be visible.
+		[[nodiscard]] ClipRowRange VisibleRows(float firstTop, float rowHeight, size_t rowCount) const noexcept;
+	public:
+		[[nodiscard]] inline const ClipRect& Current() const noexcept { return m_Clips.back(); }
+		[[nodiscard]] inline size_t Depth() const noexcept { return m_Clips.size() - 1; } // Rects pushed on top of the root.
+		[[nodiscard]] inline const ClipStats& Stats() const noexcept { return m_Stats; }
+	private:
+		std::vector<ClipRect> m_Clips;
+
+		// Trimmed rects of a batch, for BuildInstances.
+		std::vector<float> m_Lefts, m_Tops, m_Rights, m_Bottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_Colors;
+
+		ClipStats m_Stats;
+	};
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	// A half-open pixel rectangle. [left, right) x [top, bottom) Directly usable as a scissor rect.
+	struct DamageRect
+	{
+		int left = 0, top = 0, right = 0, bottom = 0;
+
+		[[nodiscard]] inline bool IsEmpty() const noexcept { return right <= left || bottom <= top; }
+		// Sides are taken in 64 bits, as a rect clamped far off screen spans more than an int holds.
+		[[nodiscard]] inline uint64_t Area() const noexcept { return IsEmpty() ? 0 : (uint64_t)((int64_t)right - left) * (uint64_t)((int64_t)bottom - top); }
+	};
+
+	struct DamageSettings
+	{
+		// Above this fraction of the target damaged, redrawing everything is cheaper than scissoring.
+		float FullRedrawCoverage = 0.5f;
+
+		// Damage is merged down to at most this many rects, least added area first. (Every rect costs a clear and a draw)
+		unsigned int MaxRects = 64;
+
+		// Oldest buffer content repairable from history. (e.g. the buffer count of a flip model swap chain or framebuffer ring)
+		unsigned int MaxBufferAge = 4;
+	};
+
+	// What a frame must redraw. Rects are disjoint and within the target.
+	struct DamageRegion
+	{
+		std::vector<DamageRect> rects;
+		bool isFull = false; // Redraw everything, ignoring rects.
+		uint64_t pixels = 0; // Pixels to redraw.
+	};
+
+	/* Accumulates the screen regions shape mutations touch, so a frame only clears and redraws those.
+	 *
+	 * Mutations add the bounds they touch, rounded out to whole pixels. Overlapping rects are merged as they come in,
+	 * keeping rects disjoint, and past MaxRects the pair wasting the least area is merged.
+	 * Resolve turns a frame's damage into a region, falling back to a full redraw above FullRedrawCoverage.
+	 *
+	 * A target whose content is several frames old (bufferAge) also needs the damage of the frames it missed,
+	 * so the last MaxBufferAge frames of damage are kept. */
+	class DamageTracker
+	{
+	public:
+		DamageTracker(const DamageSettings& settings = {}) noexcept;
+		~DamageTracker() = default;
+	public:
+		// Damages a region. (e.g. a shape appearing, disappearing or changing color)
+		void Add(float left, float top, float right, float bottom) noexcept;
+		void Add(const CTMDirectX::Graphics::Geometry::DXAABB& aabb) noexcept;
+
+		// Damages what a shape moving from one set of bounds to another touches : the union of both when they overlap,
+		// or each on its own when they don't, so a shape jumping across the screen doesn't damage everything in between.
+		void AddChange(float oldLeft, float oldTop, float oldRight, float oldBottom, float newLeft, float newTop, float newRight, float newBottom) noexcept;
+
+		// Damages everything. (e.g. after a resize, or a clear color change)
+		void AddFull() noexcept;
+
+		/* Ends the frame, returning what a target of width x height must redraw when its content is bufferAge frames old.
+		 * 1 is the previous frame's content, the usual case for a single target. 0 means unknown content, redrawn fully.
+		 * The region stays valid until the next call. */
+		const DamageRegion& Resolve(unsigned int width, unsigned int height, unsigned int bufferAge = 1) noexcept;
+
+		// Forgets the history and damages everything, for targets whose content was lost. (Also the state after construction)
+		void Invalidate() noexcept;
+	public:
+		[[nodiscard]] inline bool HasDamage() const noexcept { return m_Pending.isFull || !m_Pending.rects.empty(); }
+		[[nodiscard]] inline const DamageSettings& Settings() const noexcept { return m_Settings; }
+	private:
+		struct FrameDamage
+		{
+			std::vector<DamageRect> rects;
+			bool isFull = false;
+		};
+	private:
+		// Adds rect to rects, merging it with every rect it overlaps, then merging pairs down to MaxRects.
+		void Insert(std::vector<DamageRect>& rects, DamageRect rect) const noexcept;
+	private:
+		DamageSettings m_Settings;
+		FrameDamage m_Pending;
+		std::deque<FrameDamage> m_History; // Most recent frame first.
+		DamageRegion m_Region;
+	};
+}
@@ -4,27 +4,32 @@
 #include "CTMRenderer/DirectX/DXRendererSettings.hpp"
 #include "CTMRenderer/DirectX/Window/DXWindow.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXGraphics.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXSharedResources.hpp"
 
 namespace CTMRenderer::CTMDirectX
 {
 	class DXRenderer : public IRenderer
 	{
 	public:
-		explicit DXRenderer(const unsigned int targetFPS);
+		explicit DXRenderer(const DXRendererSettings& settings);
+
+		// Hosted renderer, sharing the worker pool and resources of a RendererHost.
+		DXRenderer(const DXRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool, Graphics::DXSharedResources& sharedResourcesRef);
 		~DXRenderer() = default;
 	public:
-		virtual void Start() noexcept override;
-		virtual void JoinForShutdown() noexcept override;
+		virtual void Step(double elapsedMillis) noexcept override;
+		virtual void Detach() noexcept override;
+		[[nodiscard]] inline virtual unsigned int TargetFPS() const noexcept override { return m_Settings.TargetFPS; }
+	protected:
+		virtual void OnStart(const Event::StartEvent* pStartEvent) noexcept override;
+		virtual void OnEnd(const Event::EndEvent* pEndEvent) noexcept override;
+		virtual void OnMouseMove(const Event::MouseMoveEvent* pMouseMoveEvent) noexcept override;
 	private:
-		void OnStart(const Event::StartEvent* pEvent) noexcept;
-		void OnEnd(const Event::EndEvent* pEvent) noexcept;
-		void EventLoop() noexcept;
 		void DoFrame(double elapsedMillis) noexcept;
-		void HandleEvent(Event::IEvent* pEvent) noexcept;
-		void HandleStateEvent(Event::IEvent* pEvent) noexcept;
-		void HandleMouseEvent(Event::IEvent* pEvent) noexcept;
 	private:
 		DXRendererSettings m_Settings;
+		std::unique_ptr<Graphics::DXSharedResources> m_OwnedSharedResources; // nullptr when hosted.
+		Graphics::DXSharedResources& m_SharedResourcesRef;
 		Window::DXWindow m_Window;
 		Graphics::DXGraphics m_Graphics;
 	private:
@@ -33,4 +38,4 @@ namespace CTMRenderer::CTMDirectX
 		DXRenderer& operator=(const DXRenderer&) = delete;
 		DXRenderer& operator=(DXRenderer&&) = delete;
 	};
-}
\ No newline at end of file
+}
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <string>
+
+#include "Threading/ThreadConfig.hpp"
+
 namespace CTMRenderer::CTMDirectX
 {
 	struct DXRendererSettings
 	{
-		inline DXRendererSettings(unsigned int targetFPS)
-			: TargetFPS(targetFPS) {}
+		inline DXRendererSettings(unsigned int targetFPS, const Threading::ThreadTopology& threads = {})
+			: TargetFPS(targetFPS), Threads(threads) {}
 
 		unsigned int TargetFPS;
+		Threading::ThreadTopology Threads; // Names, cores and priorities of the event thread and the worker pool.
+
+		// Text drawn over the test scene. Empty never initializes Direct2D and DirectWrite.
+		std::wstring TestText = L"Hello World!!!";
 	};
 }
\ No newline at end of file
@@ -12,6 +12,16 @@
 
 namespace CTMRenderer::CTMDirectX::Graphics
 {
+	// Reads compiled shader bytecode (.cso) from disk. Touches no device state, so it's safe to call from any thread.
+	inline [[nodiscard]] HRESULT ReadShaderBlob(const std::filesystem::path& shaderPath, Microsoft::WRL::ComPtr<ID3DBlob>& pReadBlob) noexcept
+	{
+		RUNTIME_ASSERT(std::filesystem::exists(shaderPath), "Path doesn't exist : " << shaderPath << '\n');
+		RUNTIME_ASSERT(shaderPath.extension() == ".cso", "Shader file must be in shader bytecode format of .cso : " << shaderPath.extension() << '\n');
+
+		std::wstring wPath = shaderPath.wstring();
+		return D3DReadFileToBlob(wPath.c_str(), &pReadBlob);
+	}
+
 	class DXPixelShader
 	{
 	public:
@@ -24,16 +34,23 @@ namespace CTMRenderer::CTMDirectX::Graphics
 	public:
 		inline [[nodiscard]] HRESULT Create(const std::filesystem::path& shaderPath, Microsoft::WRL::ComPtr<ID3DBlob>& pReadBlob) noexcept
 		{
-			RUNTIME_ASSERT(!m_IsCreated, "A shader shouldn't be re-created.\n");
-			RUNTIME_ASSERT(std::filesystem::exists(shaderPath), "Path doesn't exist : " << shaderPath << '\n');
-			RUNTIME_ASSERT(shaderPath.extension() == ".cso", "Shader file must be in shader bytecode format of .cso : " << shaderPath.extension() << '\n');
+			HRESULT hResult = ReadShaderBlob(shaderPath, pReadBlob);
 
-			std::wstring wPath = shaderPath.wstring();
-			D3DReadFileToBlob(wPath.c_str(), &pReadBlob);
+			if (hResult != S_OK)
+				return hResult;
+
+			return Create(pReadBlob);
+		}
+
+		// Creates the shader from already read bytecode.
+		inline [[nodiscard]] HRESULT Create(const Microsoft::WRL::ComPtr<ID3DBlob>& pBlob) noexcept
+		{
+			RUNTIME_ASSERT(!m_IsCreated, "A shader shouldn't be re-created.\n");
+			RUNTIME_ASSERT(pBlob != nullptr, "Shader bytecode is nullptr.\n");
 
 			m_IsCreated = true;
 
-			return mP_Device->CreatePixelShader(pReadBlob->GetBufferPointer(), pReadBlob->GetBufferSize(), nullptr, mP_PixelShader.GetAddressOf());
+			return mP_Device->CreatePixelShader(pBlob->GetBufferPointer(), pBlob->GetBufferSize(), nullptr, mP_PixelShader.GetAddressOf());
 		}
 
 		inline void Bind() noexcept
@@ -61,15 +78,22 @@ namespace CTMRenderer::CTMDirectX::Graphics
 	public:
 		inline [[nodiscard]] HRESULT Create(const std::filesystem::path& shaderPath, Microsoft::WRL::ComPtr<ID3DBlob>& pReadBlob) noexcept
 		{
-			RUNTIME_ASSERT(!m_Created, "A shader shouldn't be re-created.\n");
-			RUNTIME_ASSERT(std::filesystem::exists(shaderPath), "Path doesn't exist : " << shaderPath << '\n');
-			RUNTIME_ASSERT(shaderPath.extension() == ".cso", "Shader file must be in shader bytecode format of .cso : " << shaderPath.extension() << '\n');
+			HRESULT hResult = ReadShaderBlob(shaderPath, pReadBlob);
 
-			std::wstring wPath = shaderPath.wstring();
-			D3DReadFileToBlob(wPath.c_str(), &pReadBlob);
+			if (hResult != S_OK)
+				return hResult;
+
+			return Create(pReadBlob);
+		}
+
+		// Creates the shader from already read bytecode.
+		inline [[nodiscard]] HRESULT Create(const Microsoft::WRL::ComPtr<ID3DBlob>& pBlob) noexcept
+		{
+			RUNTIME_ASSERT(!m_Created, "A shader shouldn't be re-created.\n");
+			RUNTIME_ASSERT(pBlob != nullptr, "Shader bytecode is nullptr.\n");
 
 			m_Created = true;
-			return mP_Device->CreateVertexShader(pReadBlob->GetBufferPointer(), pReadBlob->GetBufferSize(), nullptr, mP_VertexShader.GetAddressOf());
+			return mP_Device->CreateVertexShader(pBlob->GetBufferPointer(), pBlob->GetBufferSize(), nullptr, mP_VertexShader.GetAddressOf());
 		}
 
 		inline void Bind() noexcept
@@ -20,11 +20,9 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		static constexpr unsigned char ALPHA_CHANNEL = 3;
 		static constexpr unsigned char NUM_CHANNELS = 4;
 
-		inline DXColor(DXColorType colorType)
+		inline constexpr DXColor(DXColorType colorType)
+			: rgba{ 0, 0, 0, 255 }
 		{
-			SetAll(0);
-			rgba[ALPHA_CHANNEL] = 255;
-
 			switch (colorType)
 			{
 			case DXColorType::BLACK:
@@ -46,42 +44,36 @@ namespace CTMRenderer::CTMDirectX::Graphics
 			}
 		}
 
-		inline DXColor(unsigned char r = 0, unsigned char g = 0, unsigned char b = 0, unsigned char a = 0)
+		inline constexpr DXColor(unsigned char r = 0, unsigned char g = 0, unsigned char b = 0, unsigned char a = 0)
+			: rgba{ r, g, b, a }
 		{
-			rgba[0] = r;
-			rgba[1] = g;
-			rgba[2] = b;
-			rgba[3] = a;
 		}
 
-		inline void SetAll(unsigned char color)
+		inline constexpr void SetAll(unsigned char color)
 		{
 			for (size_t i = 0; i < NUM_CHANNELS; ++i)
 				rgba[i] = color;
 		}
 
-		inline [[nodiscard]] unsigned char r() const noexcept { return rgba[0]; }
-		inline [[nodiscard]] unsigned char g() const noexcept { return rgba[1]; }
-		inline [[nodiscard]] unsigned char b() const noexcept { return rgba[2]; }
-		inline [[nodiscard]] unsigned char a() const noexcept { return rgba[3]; }
+		[[nodiscard]] inline constexpr unsigned char r() const noexcept { return rgba[0]; }
+		[[nodiscard]] inline constexpr unsigned char g() const noexcept { return rgba[1]; }
+		[[nodiscard]] inline constexpr unsigned char b() const noexcept { return rgba[2]; }
+		[[nodiscard]] inline constexpr unsigned char a() const noexcept { return rgba[3]; }
 
 		unsigned char rgba[4];
 	};
 
 	struct DXNormColor
 	{
-		inline DXNormColor(float r = 0, float g = 0, float b = 0, float a = 1)
+		inline constexpr DXNormColor(float r = 0, float g = 0, float b = 0, float a = 1)
+			: rgba{ r, g, b, a }
 		{
-			rgba[0] = r;
-			rgba[1] = g;
-			rgba[2] = b;
-			rgba[3] = a;
 		}
 
-		inline [[nodiscard]] float r() const noexcept { return rgba[0]; }
-		inline [[nodiscard]] float g() const noexcept { return rgba[1]; }
-		inline [[nodiscard]] float b() const noexcept { return rgba[2]; }
-		inline [[nodiscard]] float a() const noexcept { return rgba[3]; }
+		[[nodiscard]] inline constexpr float r() const noexcept { return rgba[0]; }
+		[[nodiscard]] inline constexpr float g() const noexcept { return rgba[1]; }
+		[[nodiscard]] inline constexpr float b() const noexcept { return rgba[2]; }
+		[[nodiscard]] inline constexpr float a() const noexcept { return rgba[3]; }
 
 		float rgba[4];
 	};
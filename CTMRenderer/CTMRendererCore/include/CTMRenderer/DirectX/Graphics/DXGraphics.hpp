@@ -10,13 +10,22 @@
 #include <DirectXMath.h>
 
 #include <string_view>
+#include <array>
+#include <memory>
+#include <vector>
 
+#include "Threading/TaskGraph.hpp"
+#include "CTMRenderer/ModuleRegistry.hpp"
+#include "CTMRenderer/SceneFrame.hpp"
 #include "CTMRenderer/DirectX/Control/Mouse.hpp"
 #include "CTMRenderer/DirectX/DXRendererSettings.hpp"
 #include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindow.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXInfoQueue.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXSharedResources.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
-
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXQuadPipeline.hpp"
 
 namespace CTMRenderer::CTMDirectX::Graphics
 {
@@ -34,34 +43,71 @@ namespace CTMRenderer::CTMDirectX::Graphics
 
 	// Temporary data containers for initial text rendering with DirectWrite implementation.
 	struct TextRender {
-		Microsoft::WRL::ComPtr<IDWriteFactory> pDWriteFactory;
 		Microsoft::WRL::ComPtr<IDWriteTextFormat> pTextFormat;
 		Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> pSCBrush;
 		D2D1_RECT_F layoutRect = {};
 		std::wstring_view text;
 	};
 
+	// Shaders of the test scene, read off the render thread during startup. (The rects are baked into S_TEST_SCENE, the shapes built by SceneFrame)
+	struct TestSceneData {
+		Microsoft::WRL::ComPtr<ID3DBlob> pPixelShaderBlob;
+		Microsoft::WRL::ComPtr<ID3DBlob> pVertexShaderBlob;
+		Microsoft::WRL::ComPtr<ID3DBlob> pShapePixelShaderBlob;
+		Microsoft::WRL::ComPtr<ID3DBlob> pShapeVertexShaderBlob;
+	};
+
+	using RectPipeline = DXQuadPipeline<InstanceData, (UINT)std::tuple_size_v<decltype(S_TEST_SCENE.instances)>, 4>;
+	using ShapePipeline = DXQuadPipeline<ShapeInstanceData, (UINT)std::tuple_size_v<TestShapes>, 7>;
+
 	class DXGraphics
 	{
 	public:
-		DXGraphics(const DXRendererSettings& settingsRef, const Window::Geometry::WindowArea& windowAreaRef, const Control::Mouse& mouseRef) noexcept;
+		DXGraphics(const DXRendererSettings& settingsRef, const Window::Geometry::WindowArea& windowAreaRef, const Control::Mouse& mouseRef, DXSharedResources& sharedResourcesRef) noexcept;
 		~DXGraphics() = default;
 	public:
-		void Init(const HWND windowHandle) noexcept;
+		/* Adds the graphics initialization steps to a startup graph.
+		 * Steps touching the device context run on the calling thread once windowTaskID (creation of windowRef) finished,
+		 * while file reads and scene building run on the pool. Direct2D and DirectWrite aren't part of startup,
+		 * they are initialized through Modules() the first time text is drawn. */
+		void AddInitTasks(Threading::TaskGraph& graph, Threading::TaskID windowTaskID, const Window::DXWindow& windowRef) noexcept;
+
+		// Resolves the frame's damage : every pass clears and draws only the damaged rects, through the scissor.
 		void StartFrame(double elapsedMillis) noexcept;
-		void Draw() noexcept;
+
+		// Executes the frame's graph. Every pass uses the immediate context, so all of them run on the calling thread.
+		void Draw(Threading::WorkerPool& pool) noexcept;
 		void EndFrame() noexcept;
+	public:
+		[[nodiscard]] inline const ModuleRegistry& Modules() const noexcept { return m_Modules; }
+		[[nodiscard]] inline const FrameGraph& Graph() const noexcept { return m_Frame.Graph(); }
+
+		// Whatever changes what's drawn adds the window pixels it touches, to be redrawn from the next frame on.
+		[[nodiscard]] inline DamageTracker& Damage() noexcept { return m_Frame.Damage(); }
 	private:
+		void InitDevice(const HWND windowHandle) noexcept;
 		void Init2D() noexcept;
-		void InitText() noexcept;
+		void InitTextFormat() noexcept;
+		void InitTextBrush() noexcept;
+		void LoadTestShaders() noexcept;
 		void InitTestScene() noexcept;
+		[[nodiscard]] SceneFramePasses FramePasses() noexcept;
+		void DrawTestRects() noexcept;
+		void DrawTestShapes() noexcept;
+		void DrawTestText() noexcept;
 		void BindRTV() const noexcept;
+
+		// Calls draw once per damage rect of the frame, with the scissor set to it.
+		template <typename DrawFunction>
+		void DrawDamaged(DrawFunction&& draw) noexcept;
 	private:
 		static constexpr unsigned char SYNC_INTERVAL = 1u;
+		static constexpr unsigned int BUFFER_COUNT = 2u;
 	private:
 		const DXRendererSettings& m_SettingsRef;
 		const Window::Geometry::WindowArea& m_WindowAreaRef;
 		const Control::Mouse& m_MouseRef;
+		DXSharedResources& m_SharedResourcesRef;
 		Debug::DXInfoQueue m_InfoQueue;
 		Microsoft::WRL::ComPtr<ID3D11Device1> mP_Device;
 		Microsoft::WRL::ComPtr<IDXGISwapChain> mP_SwapChain;
@@ -71,7 +117,19 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		HWND m_WindowHandle = nullptr;
 		Rendering2D m_2DRender;
 		TextRender m_TextRender;
+		TestSceneData m_TestScene;
+		std::unique_ptr<RectPipeline> m_RectPipeline;
+		std::unique_ptr<ShapePipeline> m_ShapePipeline;
+		Microsoft::WRL::ComPtr<ID3D11BlendState> mP_PremultipliedBlend; // Shapes output premultiplied color.
+		Microsoft::WRL::ComPtr<ID3D11RasterizerState> mP_ScissorRasterizer;
+		std::vector<D3D11_RECT> m_DamageRects; // This frame's, the whole window on a full redraw.
+		uint64_t m_PresentedFrames = 0;
 		DXNormColor m_ClearColor;
+		ModuleRegistry m_Modules;
+		ModuleID m_2DModuleID = 0;
+		ModuleID m_TextFormatModuleID = 0;
+		ModuleID m_TextModuleID = 0;
+		SceneFrame m_Frame;
 	private:
 		DXGraphics(const DXGraphics&) = delete;
 		DXGraphics(DXGraphics&&) = delete;
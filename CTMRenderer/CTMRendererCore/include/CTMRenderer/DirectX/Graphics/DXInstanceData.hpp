@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+
+namespace CTMRenderer::CTMDirectX::Graphics
+{
+	// Two floats, layout compatible with DirectX::XMFLOAT2 / DXGI_FORMAT_R32G32_FLOAT.
+	struct DXFloat2
+	{
+		float x = 0, y = 0;
+	};
+
+	/* Per-instance data of the instanced rect pipeline.
+	 * Mirrors INSTANCE_SCALAR, INSTANCE_OFFSET and INSTANCE_COLOR of DefaultRectVS.hlsl, and is kept free of
+	 * DirectX types so the CPU paths can consume the exact same data. */
+	struct InstanceData
+	{
+		DXFloat2 scalarXY = {}; // X and Y scale factors.
+		DXFloat2 offsetXY = {}; // X and Y offsets.
+		DXColor color = {};
+	};
+
+	/* Per-instance data of the analytic shape pipeline, mirroring ShapeVS.hlsl.
+	 * Every shape is a rounded box, evaluated per pixel as a signed distance instead of being tessellated :
+	 * rects have no corner radius and circles a corner radius of their half size. Coordinates are in screen pixels. */
+	struct ShapeInstanceData
+	{
+		DXFloat2 centerXY = {};
+		DXFloat2 halfSizeXY = {};
+		float cornerRadius = 0; // Clamped to the smaller half size.
+		float borderWidth = 0;  // Grows inwards from the edge. 0 for no border.
+		DXColor fillColor = {};
+		DXColor borderColor = {};
+	};
+
+	static_assert(sizeof(DXFloat2) == sizeof(float) * 2, "DXFloat2 must be tightly packed.");
+	static_assert(sizeof(InstanceData) == sizeof(DXFloat2) * 2 + sizeof(DXColor), "InstanceData must match the rect input layout.");
+	static_assert(sizeof(ShapeInstanceData) == sizeof(DXFloat2) * 2 + sizeof(float) * 2 + sizeof(DXColor) * 2, "ShapeInstanceData must match the shape input layout.");
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <d3d11.h>
+#include <d3d11_1.h>
+#include <wrl/client.h>
+#include <DirectXMath.h>
+
+#include <array>
+
+#include "CTMRenderer/DirectX/Graphics/Bindable/DXBuffer.hpp"
+#include "CTMRenderer/DirectX/Graphics/Bindable/DXShader.hpp"
+#include "CTMRenderer/DirectX/Graphics/Bindable/DXInputLayout.hpp"
+
+namespace CTMRenderer::CTMDirectX::Graphics
+{
+	// Vertex of the quad every instanced pipeline draws.
+	struct QuadVertex
+	{
+		DirectX::XMFLOAT2 pos;
+	};
+
+	/* Bindables of a pipeline drawing one quad per instance : the quad's corners in slot 0, the instances in slot 1,
+	 * two triangles of indices, the shaders and their input layout.
+	 *
+	 * Kept alive for the renderer's lifetime, so passes drawing with different pipelines can rebind theirs every frame. */
+	template <typename Instance, UINT Instances, size_t LayoutElems>
+	class DXQuadPipeline
+	{
+		template <typename T>
+		using ComPtr = Microsoft::WRL::ComPtr<T>;
+	public:
+		inline DXQuadPipeline(
+			const std::array<QuadVertex, 4>& corners,
+			const std::array<Instance, Instances>& instances,
+			const std::array<D3D11_INPUT_ELEMENT_DESC, LayoutElems>& layoutDescs,
+			const ComPtr<ID3DBlob>& pVertexShaderBlobRef,
+			ComPtr<ID3D11Device1>& pDeviceRef,
+			ComPtr<ID3D11DeviceContext1>& pContextRef
+		) noexcept
+			: m_Geometry(corners, pDeviceRef, pContextRef), m_Instances(instances, pDeviceRef, pContextRef),
+			  m_Indices({ 0, 1, 2, 2, 3, 0 }, pDeviceRef, pContextRef),
+			  m_PixelShader(pDeviceRef, pContextRef), m_VertexShader(pDeviceRef, pContextRef),
+			  m_InputLayout(layoutDescs, pVertexShaderBlobRef, pDeviceRef, pContextRef),
+			  mP_VertexShaderBlobRef(pVertexShaderBlobRef)
+		{
+		}
+
+		~DXQuadPipeline() = default;
+	public:
+		// Creates every bindable, stopping at the first failure.
+		inline [[nodiscard]] HRESULT Create(const ComPtr<ID3DBlob>& pPixelShaderBlob) noexcept
+		{
+			HRESULT hResult = m_Geometry.Create();
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = m_Instances.Create();
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = m_Indices.Create();
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = m_PixelShader.Create(pPixelShaderBlob);
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = m_VertexShader.Create(mP_VertexShaderBlobRef);
+			if (hResult != S_OK)
+				return hResult;
+
+			return m_InputLayout.Create();
+		}
+
+		inline void Bind() noexcept
+		{
+			m_Geometry.Bind(0);
+			m_Instances.Bind(1);
+			m_Indices.Bind();
+			m_PixelShader.Bind();
+			m_VertexShader.Bind();
+			m_InputLayout.Bind();
+		}
+	public:
+		static constexpr UINT S_INDICES = 6;
+		static constexpr UINT S_INSTANCES = Instances;
+	private:
+		Bindable::DXStrictVertexBuffer<QuadVertex, 4> m_Geometry;
+		Bindable::DXStrictVertexBuffer<Instance, Instances> m_Instances;
+		Bindable::DXStrictIndexBuffer<short, 6, DXGI_FORMAT_R16_UINT> m_Indices;
+		DXPixelShader m_PixelShader;
+		DXVertexShader m_VertexShader;
+		DXInputLayout<LayoutElems> m_InputLayout;
+		const ComPtr<ID3DBlob>& mP_VertexShaderBlobRef;
+	private:
+		DXQuadPipeline(const DXQuadPipeline&) = delete;
+		DXQuadPipeline(DXQuadPipeline&&) = delete;
+		DXQuadPipeline& operator=(const DXQuadPipeline&) = delete;
+		DXQuadPipeline& operator=(DXQuadPipeline&&) = delete;
+	};
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <d3d11.h>
+#include <dwrite_1.h>
+#include <wrl/client.h> // ComPtr
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace CTMRenderer::CTMDirectX::Graphics
+{
+	/* Immutable, device-independent resources shared by every renderer of a process or RendererHost.
+	 * Each resource is created on first request and handed out by reference count afterwards, so N renderers
+	 * read a shader or load a font once. Safe to call from any thread. */
+	class DXSharedResources
+	{
+	public:
+		DXSharedResources() = default;
+		~DXSharedResources() = default;
+	public:
+		// Returns the bytecode of a compiled shader (.cso), reading it on first request.
+		[[nodiscard]] HRESULT ShaderBlob(const std::filesystem::path& shaderPath, Microsoft::WRL::ComPtr<ID3DBlob>& pBlobOut) noexcept;
+
+		// Returns a text format centered on both axes, creating it on first request. Shared formats must not be modified.
+		[[nodiscard]] HRESULT TextFormat(std::wstring_view familyName, float fontSize, Microsoft::WRL::ComPtr<IDWriteTextFormat>& pTextFormatOut) noexcept;
+	private:
+		std::mutex m_Mutex;
+		Microsoft::WRL::ComPtr<IDWriteFactory> mP_DWriteFactory;
+		std::unordered_map<std::wstring, Microsoft::WRL::ComPtr<ID3DBlob>> m_ShaderBlobs; // Keyed by path.
+		std::unordered_map<std::wstring, Microsoft::WRL::ComPtr<IDWriteTextFormat>> m_TextFormats; // Keyed by family and size.
+	private:
+		DXSharedResources(const DXSharedResources&) = delete;
+		DXSharedResources(DXSharedResources&&) = delete;
+		DXSharedResources& operator=(const DXSharedResources&) = delete;
+		DXSharedResources& operator=(DXSharedResources&&) = delete;
+	};
+}
@@ -3,13 +3,15 @@
 #include "Core/CoreMacros.hpp"
 #include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
 
 namespace CTMRenderer::CTMDirectX::Graphics::Geometry
 {
 	enum class ShapeType
 	{
 		RECT,
-		CIRClE
+		CIRCLE,
+		ROUNDED_RECT
 	};
 
 	class IShape
@@ -18,7 +20,7 @@ namespace CTMRenderer::CTMDirectX::Graphics::Geometry
 		IShape(ShapeType type) noexcept;
 		virtual ~IShape() = default;
 	public:
-		virtual [[nodiscard]] ShapeType Type() const noexcept = 0;
+		[[nodiscard]] inline ShapeType Type() const noexcept { return m_Type; }
 	private:
 		const ShapeType m_Type;
 	};
@@ -30,8 +32,48 @@ namespace CTMRenderer::CTMDirectX::Graphics::Geometry
 		~DXRect() = default;
 	public:
 		[[nodiscard]] DXAABB& Aabb() noexcept;
+		[[nodiscard]] const DXColor& Color() const noexcept;
 	private:
 		DXAABB AABB;
 		DXColor color;
 	};
-}
\ No newline at end of file
+
+	class DXCircle : public IShape
+	{
+	public:
+		DXCircle(float centerX, float centerY, float radius, const DXColor& color, float borderWidth = 0, const DXColor& borderColor = {}) noexcept;
+		~DXCircle() = default;
+	public:
+		// Returns the circle as an instance of the analytic shape pipeline.
+		[[nodiscard]] ShapeInstanceData Instance() const noexcept;
+	public:
+		[[nodiscard]] inline float Radius() const noexcept { return m_Radius; }
+		[[nodiscard]] inline const DXColor& Color() const noexcept { return m_Color; }
+	private:
+		float m_CenterX, m_CenterY;
+		float m_Radius;
+		float m_BorderWidth;
+		DXColor m_Color;
+		DXColor m_BorderColor;
+	};
+
+	// A rect with rounded corners and an optional border. (A corner radius of 0 gives a plain bordered rect)
+	class DXRoundedRect : public IShape
+	{
+	public:
+		DXRoundedRect(float left, float top, float right, float bottom, float cornerRadius, const DXColor& color, float borderWidth = 0, const DXColor& borderColor = {}) noexcept;
+		~DXRoundedRect() = default;
+	public:
+		// Returns the rect as an instance of the analytic shape pipeline.
+		[[nodiscard]] ShapeInstanceData Instance() const noexcept;
+	public:
+		[[nodiscard]] inline const DXAABB& Aabb() const noexcept { return m_AABB; }
+		[[nodiscard]] inline const DXColor& Color() const noexcept { return m_Color; }
+	private:
+		DXAABB m_AABB;
+		float m_CornerRadius;
+		float m_BorderWidth;
+		DXColor m_Color;
+		DXColor m_BorderColor;
+	};
+}
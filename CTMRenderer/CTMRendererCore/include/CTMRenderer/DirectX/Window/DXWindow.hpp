@@ -26,6 +26,9 @@ namespace CTMRenderer::CTMDirectX::Window
 		void Start() noexcept;
 		void HandleMessages(BOOL& result, MSG& msg) noexcept;
 		void SetTitle(const std::wstring& title) noexcept;
+
+		// Destroys the window. Must be called on the thread that called Start.
+		void Close() noexcept;
 	public:
 		inline [[nodiscard]] bool IsInitialized() { return m_IsInitialized.load(std::memory_order_acquire); }
 		inline [[nodiscard]] bool IsShown()		  { return m_IsShown.load(std::memory_order_acquire); }
@@ -35,12 +38,13 @@ namespace CTMRenderer::CTMDirectX::Window
 		inline [[nodiscard]] const Geometry::WindowArea& ClientArea() const noexcept { return m_ClientArea; }
 	private:
 		void Init();
+		static void RegisterWindowClass() noexcept;
 	private:
 		static LRESULT CALLBACK WndProcSetup(HWND windowHandle, UINT msgCode, WPARAM wParam, LPARAM lParam) noexcept;
 		static LRESULT CALLBACK WndProcThunk(HWND windowHandle, UINT msgCode, WPARAM wParam, LPARAM lParam) noexcept;
 		LRESULT CALLBACK WndProc(HWND windowHandle, UINT msgCode, WPARAM wParam, LPARAM lParam) noexcept;
 	private:
-		static constexpr const wchar_t* SP_WINDOW_CLASS_NAME = L"TestWindow"; // SMP = static member pointer.
+		static constexpr const wchar_t* SP_WINDOW_CLASS_NAME = L"TestWindow"; // SMP = static member pointer. Registered once, shared by every window.
 		static constexpr const wchar_t* SP_WINDOW_TITLE = L"Test Window";
 	private:
 		const DXRendererSettings& m_SettingsRef;
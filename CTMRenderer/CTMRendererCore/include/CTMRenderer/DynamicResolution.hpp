@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+
+namespace CTMRenderer
+{
+	struct DynamicResolutionSettings
+	{
+		inline DynamicResolutionSettings(double targetFrameMillis = 1000.0 / 60)
+			: TargetFrameMillis(targetFrameMillis) {}
+
+		double TargetFrameMillis;
+
+		float MinScale = 0.5f;
+		float MaxScale = 1.0f;
+		float ScaleStep = 0.1f;
+
+		// The averaged frame time is over budget above TargetFrameMillis * DownscaleThreshold.
+		double DownscaleThreshold = 1.0;
+
+		// Scaling up is only considered when the frame time predicted for the next scale (cost grows with the pixel count)
+		// stays under TargetFrameMillis * UpscaleThreshold. Keeping this below DownscaleThreshold is what prevents oscillation.
+		double UpscaleThreshold = 0.85;
+
+		unsigned int DownscaleFrames = 4; // Consecutive over budget frames before scaling down.
+		unsigned int UpscaleFrames = 60;  // Consecutive frames with headroom before scaling up.
+
+		double Smoothing = 0.2; // Weight of the newest frame in the moving average.
+	};
+
+	/* Picks the internal render resolution from frame time feedback.
+	 * Frames over budget lower the scale quickly, while sustained headroom raises it slowly. */
+	class DynamicResolution
+	{
+	public:
+		DynamicResolution(const DynamicResolutionSettings& settings) noexcept;
+		~DynamicResolution() = default;
+	public:
+		// Feeds the cost of the last frame. Returns true if the scale changed.
+		bool Update(double frameMillis) noexcept;
+		void Reset() noexcept;
+
+		// Returns area scaled by the current scale. (At least 1x1)
+		[[nodiscard]] CTMDirectX::Window::Geometry::WindowArea ScaledArea(const CTMDirectX::Window::Geometry::WindowArea& area) const noexcept;
+	public:
+		[[nodiscard]] inline float Scale() const noexcept { return m_Scale; }
+		[[nodiscard]] inline double AverageMillis() const noexcept { return m_AverageMillis; }
+		[[nodiscard]] inline const DynamicResolutionSettings& Settings() const noexcept { return m_Settings; }
+	private:
+		// Returns true if the clamped scale differs from the current one.
+		bool SetScale(float scale) noexcept;
+	private:
+		DynamicResolutionSettings m_Settings;
+		float m_Scale;
+		double m_AverageMillis = 0.0;
+		unsigned int m_OverBudgetFrames = 0;
+		unsigned int m_HeadroomFrames = 0;
+		bool m_HasSample = false;
+	};
+}
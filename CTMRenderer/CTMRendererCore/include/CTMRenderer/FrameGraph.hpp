@@ -0,0 +1,127 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Threading/TaskGraph.hpp"
+#include "Threading/WorkerPool.hpp"
+
+namespace CTMRenderer
+{
+	using FrameResourceID = size_t;
+	using FramePassID = size_t;
+
+	// Size and format of a transient resource. Transients only share memory with transients of an equal description.
+	struct FrameResourceDesc
+	{
+		unsigned int width = 0, height = 0;
+		unsigned int format = 0; // Backend defined. (e.g. a DXGI_FORMAT)
+
+		[[nodiscard]] bool operator==(const FrameResourceDesc&) const noexcept = default;
+	};
+
+	struct FrameGraphStats
+	{
+		size_t passes = 0;
+		size_t culledPasses = 0;
+		size_t transients = 0;         // Transients used by live passes.
+		size_t physicalTransients = 0; // Memory backing them, after aliasing.
+		double executeMillis = 0.0;    // Last Execute.
+	};
+
+	/* A frame described as passes declaring the resources they read and write, compiled once and executed every frame.
+	 *
+	 * Compile culls every pass whose writes never reach a resource marked as output, so a view only pays for what it
+	 * presents, and derives the order passes must run in from their accesses. Transients whose lifetimes don't overlap
+	 * share one physical resource, which backends allocate from PhysicalDescs and look up through PhysicalIndex.
+	 * Execute runs independent passes in parallel on the pool, except for CALLER passes (e.g. anything using an
+	 * immediate context), which stay on the calling thread.
+	 *
+	 * Passes are declared in the order they'd run on a single thread, and the graph produces the same result. */
+	class FrameGraph
+	{
+	public:
+		static constexpr size_t S_NOT_PHYSICAL = std::numeric_limits<size_t>::max();
+	public:
+		FrameGraph() = default;
+		~FrameGraph() = default;
+	public:
+		// A resource owned outside the graph. (e.g. a back buffer, or a frame handed to a consumer)
+		FrameResourceID Import(std::string_view name) noexcept;
+
+		// A resource only living within a frame, whose memory may be shared with other transients.
+		FrameResourceID CreateTransient(std::string_view name, const FrameResourceDesc& desc) noexcept;
+
+		// The content of resource is used after the frame. Passes not contributing to any output are culled.
+		void MarkOutput(FrameResourceID resource) noexcept;
+
+		/* Adds a pass. Blending into (or drawing over) a resource is both a read and a write of it, only passes
+		 * overwriting all of it (e.g. a clear) write without reading. Transients must be written before they're read. */
+		FramePassID AddPass(std::string_view name, std::initializer_list<FrameResourceID> reads, std::initializer_list<FrameResourceID> writes,
+			std::function<void()> execute, Threading::TaskAffinity affinity = Threading::TaskAffinity::ANY) noexcept;
+
+		// Culls, orders and aliases. Resources and passes can't be added afterwards.
+		void Compile() noexcept;
+
+		// Runs every live pass and blocks until all of them finished.
+		void Execute(Threading::WorkerPool& pool) noexcept;
+
+		void PrintReport(std::ostream& stream) const noexcept;
+	public:
+		[[nodiscard]] inline bool IsCompiled() const noexcept { return m_IsCompiled; }
+		[[nodiscard]] inline bool IsCulled(FramePassID pass) const noexcept { return !m_Passes[pass].isLive; }
+
+		// Returns the physical resource backing a transient, or S_NOT_PHYSICAL for imported and unused resources.
+		[[nodiscard]] inline size_t PhysicalIndex(FrameResourceID resource) const noexcept { return m_Resources[resource].physicalIndex; }
+		[[nodiscard]] inline const std::vector<FrameResourceDesc>& PhysicalDescs() const noexcept { return m_PhysicalDescs; }
+
+		[[nodiscard]] inline const FrameGraphStats& Stats() const noexcept { return m_Stats; }
+
+		// Returns when and where every live pass ran during the last Execute.
+		[[nodiscard]] inline const std::vector<Threading::TaskRecord>& Timeline() const noexcept { return m_Timeline; }
+	private:
+		struct Resource
+		{
+			std::string name;
+			FrameResourceDesc desc;
+			bool isTransient = false;
+			bool isOutput = false;
+			size_t physicalIndex = S_NOT_PHYSICAL;
+		};
+
+		struct Pass
+		{
+			std::string name;
+			std::vector<FrameResourceID> reads;
+			std::vector<FrameResourceID> writes;
+			std::function<void()> execute;
+			Threading::TaskAffinity affinity = Threading::TaskAffinity::ANY;
+			std::vector<FramePassID> producers;    // Last writers of the resources read.
+			std::vector<Threading::TaskID> dependencies; // Indices into m_LivePasses.
+			bool isLive = false;
+		};
+	private:
+		void Cull() noexcept;
+		void Order() noexcept;
+		void Alias() noexcept;
+	private:
+		std::vector<Resource> m_Resources;
+		std::vector<Pass> m_Passes;
+		std::vector<FramePassID> m_LivePasses; // In declaration order.
+		std::vector<FrameResourceDesc> m_PhysicalDescs;
+		std::vector<Threading::TaskRecord> m_Timeline;
+		FrameGraphStats m_Stats;
+		bool m_IsSerial = true; // Every live pass runs on the caller, so Execute runs them in order without scheduling.
+		bool m_IsCompiled = false;
+	private:
+		FrameGraph(const FrameGraph&) = delete;
+		FrameGraph(FrameGraph&&) = delete;
+		FrameGraph& operator=(const FrameGraph&) = delete;
+		FrameGraph& operator=(FrameGraph&&) = delete;
+	};
+}
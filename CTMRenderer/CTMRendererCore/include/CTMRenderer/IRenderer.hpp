@@ -4,33 +4,89 @@
 #include <atomic> // std::atomic_bool
 #include <mutex>  // std::mutex
 #include <condition_variable> // std::condition_variable
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
 
 #include "Event/EventSystem.hpp"
+#include "Threading/ThreadConfig.hpp"
+#include "Threading/WorkerPool.hpp"
+#include "Threading/TaskGraph.hpp"
 #include "CTMRenderer/Timer.hpp"
 
 namespace CTMRenderer
 {
 	enum class RendererType
 	{
-		CTM_DIRECTX
+		CTM_DIRECTX,
+		CTM_NULL,    // Headless, draws are only counted. (No GPU or display required)
+		CTM_SOFTWARE // Headless, rasterized on the CPU into an in-memory framebuffer.
 	};
 
+	/* Base of every backend, owning the event loop and its timing.
+	 *
+	 * Backends implement Step (one loop iteration) and the state hooks, while the loop itself, event handling
+	 * and frame pacing are shared, so every backend spends the same CPU time outside of its own frame work. */
 	class IRenderer
 	{
 	public:
-		IRenderer() = default;
+		// Standalone renderer, owning its worker pool and running on its own event thread.
+		explicit IRenderer(const Threading::ThreadTopology& threadTopology = {}) noexcept;
+
+		// Hosted renderer, using the pool of its RendererHost and driven by the host's thread.
+		explicit IRenderer(Threading::WorkerPool& sharedWorkerPool) noexcept;
+
 		virtual ~IRenderer() = default;
 	public:
-		virtual void Start() noexcept = 0;
-		virtual void JoinForShutdown() noexcept = 0;
+		// Runs the renderer on its own event thread. Hosted renderers are started by their RendererHost instead.
+		void Start() noexcept;
+		void JoinForShutdown() noexcept;
+
+		/* Stepping API, called on the thread driving the renderer. (m_EventThread, or a RendererHost's thread)
+		 * Attach subscribes to events and queues the start event, Step runs one event loop iteration
+		 * (messages, queued events, and a frame once started) and Detach releases what Attach acquired. */
+		virtual void Attach() noexcept;
+		virtual void Step(double elapsedMillis) noexcept = 0;
+		virtual void Detach() noexcept;
+
+		// Frames per second the event loop is paced to. 0 runs frames back to back. (e.g. for benchmarking)
+		[[nodiscard]] virtual unsigned int TargetFPS() const noexcept = 0;
+	public:
+		[[nodiscard]] inline bool IsRunning() const noexcept { return m_ShouldRun.load(std::memory_order_acquire); }
+		[[nodiscard]] inline bool IsHosted() const noexcept { return m_OwnedWorkerPool == nullptr; }
+
+		// Returns the per-step timeline of the last startup. (Empty until the renderer started)
+		[[nodiscard]] inline const std::vector<Threading::TaskRecord>& StartupTimeline() const noexcept { return m_StartupTimeline; }
+	protected:
+		virtual void OnStart(const Event::StartEvent* pStartEvent) noexcept = 0;
+		virtual void OnEnd(const Event::EndEvent* pEndEvent) noexcept;
+		virtual void OnMouseMove(const Event::MouseMoveEvent* pMouseMoveEvent) noexcept;
+
+		// Dispatches the events queued since the last call. Called by Step.
+		void DispatchQueuedEvents() noexcept;
+	private:
+		void EventLoop() noexcept;
+		void HandleEvent(Event::IEvent* pEvent) noexcept;
+		void HandleStateEvent(Event::IEvent* pEvent) noexcept;
+		void HandleMouseEvent(Event::IEvent* pEvent) noexcept;
 	protected:
 		Event::EventSystem m_EventSystem;
 		Timer::Timer m_Timer;
+		std::unique_ptr<Threading::WorkerPool> m_OwnedWorkerPool; // nullptr when the pool is shared by a RendererHost.
+		Threading::WorkerPool& m_WorkerPool;
+		Threading::ThreadPlacement m_EventThreadPlacement;
+		std::vector<Threading::TaskRecord> m_StartupTimeline;
 		std::thread m_EventThread;
 		std::mutex m_RendererMutex;
 		std::condition_variable m_RendererCV;
 		std::atomic_bool m_ShouldRun = false;
 		std::atomic_bool m_EventLoopStarted = false;
 		std::atomic_bool m_RendererStarted = false;
+	private:
+		Event::GenericListener<Event::GenericEventType::CTM_ANY> m_EventListener;
+	private:
+		IRenderer(const IRenderer&) = delete;
+		IRenderer(IRenderer&&) = delete;
+		IRenderer& operator=(const IRenderer&) = delete;
+		IRenderer& operator=(IRenderer&&) = delete;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	// Rects in structure of arrays form, every array holding count elements. Rects must not be empty.
+	struct RectBatch
+	{
+		const float* pLeft = nullptr;
+		const float* pTop = nullptr;
+		const float* pRight = nullptr;
+		const float* pBottom = nullptr;
+		const CTMDirectX::Graphics::DXColor* pColors = nullptr;
+		size_t count = 0;
+	};
+
+	/* Writes the instance placing baseQuad onto each rect of the batch into pInstances, which holds rects.count elements.
+	 * The scale is the rect's size over the base quad's, and the offset its top left corner relative to the base quad's,
+	 * like BakeScene computes them. Uses the widest instruction set the CPU supports, 8 rects per iteration with
+	 * AVX2, and produces the same bits as BuildInstancesReference on every instruction set. With AVX2, batches too
+	 * large to stay in cache are written around it, so they're best built straight into the buffer they're uploaded from. */
+	void BuildInstances(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, CTMDirectX::Graphics::InstanceData* pInstances) noexcept;
+
+	// Same as above, split into chunks across the pool and the calling thread.
+	void BuildInstances(Threading::WorkerPool& pool, const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, CTMDirectX::Graphics::InstanceData* pInstances) noexcept;
+
+	// One rect at a time, kept as the reference the vector paths are verified against.
+	void BuildInstancesReference(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, CTMDirectX::Graphics::InstanceData* pInstances) noexcept;
+
+	// Returns the name of the instruction set BuildInstances uses. (e.g. "AVX2")
+	[[nodiscard]] const char* InstanceBuilderISA() noexcept;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CTMRenderer
+{
+	using ModuleID = size_t;
+
+	// Initialization state and cost of a module.
+	struct ModuleRecord
+	{
+		std::string name;
+		double initMillis = 0.0; // Excludes the time spent initializing dependencies.
+		bool isInitialized = false;
+	};
+
+	/* A registry of lazily initialized subsystems.
+	 *
+	 * Modules are registered with their init function up front, but only initialized the first time something
+	 * requires them, so a deployment never using e.g. text rendering never pays its startup time or memory.
+	 * Dependencies are initialized first, and may only refer to modules registered before them.
+	 *
+	 * Not thread-safe, modules are expected to be required from the thread owning them. */
+	class ModuleRegistry
+	{
+	public:
+		ModuleRegistry() = default;
+		~ModuleRegistry() = default;
+	public:
+		ModuleID Register(std::string_view name, std::function<void()> initFunc, std::initializer_list<ModuleID> dependencies = {}) noexcept;
+
+		// Initializes the module and its dependencies if they aren't yet. Cheap once initialized.
+		inline void Require(ModuleID id) noexcept
+		{
+			if (!m_Records[id].isInitialized)
+				Initialize(id);
+		}
+
+		void PrintReport(std::ostream& stream) const noexcept;
+	public:
+		[[nodiscard]] inline bool IsInitialized(ModuleID id) const noexcept { return m_Records[id].isInitialized; }
+		[[nodiscard]] inline const std::vector<ModuleRecord>& Records() const noexcept { return m_Records; }
+	private:
+		void Initialize(ModuleID id) noexcept;
+	private:
+		struct Module
+		{
+			std::function<void()> initFunc;
+			std::vector<ModuleID> dependencies;
+		};
+	private:
+		std::vector<Module> m_Modules;
+		std::vector<ModuleRecord> m_Records;
+	private:
+		ModuleRegistry(const ModuleRegistry&) = delete;
+		ModuleRegistry(ModuleRegistry&&) = delete;
+		ModuleRegistry& operator=(const ModuleRegistry&) = delete;
+		ModuleRegistry& operator=(ModuleRegistry&&) = delete;
+	};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+
+namespace CTMRenderer::CTMNull
+{
+	// Totals of everything submitted to a NullDrawSink.
+	struct NullDrawStats
+	{
+		uint64_t frames = 0;
+		uint64_t clears = 0;
+		uint64_t clearRects = 0;
+		uint64_t drawCalls = 0;
+		uint64_t indices = 0;
+		uint64_t instances = 0;
+		uint64_t instanceBytes = 0; // Bytes of instance data that would have been uploaded.
+		uint64_t textDraws = 0;
+		uint64_t textCharacters = 0;
+	};
+
+	// Stands in for the device context, counting submissions instead of executing them.
+	class NullDrawSink
+	{
+	public:
+		NullDrawSink() = default;
+		~NullDrawSink() = default;
+	public:
+		// Clears rectCount rects at once, like ID3D11DeviceContext1::ClearView.
+		inline void Clear(const CTMDirectX::Graphics::DXNormColor&, size_t rectCount) noexcept
+		{
+			++m_Stats.clears;
+			m_Stats.clearRects += rectCount;
+		}
+
+		template <typename Instance>
+		inline void DrawIndexedInstanced(unsigned int indexCount, const Instance*, size_t instanceCount) noexcept
+		{
+			++m_Stats.drawCalls;
+			m_Stats.indices += (uint64_t)indexCount * instanceCount;
+			m_Stats.instances += instanceCount;
+			m_Stats.instanceBytes += instanceCount * sizeof(Instance);
+		}
+
+		inline void DrawString(size_t characterCount) noexcept
+		{
+			++m_Stats.textDraws;
+			m_Stats.textCharacters += characterCount;
+		}
+
+		inline void Present() noexcept { ++m_Stats.frames; }
+		inline void Reset() noexcept { m_Stats = {}; }
+	public:
+		[[nodiscard]] inline const NullDrawStats& Stats() const noexcept { return m_Stats; }
+	private:
+		NullDrawStats m_Stats;
+	};
+}
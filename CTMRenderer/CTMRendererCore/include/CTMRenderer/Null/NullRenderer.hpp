@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CTMRenderer/IRenderer.hpp"
+#include "CTMRenderer/SceneFrame.hpp"
+#include "CTMRenderer/Null/NullRendererSettings.hpp"
+#include "CTMRenderer/Null/NullDrawSink.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+
+namespace CTMRenderer::CTMNull
+{
+	/* Headless backend without a device or window.
+	 *
+	 * Runs the same event loop, frame pacing and SceneFrame (frame graph, damage and shape batch) as the DirectX
+	 * backend, but submits every pass's draws to a NullDrawSink, so all CPU-side frame work can be measured on
+	 * machines without a GPU or display. */
+	class NullRenderer : public IRenderer
+	{
+	public:
+		explicit NullRenderer(const NullRendererSettings& settings);
+
+		// Hosted renderer, sharing the worker pool of a RendererHost.
+		NullRenderer(const NullRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool);
+		~NullRenderer() = default;
+	public:
+		virtual void Step(double elapsedMillis) noexcept override;
+		[[nodiscard]] inline virtual unsigned int TargetFPS() const noexcept override { return m_Settings.TargetFPS; }
+	public:
+		[[nodiscard]] inline const NullDrawSink& Sink() const noexcept { return m_Sink; }
+		[[nodiscard]] inline const NullRendererSettings& Settings() const noexcept { return m_Settings; }
+		[[nodiscard]] inline const SceneFrame& Frame() const noexcept { return m_Frame; }
+
+		// Whatever changes what's drawn adds the screen pixels it touches, to be redrawn from the next frame on.
+		[[nodiscard]] inline DamageTracker& Damage() noexcept { return m_Frame.Damage(); }
+	protected:
+		virtual void OnStart(const Event::StartEvent* pStartEvent) noexcept override;
+		virtual void OnEnd(const Event::EndEvent* pEndEvent) noexcept override;
+	private:
+		void DoFrame() noexcept;
+		[[nodiscard]] SceneFramePasses FramePasses() noexcept;
+
+		// Calls draw once per damage rect of the frame, as DXGraphics does through the scissor.
+		template <typename DrawFunction>
+		void DrawDamaged(DrawFunction&& draw) noexcept;
+	private:
+		// Mirrors DXGraphics' swap chain, so damage resolves against the same buffer age.
+		static constexpr unsigned int BUFFER_COUNT = 2u;
+	private:
+		NullRendererSettings m_Settings;
+		CTMDirectX::Window::Geometry::WindowArea m_ScreenArea;
+		NullDrawSink m_Sink;
+		CTMDirectX::Graphics::DXNormColor m_ClearColor;
+		SceneFrame m_Frame;
+		uint64_t m_FrameCount = 0;
+		uint64_t m_PresentedFrames = 0;
+	private:
+		NullRenderer(const NullRenderer&) = delete;
+		NullRenderer(NullRenderer&&) = delete;
+		NullRenderer& operator=(const NullRenderer&) = delete;
+		NullRenderer& operator=(NullRenderer&&) = delete;
+	};
+}
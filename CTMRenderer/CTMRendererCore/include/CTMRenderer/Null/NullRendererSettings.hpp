@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Threading/ThreadConfig.hpp"
+
+namespace CTMRenderer::CTMNull
+{
+	struct NullRendererSettings
+	{
+		inline NullRendererSettings(unsigned int targetFPS, const Threading::ThreadTopology& threads = {})
+			: TargetFPS(targetFPS), Threads(threads) {}
+
+		unsigned int TargetFPS; // 0 runs frames back to back.
+		Threading::ThreadTopology Threads;
+
+		// Size of the virtual screen the scene is prepared for.
+		unsigned int Width = 800;
+		unsigned int Height = 600;
+
+		// Text drawn over the test scene, as DXRendererSettings::TestText. Empty declares no text pass.
+		std::wstring TestText = L"Hello World!!!";
+
+		uint64_t MaxFrames = 0; // The renderer ends itself after this many frames. 0 runs until ended externally.
+	};
+}
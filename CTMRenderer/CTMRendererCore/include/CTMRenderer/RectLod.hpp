@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	struct LodSettings
+	{
+		// Rects whose width and height, in screen pixels, are both below this are aggregated instead of drawn.
+		float MinRectSize = 1.0f;
+
+		// Side of the square cells small rects are aggregated into, in screen pixels. 1 aggregates per pixel, but then
+		// there's close to a cell per small rect, and building the cells costs more than the draw saves.
+		unsigned int CellSize = 8;
+	};
+
+	// Work of the last RectLod pass.
+	struct LodStats
+	{
+		size_t keptRects = 0;       // Drawn as they are.
+		size_t aggregatedRects = 0; // Folded into cells.
+		size_t droppedRects = 0;    // Small rects centered outside the target.
+		size_t cells = 0;           // Instances emitted for aggregated rects.
+	};
+
+	/* Level of detail stage for instance building : replaces rects too small to be seen on their own with one
+	 * instance per screen cell they fall in, so a zoomed out view costs one instance per covered cell instead of
+	 * one per rect.
+	 *
+	 * Every small rect adds its area and area weighted color to the cell holding its center. A cell's instance covers
+	 * the cell with the averaged color, and an alpha scaled by how much of the cell the rects cover, so pipelines that
+	 * blend fade sparse cells while the opaque rect pipeline draws them solid. Rects at least MinRectSize in either
+	 * dimension are kept, and built like BuildInstances does.
+	 *
+	 * A pass is Begin, any number of Add, then End. Cells are inserted beneath the rects the pass kept, in row major
+	 * order, so the result doesn't depend on how the rects were split between batches. */
+	class RectLod
+	{
+	public:
+		RectLod(const LodSettings& settings = {}) noexcept;
+		~RectLod() = default;
+	public:
+		/* Starts a pass over a target of width x height screen pixels, writing instances from firstInstance on. Instances
+		 * already past it are overwritten rather than built anew, so reusing the same vector every frame doesn't
+		 * initialize it again, and End trims whatever the pass didn't write. */
+		void Begin(unsigned int width, unsigned int height, size_t firstInstance) noexcept;
+
+		// Appends the instances of the batch's kept rects, and aggregates the others. Rects are in screen pixels.
+		void Add(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+
+		// Ends the pass, inserting one instance per covered cell before the instances the pass appended.
+		void End(const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+	public:
+		[[nodiscard]] inline const LodSettings& Settings() const noexcept { return m_Settings; }
+		[[nodiscard]] inline const LodStats& Stats() const noexcept { return m_Stats; }
+	private:
+		// Columns of a row some rect fell in, empty when firstX > lastX.
+		struct RowSpan
+		{
+			unsigned int firstX = UINT_MAX;
+			unsigned int lastX = 0;
+		};
+
+		// Sums of a cell's aggregated rects, weighted by their area.
+		struct CellSum
+		{
+			float area = 0;
+			float red = 0, green = 0, blue = 0, alpha = 0;
+		};
+	private:
+		// Returns where the next count instances of the pass go, growing instances when they don't fit.
+		[[nodiscard]] CTMDirectX::Graphics::InstanceData* Write(size_t count, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+
+		// Adds a small rect to the cell holding its center, or drops it when that's outside the target.
+		void Aggregate(float left, float top, float right, float bottom, const CTMDirectX::Graphics::DXColor& color) noexcept;
+	private:
+		static constexpr size_t S_SORT_CELLS_RATIO = 8; // End sorts the touched cells when the rows' spans hold this many times more cells.
+		static constexpr size_t S_RUN_RATIO = 8;        // Add builds kept rects in place when batches hold this many times more rects than small ones.
+	private:
+		LodSettings m_Settings;
+		unsigned int m_Width = 0, m_Height = 0;
+		unsigned int m_CellsX = 0, m_CellsY = 0;
+		size_t m_FirstInstance = 0;
+		size_t m_InstanceCount = 0; // Up to the last instance the pass wrote.
+
+		// Sums of every cell, zero outside the rows' spans, and reset as End reads them.
+		std::vector<CellSum> m_Sums;
+		std::vector<RowSpan> m_RowSpans;
+		std::vector<uint32_t> m_TouchedCells; // Once per cell, unless rects of no area fell in it.
+
+		// Kept rects of a batch, or cells, as a batch for BuildInstances.
+		std::vector<float> m_Lefts, m_Tops, m_Rights, m_Bottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_Colors;
+
+		LodStats m_Stats;
+	};
+
+	/* Same as a RectLod pass over a single batch, replacing instances, summing straight into a grid of cells.
+	 * Kept as the reference RectLod is verified against. */
+	void AggregateReference(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, unsigned int width, unsigned int height,
+		const LodSettings& settings, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept;
+}
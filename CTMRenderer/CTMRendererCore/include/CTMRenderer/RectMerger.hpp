@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+
+namespace CTMRenderer
+{
+	struct MergeSettings
+	{
+		// Largest grid of cells a merge builds. Rects whose edges would cut the area into more cells are returned as they are.
+		size_t MaxCells = (size_t)1 << 24;
+	};
+
+	// Work of the last RectMerger merge.
+	struct MergeStats
+	{
+		size_t inputRects = 0;
+		size_t outputRects = 0;
+		size_t cells = 0;       // Cells of the grid the edges cut the area into.
+		bool isMerged = false;  // False when the grid went over MaxCells, and the input was returned.
+	};
+
+	/* Merges abutting rects of the same color into maximal rects, for static content such as grid backgrounds, tables and
+	 * heatmaps, which then cost fewer instances every frame.
+	 *
+	 * Every distinct left or right edge cuts the area the rects cover into columns, every top or bottom edge into rows.
+	 * Each cell of that grid takes the color of the last rect drawn over it, so overlaps resolve like the opaque rect
+	 * pipeline resolves them. Cells are then greedily meshed : from the first cell left in row major order, a run of same
+	 * colored cells is grown right, then down as long as the whole run below matches, and becomes one rect.
+	 *
+	 * The merged rects cover exactly the pixels the input covers, each with the color the input leaves there, and never
+	 * overlap, so they draw the same image in any order. Their edges are edges of the input, unchanged. */
+	class RectMerger
+	{
+	public:
+		RectMerger(const MergeSettings& settings = {}) noexcept;
+		~RectMerger() = default;
+	public:
+		// Merges the rects, in draw order. The batch returned refers to the merger's columns, valid until the next Merge, or is
+		// the input itself when it isn't merged.
+		[[nodiscard]] RectBatch Merge(const RectBatch& rects) noexcept;
+	public:
+		[[nodiscard]] inline const MergeSettings& Settings() const noexcept { return m_Settings; }
+		[[nodiscard]] inline const MergeStats& Stats() const noexcept { return m_Stats; }
+	private:
+		[[nodiscard]] RectBatch Batch() const noexcept;
+	private:
+		static constexpr uint32_t S_NO_RECT = UINT32_MAX;
+	private:
+		MergeSettings m_Settings;
+
+		// Sorted distinct edges, cutting the area into the grid.
+		std::vector<float> m_EdgesX, m_EdgesY;
+
+		// Last rect drawn over each cell, row major, S_NO_RECT once a cell is uncovered or merged.
+		std::vector<uint32_t> m_CellRects;
+
+		std::vector<float> m_Lefts, m_Tops, m_Rights, m_Bottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_Colors;
+
+		MergeStats m_Stats;
+	};
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <thread> // std::thread
+#include <atomic> // std::atomic_bool
+#include <mutex>  // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <memory> // std::unique_ptr
+#include <vector> // std::vector
+
+#include "CTMRenderer/IRenderer.hpp"
+#include "CTMRenderer/Timer.hpp"
+#include "Threading/ThreadConfig.hpp"
+#include "Threading/WorkerPool.hpp"
+
+#ifndef CTM_NO_DX
+#include "CTMRenderer/DirectX/Graphics/DXSharedResources.hpp"
+#endif
+
+namespace CTMRenderer
+{
+	/* Drives any number of renderer instances from a single thread and a single worker pool.
+	 *
+	 * Instead of N event threads each sleeping and waking at their own rate, the host thread steps every
+	 * instance when its next frame is due and sleeps until the earliest upcoming one. Immutable resources
+	 * (shader bytecode, font data) are shared between instances of the same backend.
+	 *
+	 * The host thread uses ThreadTopology::EventThread as its placement, the shared pool ThreadTopology::Workers. */
+	class RendererHost
+	{
+	public:
+		explicit RendererHost(const Threading::ThreadTopology& threadTopology = {}) noexcept;
+		~RendererHost() noexcept;
+	public:
+		/* Creates an instance driven by this host. Instances added after Start are attached on the next host iteration.
+		 * The returned renderer stays valid for the lifetime of the host, and must not be started or joined itself. */
+		IRenderer& Add(RendererType rendererType, unsigned int targetFPS = 60) noexcept;
+
+		// Adds an instance constructed with custom settings. It must have been created on WorkerPool().
+		IRenderer& Add(std::unique_ptr<IRenderer> pRenderer) noexcept;
+
+		// Starts the host thread, which keeps running (even without instances) until JoinForShutdown.
+		void Start() noexcept;
+
+		// Lets the host thread end once every instance ended, and blocks until it did. Does nothing if the host never started.
+		void JoinForShutdown() noexcept;
+	public:
+		[[nodiscard]] inline Threading::WorkerPool& WorkerPool() noexcept { return m_WorkerPool; }
+	private:
+		struct Instance
+		{
+			std::unique_ptr<IRenderer> pRenderer;
+			double frameMillis = 0.0;
+			double nextFrameMillis = 0.0;
+			bool isDetached = false;
+		};
+	private:
+		void HostLoop() noexcept;
+		void AttachPending() noexcept;
+	private:
+		Threading::ThreadTopology m_ThreadTopology;
+		Threading::WorkerPool m_WorkerPool;
+	#ifndef CTM_NO_DX
+		CTMDirectX::Graphics::DXSharedResources m_DXSharedResources;
+	#endif
+		Timer::Timer m_Timer;
+		std::vector<Instance> m_Instances; // Only touched by the host thread once started.
+		std::vector<Instance> m_PendingInstances; // Guarded by m_Mutex.
+		std::thread m_HostThread;
+		std::mutex m_Mutex;
+		std::condition_variable m_CV;
+		std::atomic_bool m_IsStarted = false;
+		bool m_IsStopRequested = false; // Guarded by m_Mutex.
+	private:
+		RendererHost(const RendererHost&) = delete;
+		RendererHost(RendererHost&&) = delete;
+		RendererHost& operator=(const RendererHost&) = delete;
+		RendererHost& operator=(RendererHost&&) = delete;
+	};
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/FrameGraph.hpp"
+#include "CTMRenderer/DamageTracker.hpp"
+#include "CTMRenderer/TestScene.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+
+namespace CTMRenderer
+{
+	// Shapes drawn over the test scene's rects by the analytic shape pipeline.
+	using TestShapes = std::array<CTMDirectX::Graphics::ShapeInstanceData, 2>;
+
+	// What a backend submits for each pass of a SceneFrame. Each is called once per frame, and reads the frame's damage rects.
+	struct SceneFramePasses
+	{
+		std::function<void()> Clear;
+		std::function<void()> Rects;  // S_TEST_SCENE's instances.
+		std::function<void()> Shapes; // The frame's ShapeInstances.
+		std::function<void()> Text;   // Empty declares no text pass, so views without text never initialize anything for it.
+	};
+
+	/* The device-independent half of a frame of the test scene, shared by the DirectX and null backends.
+	 *
+	 * Declares the frame graph, (Clear, Rects, Shapes and Text, all over the back buffer) builds the shape batch and
+	 * resolves each frame's damage into the rects every pass clears and draws through. Backends only submit what each
+	 * pass asks for, to a device or to a NullDrawSink, so the CPU side of a frame runs alike with and without a GPU. */
+	class SceneFrame
+	{
+	public:
+		SceneFrame(const CTMDirectX::Window::Geometry::WindowArea& targetAreaRef, SceneFramePasses passes) noexcept;
+		~SceneFrame() = default;
+	public:
+		// Builds the shape batch. Touches no device state, so it's safe to call from any thread.
+		void BuildBatches() noexcept;
+
+		// Resolves the frame's damage for a target whose content is bufferAge frames old. (0 for unknown content)
+		void Begin(unsigned int bufferAge) noexcept;
+
+		// Executes the frame graph. Every pass submits through an immediate context, so all of them run on the calling thread.
+		void Execute(Threading::WorkerPool& pool) noexcept;
+	public:
+		// This frame's damage rects, the whole target on a full redraw.
+		[[nodiscard]] inline const std::vector<DamageRect>& DamageRects() const noexcept { return m_DamageRects; }
+		[[nodiscard]] inline const TestShapes& ShapeInstances() const noexcept { return m_Shapes; }
+		[[nodiscard]] inline const FrameGraph& Graph() const noexcept { return m_FrameGraph; }
+
+		// Whatever changes what's drawn adds the target pixels it touches, to be redrawn from the next frame on.
+		[[nodiscard]] inline DamageTracker& Damage() noexcept { return m_Damage; }
+	private:
+		const CTMDirectX::Window::Geometry::WindowArea& m_TargetAreaRef;
+		TestShapes m_Shapes = {};
+		DamageTracker m_Damage;
+		std::vector<DamageRect> m_DamageRects;
+		FrameGraph m_FrameGraph;
+	private:
+		SceneFrame(const SceneFrame&) = delete;
+		SceneFrame(SceneFrame&&) = delete;
+		SceneFrame& operator=(const SceneFrame&) = delete;
+		SceneFrame& operator=(SceneFrame&&) = delete;
+	};
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/Affine2D.hpp"
+
+namespace CTMRenderer
+{
+	/* Refers to a node of a SceneGraph. Like ShapeHandle, a handle outlives its node safely : the graph rejects
+	 * handles of removed nodes instead of reaching whichever node reuses the index. */
+	struct SceneNode
+	{
+		uint32_t index = 0;
+		uint32_t generation = 0;
+
+		[[nodiscard]] bool operator==(const SceneNode&) const noexcept = default;
+	};
+
+	// A run of depth orders [first, end) whose world transforms were recomputed, a subtree.
+	struct SceneRange
+	{
+		uint32_t first = 0;
+		uint32_t end = 0;
+	};
+
+	// Work of the last SceneGraph update.
+	struct SceneStats
+	{
+		bool isRelayout = false;  // The hierarchy changed, so every node was laid out and recomputed.
+		size_t updatedNodes = 0;  // World transforms recomputed.
+		size_t updatedRanges = 0; // Dirty subtrees recomputed.
+	};
+
+	/* A retained hierarchy of nodes, each with a local transform relative to its parent, caching world transforms.
+	 *
+	 * Nodes are laid out depth first in flat arrays, so every subtree is a contiguous run of depth orders starting at
+	 * its root, and every parent comes before its children. SetLocal only marks the node dirty. Update then recomputes
+	 * each dirty subtree in one linear pass over its run, every world transform combining the parent's, already
+	 * computed, with the local one. Nodes outside dirty subtrees aren't touched, however large the graph is.
+	 *
+	 * Adding, removing and reparenting nodes changes the layout, which the next Update rebuilds in full,
+	 * recomputing every world transform. Hierarchies are expected to change far less often than transforms. */
+	class SceneGraph
+	{
+	public:
+		SceneGraph() noexcept;
+		~SceneGraph() = default;
+	public:
+		// Adds a node as the last child of parent, drawn after its siblings.
+		SceneNode Add(SceneNode parent, const Affine2D& local = {}) noexcept;
+
+		// Each returns false, changing nothing, if a handle doesn't refer to a live node.
+		// Removes the node and all of its descendants. The root can't be removed.
+		bool Remove(SceneNode node) noexcept;
+		// Moves a node with its descendants to the end of another parent's children, keeping its local transform.
+		// The new parent can't be the node or one of its descendants.
+		bool SetParent(SceneNode node, SceneNode parent) noexcept;
+		bool SetLocal(SceneNode node, const Affine2D& local) noexcept;
+
+		// Lays out the hierarchy if it changed and recomputes the world transforms of dirty subtrees.
+		void Update() noexcept;
+
+		void Reserve(size_t count) noexcept;
+	public:
+		[[nodiscard]] inline bool IsAlive(SceneNode node) const noexcept { return (node.generation & 1) != 0 && node.index < m_Nodes.size() && m_Nodes[node.index].generation == node.generation; }
+
+		// The root, parent of every top level node. Its local transform applies to the whole graph.
+		[[nodiscard]] inline SceneNode Root() const noexcept { return { 0, m_Nodes[0].generation }; }
+		[[nodiscard]] inline size_t Size() const noexcept { return m_Size; }
+
+		// Node must be live. The root is its own parent.
+		[[nodiscard]] inline SceneNode Parent(SceneNode node) const noexcept { const uint32_t parent = m_Nodes[node.index].parent; return { parent, m_Nodes[parent].generation }; }
+		[[nodiscard]] inline const Affine2D& Local(SceneNode node) const noexcept { return m_Nodes[node.index].local; }
+
+		// Accessors below reflect the last Update, and need one after any change to the hierarchy.
+		// World transform of a live node.
+		[[nodiscard]] inline const Affine2D& World(SceneNode node) const noexcept { return m_Worlds[OrderOf(node)]; }
+
+		// Position of a live node in depth order, the root being 0.
+		[[nodiscard]] inline uint32_t OrderOf(SceneNode node) const noexcept { return m_Nodes[node.index].order; }
+		[[nodiscard]] inline SceneNode NodeAt(uint32_t order) const noexcept { return { m_OrderNodes[order], m_Nodes[m_OrderNodes[order]].generation }; }
+
+		// End of the run of depth orders a node's subtree covers.
+		[[nodiscard]] inline uint32_t SubtreeEnd(uint32_t order) const noexcept { return m_SubtreeEnds[order]; }
+
+		// World transforms of every node, in depth order.
+		[[nodiscard]] inline const Affine2D* Worlds() const noexcept { return m_Worlds.data(); }
+
+		// Subtrees the last Update recomputed, in depth order, so consumers can refresh only what depends on them.
+		[[nodiscard]] inline const std::vector<SceneRange>& UpdatedRanges() const noexcept { return m_UpdatedRanges; }
+		[[nodiscard]] inline const SceneStats& Stats() const noexcept { return m_Stats; }
+	private:
+		struct Node
+		{
+			// Sibling links also chain free nodes, through nextSibling.
+			uint32_t parent = 0;
+			uint32_t firstChild = S_NO_NODE;
+			uint32_t lastChild = S_NO_NODE;
+			uint32_t previousSibling = S_NO_NODE;
+			uint32_t nextSibling = S_NO_NODE;
+			uint32_t generation = 1; // Odd while the node is live, so handles of free nodes never match.
+			uint32_t order = 0;
+			Affine2D local;
+		};
+	private:
+		static constexpr uint32_t S_NO_NODE = UINT32_MAX;
+	private:
+		void Link(uint32_t index, uint32_t parent) noexcept;
+		void Unlink(uint32_t index) noexcept;
+
+		// Rebuilds the depth ordered arrays from the links and recomputes every world transform.
+		void Relayout() noexcept;
+		void UpdateRange(uint32_t first, uint32_t end) noexcept;
+	private:
+		std::vector<Node> m_Nodes;
+		uint32_t m_FirstFreeNode = S_NO_NODE;
+		size_t m_Size = 1;
+
+		// Indexed by depth order.
+		std::vector<uint32_t> m_OrderNodes;
+		std::vector<uint32_t> m_OrderParents; // Depth order of the parent, the root's being its own.
+		std::vector<uint32_t> m_SubtreeEnds;
+		std::vector<Affine2D> m_Locals;       // Copies of the nodes' local transforms, read linearly by Update.
+		std::vector<Affine2D> m_Worlds;
+		std::vector<uint8_t> m_IsDirty;
+
+		std::vector<uint32_t> m_DirtyOrders;
+		bool m_IsLayoutDirty = false;
+
+		std::vector<SceneRange> m_UpdatedRanges;
+		SceneStats m_Stats;
+	};
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXShape.hpp"
+
+namespace CTMRenderer
+{
+	/* Refers to a shape of a ShapeRegistry. A handle outlives its shape safely : once the shape is removed, the
+	 * generation of its slot moves on, and the registry rejects the handle instead of reaching whichever shape
+	 * reuses the slot. Default constructed handles never refer to a shape. */
+	struct ShapeHandle
+	{
+		uint32_t slot = 0;
+		uint32_t generation = 0;
+
+		[[nodiscard]] bool operator==(const ShapeHandle&) const noexcept = default;
+	};
+
+	/* Stores rects as dense columns of bounds and colors, without a vtable or derived values per shape.
+	 *
+	 * Handles index a sparse array of slots pointing into the columns, so adding, removing and updating a shape are O(1).
+	 * Removing moves the last shape into the hole, keeping the columns packed : Batch always covers exactly the live
+	 * shapes, ready to be swept by BuildInstances. Removal reorders the columns, so renderers keeping draw order across
+	 * churn sort by Sequence instead. */
+	class ShapeRegistry
+	{
+	public:
+		ShapeRegistry() = default;
+		~ShapeRegistry() = default;
+	public:
+		// Rects must not be empty.
+		ShapeHandle Add(float left, float top, float right, float bottom, const CTMDirectX::Graphics::DXColor& color) noexcept;
+		ShapeHandle Add(CTMDirectX::Graphics::Geometry::DXRect& rect) noexcept;
+
+		// Each returns false, changing nothing, if the handle doesn't refer to a live shape.
+		bool Remove(ShapeHandle handle) noexcept;
+		bool SetBounds(ShapeHandle handle, float left, float top, float right, float bottom) noexcept;
+		bool SetColor(ShapeHandle handle, const CTMDirectX::Graphics::DXColor& color) noexcept;
+
+		// Removes every shape, invalidating every handle.
+		void Clear() noexcept;
+		void Reserve(size_t count) noexcept;
+
+		// The packed columns of every live shape. Invalidated by Add, Remove and Clear.
+		[[nodiscard]] RectBatch Batch() const noexcept;
+	public:
+		[[nodiscard]] inline bool IsAlive(ShapeHandle handle) const noexcept { return (handle.generation & 1) != 0 && handle.slot < m_Slots.size() && m_Slots[handle.slot].generation == handle.generation; }
+		[[nodiscard]] inline size_t Size() const noexcept { return m_Colors.size(); }
+
+		// Position of a live shape in the columns, which changes when other shapes are removed.
+		[[nodiscard]] inline size_t DenseIndex(ShapeHandle handle) const noexcept { return m_Slots[handle.slot].denseIndex; }
+
+		// Order a live shape was added in, increasing with every Add over the registry's lifetime. Moving or recoloring keeps it.
+		[[nodiscard]] inline uint64_t Sequence(ShapeHandle handle) const noexcept { return m_Slots[handle.slot].sequence; }
+
+		// Handle of the shape at a position in the columns.
+		[[nodiscard]] inline ShapeHandle Handle(size_t denseIndex) const noexcept { return { m_DenseSlots[denseIndex], m_Slots[m_DenseSlots[denseIndex]].generation }; }
+	private:
+		struct Slot
+		{
+			uint32_t denseIndex = 0; // Next free slot while the slot is free.
+			uint32_t generation = 1; // Odd while the slot holds a shape, so handles of free slots never match.
+			uint64_t sequence = 0;
+		};
+	private:
+		static constexpr uint32_t S_NO_FREE_SLOT = UINT32_MAX;
+	private:
+		std::vector<Slot> m_Slots;
+		uint32_t m_FirstFreeSlot = S_NO_FREE_SLOT;
+		uint64_t m_NextSequence = 0;
+
+		// Columns, indexed by dense index.
+		std::vector<float> m_Lefts, m_Tops, m_Rights, m_Bottoms;
+		std::vector<CTMDirectX::Graphics::DXColor> m_Colors;
+		std::vector<uint32_t> m_DenseSlots; // Slot of each shape, to repoint the one moved by Remove.
+	};
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// x / 255, rounded to nearest. Exact for every product of two bytes.
+	[[nodiscard]] inline constexpr uint32_t Div255(uint32_t x) noexcept
+	{
+		return (x + 127) / 255;
+	}
+
+	// Converts a straight alpha BGRA8 pixel into premultiplied alpha, the format every blend below expects.
+	[[nodiscard]] inline constexpr uint32_t PremultiplyBGRA8(uint32_t bgra) noexcept
+	{
+		const uint32_t a = bgra >> 24;
+
+		return (a << 24) | (Div255(((bgra >> 16) & 0xFF) * a) << 16) | (Div255(((bgra >> 8) & 0xFF) * a) << 8) | Div255((bgra & 0xFF) * a);
+	}
+
+	/* Premultiplied source-over of one pixel, the reference every blend kernel must match bit for bit.
+	 * The source is first scaled by opacity. Channels saturate at 255, so malformed (non-premultiplied) input can't wrap. */
+	[[nodiscard]] inline constexpr uint32_t BlendOverReference(uint32_t dst, uint32_t src, unsigned char opacity = 255) noexcept
+	{
+		uint32_t result = 0;
+		uint32_t srcChannels[4] = {};
+
+		for (unsigned int channel = 0; channel < 4; ++channel)
+		{
+			srcChannels[channel] = (src >> (channel * 8)) & 0xFF;
+
+			if (opacity != 255)
+				srcChannels[channel] = Div255(srcChannels[channel] * opacity);
+		}
+
+		const uint32_t inverseAlpha = 255 - srcChannels[3];
+
+		for (unsigned int channel = 0; channel < 4; ++channel)
+		{
+			const uint32_t value = srcChannels[channel] + Div255(((dst >> (channel * 8)) & 0xFF) * inverseAlpha);
+			result |= (value < 255 ? value : 255) << (channel * 8);
+		}
+
+		return result;
+	}
+
+	// An offscreen buffer composited onto a target. (e.g. a translucent overlay)
+	struct SWLayer
+	{
+		SWFramebuffer pixels; // Premultiplied alpha.
+		int x = 0, y = 0;     // Position of the layer's top-left pixel in the target.
+		unsigned char opacity = 255;
+		bool isVisible = true;
+	};
+
+	// Composites layer over target at (x, y), clipped to the target, with the active blend kernel.
+	void CompositeOver(SWFramebuffer& target, const SWFramebuffer& layer, int x, int y, unsigned char opacity = 255) noexcept;
+
+	/* Composites visible layers over target, first to last.
+	 * The target is split into row bands composited in parallel, every band applying all layers in order,
+	 * so the result matches compositing the layers one after another on a single thread. */
+	void CompositeLayers(Threading::WorkerPool& pool, SWFramebuffer& target, const std::vector<SWLayer>& layers) noexcept;
+}
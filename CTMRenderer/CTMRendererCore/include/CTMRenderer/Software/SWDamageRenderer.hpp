@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "CTMRenderer/DamageTracker.hpp"
+#include "CTMRenderer/ShapeRegistry.hpp"
+#include "CTMRenderer/SpatialGrid.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Work of the last SWDamageRenderer draw.
+	struct SWDamageStats
+	{
+		bool isFull = false;
+		size_t rects = 0;       // Damage rects cleared and redrawn.
+		uint64_t pixels = 0;    // Pixels cleared.
+		size_t drawnShapes = 0; // Shapes drawn, a shape overlapping n rects counts n times.
+		double drawMillis = 0.0;
+	};
+
+	/* Redraws only the damaged parts of a target holding the shapes of a registry, in target pixels.
+	 *
+	 * Every damage rect is cleared, and the shapes overlapping it, found through the grid, are drawn clipped to it.
+	 * Shapes are drawn in the order they were added to the registry, which unlike the order of its columns doesn't change
+	 * when other shapes are removed : a new shape lands above every older one, even in a reused slot, and pixels outside
+	 * the damage stay valid across churn. Given the damage of every mutation since the target's content was drawn,
+	 * the result is identical to DrawAll. */
+	class SWDamageRenderer
+	{
+	public:
+		SWDamageRenderer() = default;
+		~SWDamageRenderer() = default;
+	public:
+		// The grid must hold exactly the registry's shapes, with the same bounds.
+		void Draw(SWFramebuffer& target, uint32_t clearBgra, const ShapeRegistry& registry, const SpatialGrid& grid, const DamageRegion& damage) noexcept;
+
+		// Clears target and draws every shape.
+		void DrawAll(SWFramebuffer& target, uint32_t clearBgra, const ShapeRegistry& registry) noexcept;
+	public:
+		[[nodiscard]] inline const SWDamageStats& Stats() const noexcept { return m_Stats; }
+	private:
+		std::vector<ShapeHandle> m_Hits;
+		std::vector<std::pair<uint64_t, uint32_t>> m_DrawOrder; // Sequence and dense index of every shape, for DrawAll.
+		SWDamageStats m_Stats;
+	};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+#include "CTMRenderer/Software/SWDeltaSink.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	enum class SWDeltaCompare
+	{
+		HASH,  // Keeps a hash per tile and reads each frame once. A single changed pixel is always found, larger changes are missed with p <= ~2^-32.
+		MEMCMP // Keeps a copy of the previous frame. Exact, at the cost of a frame of memory and reading it back every frame.
+	};
+
+	enum class SWTileEncoding : unsigned char
+	{
+		RAW = 0, // Width x height BGRA8 pixels, row by row.
+		RLE = 1  // Runs of (uint16_t length, BGRA8 pixel), in the same order. Chosen when smaller than RAW.
+	};
+
+	struct SWDeltaSettings
+	{
+		std::shared_ptr<IDeltaSink> Sink; // nullptr encodes nothing.
+		unsigned int TileSize = 64;
+		SWDeltaCompare Compare = SWDeltaCompare::HASH;
+
+		// Every KeyframeInterval-th frame sends every tile, so consumers joining late catch up. 0 only sends a keyframe first
+		// and after the sink failed. (A consumer is out of sync once a packet is lost)
+		uint64_t KeyframeInterval = 0;
+	};
+
+	struct SWDeltaStats
+	{
+		uint64_t frames = 0;
+		uint64_t keyframes = 0;
+		uint64_t tiles = 0;        // Tiles compared.
+		uint64_t changedTiles = 0; // Tiles sent, including every tile of keyframes.
+		uint64_t rleTiles = 0;     // Sent tiles that were RLE encoded.
+		uint64_t bytes = 0;        // Bytes handed to the sink.
+		uint64_t frameBytes = 0;   // Bytes the same frames would take uncompressed, for comparison.
+		uint64_t failedWrites = 0;
+		double encodeMillis = 0.0; // Comparing and encoding, excluding the sink.
+		double sinkMillis = 0.0;
+	};
+
+	/* Packet layout. All integers are little endian, pixels are BGRA8 as in SWFramebuffer memory.
+	 *
+	 *   Header, S_DELTA_HEADER_SIZE bytes:
+	 *     uint32 magic (S_DELTA_MAGIC), uint16 version (S_DELTA_VERSION), uint16 flags (S_DELTA_KEYFRAME),
+	 *     uint64 frame index, uint32 width, uint32 height, uint32 tile size, uint32 tile count
+	 *   Then tile count tiles, S_DELTA_TILE_HEADER_SIZE bytes followed by the payload:
+	 *     uint32 tile id (row major, tiles are cut from the top left and clipped at the frame's edges),
+	 *     uint8 SWTileEncoding, uint32 payload size in bytes */
+	constexpr uint32_t S_DELTA_MAGIC = 0x444D5443u; // "CTMD"
+	constexpr uint16_t S_DELTA_VERSION = 1;
+	constexpr uint16_t S_DELTA_KEYFRAME = 1;
+	constexpr size_t S_DELTA_HEADER_SIZE = 32;
+	constexpr size_t S_DELTA_TILE_HEADER_SIZE = 9;
+
+	// Largest frame width or height ApplyDeltaPacket accepts, so a corrupt header can't make it allocate gigabytes.
+	constexpr unsigned int S_DELTA_MAX_DIMENSION = 16384;
+
+	/* Streams frames as the tiles that changed since the previous frame.
+	 *
+	 * Tiles are compared (by hash or against a copy of the previous frame) and encoded in parallel, then written
+	 * to the sink as one packet per frame. Unchanged frames still send a header, so consumers see every frame index. */
+	class SWDeltaEncoder
+	{
+	public:
+		explicit SWDeltaEncoder(const SWDeltaSettings& settings) noexcept;
+		~SWDeltaEncoder() = default;
+	public:
+		// Sends the changes of frame. Returns false if the sink failed, the next frame is then sent as a keyframe.
+		bool Encode(Threading::WorkerPool& pool, const SWFramebuffer& frame, uint64_t frameIndex) noexcept;
+
+		// Sends the next frame as a keyframe. (e.g. when a new consumer connected)
+		inline void RequestKeyframe() noexcept { m_ForceKeyframe = true; }
+	public:
+		[[nodiscard]] inline const SWDeltaStats& Stats() const noexcept { return m_Stats; }
+		[[nodiscard]] inline const SWDeltaSettings& Settings() const noexcept { return m_Settings; }
+
+		// Returns the packet of the last frame. (Valid until the next Encode)
+		[[nodiscard]] inline const std::vector<unsigned char>& LastPacket() const noexcept { return m_Packet; }
+	private:
+		using TileHash = std::array<uint32_t, S_HASH_LANES>;
+	private:
+		void Resize(unsigned int width, unsigned int height) noexcept;
+
+		// Compares a tile, remembering it for the next frame. Returns true if it changed (or isKeyframe).
+		[[nodiscard]] bool UpdateTile(size_t tile, const SWFramebuffer& frame, bool isKeyframe) noexcept;
+		void EncodeTile(size_t tile, const SWFramebuffer& frame) noexcept;
+	private:
+		SWDeltaSettings m_Settings;
+		unsigned int m_Width = 0, m_Height = 0;
+		unsigned int m_TilesX = 0, m_TilesY = 0;
+		std::vector<TileHash> m_Hashes;                     // Per tile, HASH only.
+		SWFramebuffer m_Previous;                           // MEMCMP only.
+		std::vector<std::vector<unsigned char>> m_Payloads; // Per tile, tile header included. Empty for unchanged tiles.
+		std::vector<unsigned char> m_Packet;
+		SWDeltaStats m_Stats;
+		bool m_ForceKeyframe = true;
+	private:
+		SWDeltaEncoder(const SWDeltaEncoder&) = delete;
+		SWDeltaEncoder(SWDeltaEncoder&&) = delete;
+		SWDeltaEncoder& operator=(const SWDeltaEncoder&) = delete;
+		SWDeltaEncoder& operator=(SWDeltaEncoder&&) = delete;
+	};
+
+	/* Applies a packet to target, the reference consumer of the stream. Keyframes resize target to the packet's frame,
+	 * other packets require target to hold the previous frame. Returns false if the packet is malformed, or its frame is
+	 * larger than S_DELTA_MAX_DIMENSION on either axis. */
+	bool ApplyDeltaPacket(const unsigned char* pData, size_t size, SWFramebuffer& target) noexcept;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Destination of an SWDeltaEncoder's stream. Every Write is one complete frame packet.
+	class IDeltaSink
+	{
+	public:
+		IDeltaSink() = default;
+		virtual ~IDeltaSink() = default;
+	public:
+		// Returns false if the packet couldn't be delivered. The encoder then sends a keyframe next.
+		virtual bool Write(const unsigned char* pData, size_t size) noexcept = 0;
+	private:
+		IDeltaSink(const IDeltaSink&) = delete;
+		IDeltaSink(IDeltaSink&&) = delete;
+		IDeltaSink& operator=(const IDeltaSink&) = delete;
+		IDeltaSink& operator=(IDeltaSink&&) = delete;
+	};
+
+	// Appends packets to a file.
+	class FileDeltaSink : public IDeltaSink
+	{
+	public:
+		explicit FileDeltaSink(const std::filesystem::path& path) noexcept;
+		~FileDeltaSink() = default;
+	public:
+		virtual bool Write(const unsigned char* pData, size_t size) noexcept override;
+	public:
+		[[nodiscard]] inline bool IsOpen() const noexcept { return m_File.is_open(); }
+	private:
+		std::ofstream m_File;
+	};
+
+	/* Streams packets over a connected local (AF_UNIX) stream socket. Not available on Windows, where Write always fails.
+	 *
+	 * Writes never block the frame loop : when the reader falls behind and the socket buffer is full, the packet is dropped
+	 * (and the encoder sends a keyframe next). A packet the socket only took part of is finished before the next one. */
+	class UnixSocketDeltaSink : public IDeltaSink
+	{
+	public:
+		explicit UnixSocketDeltaSink(const std::string& socketPath) noexcept;
+		~UnixSocketDeltaSink() noexcept;
+	public:
+		virtual bool Write(const unsigned char* pData, size_t size) noexcept override;
+	public:
+		[[nodiscard]] inline bool IsConnected() const noexcept { return m_Socket >= 0; }
+	private:
+		// Sends from offset on until the socket is full, advancing offset. Returns false if the socket failed.
+		bool Send(const unsigned char* pData, size_t size, size_t& offset) noexcept;
+	private:
+		int m_Socket = -1;
+		std::vector<unsigned char> m_Pending; // The rest of a partly sent packet.
+		size_t m_PendingOffset = 0;
+	};
+
+	// Keeps packets in memory. (e.g. to hand them to a transport of the caller's choosing, or to verify them)
+	class MemoryDeltaSink : public IDeltaSink
+	{
+	public:
+		MemoryDeltaSink() = default;
+		~MemoryDeltaSink() = default;
+	public:
+		virtual bool Write(const unsigned char* pData, size_t size) noexcept override;
+		inline void Clear() noexcept { m_Packets.clear(); }
+	public:
+		[[nodiscard]] inline const std::vector<std::vector<unsigned char>>& Packets() const noexcept { return m_Packets; }
+	private:
+		std::vector<std::vector<unsigned char>> m_Packets;
+	};
+}
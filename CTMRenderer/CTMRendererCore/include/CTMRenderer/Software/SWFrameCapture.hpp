@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Threading/ThreadConfig.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWFrameDump.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	enum class SWCaptureFormat
+	{
+		PPM_SEQUENCE, // <Directory>/frame_<index>.ppm
+		PNG_SEQUENCE, // <Directory>/frame_<index>.png
+		Y4M_STREAM    // <Directory>/capture.y4m
+	};
+
+	struct SWCaptureSettings
+	{
+		uint64_t Interval = 0; // Every Interval-th frame is captured. 0 captures nothing.
+		SWCaptureFormat Format = SWCaptureFormat::PPM_SEQUENCE;
+		std::filesystem::path Directory = "frames";
+
+		// Frames that can wait for the writer at once. Frames arriving while all are in use are dropped, never waited for.
+		unsigned int QueueCapacity = 4;
+
+		unsigned int FrameRate = 60; // Written into Y4M headers.
+		Threading::ThreadPlacement WriterThread = Threading::ThreadPlacement("CTM Capture");
+	};
+
+	struct SWCaptureStats
+	{
+		uint64_t submitted = 0; // Frames offered to Submit.
+		uint64_t dropped = 0;   // Frames rejected since every buffer was queued.
+		uint64_t written = 0;
+		uint64_t failed = 0;    // Frames the writer failed to encode or write.
+		double copyMillis = 0.0;   // Time Submit spent copying, on the frame loop.
+		double encodeMillis = 0.0; // Time the writer spent encoding and writing, off the frame loop.
+	};
+
+	/* Captures frames to disk without the frame loop ever waiting for I/O.
+	 *
+	 * Submit copies the frame into one of QueueCapacity recycled buffers and returns, while a background
+	 * thread encodes queued buffers and hands them back. When the writer falls behind and no buffer is
+	 * free, the frame is dropped and counted instead of stalling the frame loop. */
+	class SWFrameCapture
+	{
+	public:
+		explicit SWFrameCapture(const SWCaptureSettings& settings) noexcept;
+		~SWFrameCapture() noexcept; // Writes every queued frame before returning.
+	public:
+		// Copies the frame if a buffer is free. Returns false if the frame was dropped.
+		bool Submit(const SWFramebuffer& frame, uint64_t frameIndex) noexcept;
+
+		// Blocks until every queued frame was written. (e.g. before reading back the files)
+		void Flush() noexcept;
+
+		[[nodiscard]] SWCaptureStats Stats() const noexcept;
+	public:
+		[[nodiscard]] inline bool ShouldCapture(uint64_t frameIndex) const noexcept { return m_Settings.Interval != 0 && frameIndex % m_Settings.Interval == 0; }
+		[[nodiscard]] inline const SWCaptureSettings& Settings() const noexcept { return m_Settings; }
+	private:
+		struct QueuedFrame
+		{
+			size_t bufferIndex;
+			uint64_t frameIndex;
+		};
+	private:
+		void WriterLoop() noexcept;
+		[[nodiscard]] bool Write(const SWFramebuffer& frame, uint64_t frameIndex) noexcept;
+	private:
+		SWCaptureSettings m_Settings;
+		std::vector<SWFramebuffer> m_Buffers;
+		std::vector<size_t> m_FreeBuffers;
+		std::deque<QueuedFrame> m_Queue;
+		SWY4MWriter m_Y4MWriter; // Only touched by the writer thread.
+		mutable std::mutex m_Mutex;
+		std::condition_variable m_QueueCV;
+		std::condition_variable m_IdleCV;
+		SWCaptureStats m_Stats;
+		bool m_IsWriting = false;
+		bool m_ShouldRun = true;
+		std::thread m_WriterThread;
+	private:
+		SWFrameCapture(const SWFrameCapture&) = delete;
+		SWFrameCapture(SWFrameCapture&&) = delete;
+		SWFrameCapture& operator=(const SWFrameCapture&) = delete;
+		SWFrameCapture& operator=(SWFrameCapture&&) = delete;
+	};
+}
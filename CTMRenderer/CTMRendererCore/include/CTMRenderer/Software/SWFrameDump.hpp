@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Writes the framebuffer as a binary PPM (P6, alpha dropped). Returns false if the file couldn't be written.
+	[[nodiscard]] bool WritePPM(const SWFramebuffer& framebuffer, const std::filesystem::path& path) noexcept;
+
+	/* Writes the framebuffer as an 8 bit RGB PNG. Returns false if the file couldn't be written.
+	 * The image data is stored in uncompressed deflate blocks, trading file size for encoding at memcpy speed. */
+	[[nodiscard]] bool WritePNG(const SWFramebuffer& framebuffer, const std::filesystem::path& path) noexcept;
+
+	// Writes frames into a YUV4MPEG2 stream, converted to 4:2:0 with BT.601 limited range, which most video tools read directly.
+	class SWY4MWriter
+	{
+	public:
+		SWY4MWriter() = default;
+		~SWY4MWriter() = default;
+	public:
+		[[nodiscard]] bool Open(const std::filesystem::path& path, unsigned int width, unsigned int height, unsigned int frameRate) noexcept;
+
+		// The framebuffer must have the size the stream was opened with.
+		[[nodiscard]] bool WriteFrame(const SWFramebuffer& framebuffer) noexcept;
+		void Close() noexcept;
+	public:
+		[[nodiscard]] inline bool IsOpen() const noexcept { return m_File.is_open(); }
+		[[nodiscard]] inline unsigned int Width() const noexcept { return m_Width; }
+		[[nodiscard]] inline unsigned int Height() const noexcept { return m_Height; }
+	private:
+		std::ofstream m_File;
+		unsigned int m_Width = 0, m_Height = 0;
+		std::vector<unsigned char> m_Planes; // Y, U and V of one frame, reused across frames.
+	private:
+		SWY4MWriter(const SWY4MWriter&) = delete;
+		SWY4MWriter(SWY4MWriter&&) = delete;
+		SWY4MWriter& operator=(const SWY4MWriter&) = delete;
+		SWY4MWriter& operator=(SWY4MWriter&&) = delete;
+	};
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	enum class SWRingReuse
+	{
+		ON_RELEASE, // A slot is only rendered into again after the consumer released it. Frames without a free slot are skipped.
+		ROUND_ROBIN // Slots are rendered into in turn, so the consumer must be done with a frame within the ring's length.
+	};
+
+	// Signaled with the index of each published frame, for consumers that wait instead of taking callbacks.
+	class SWFrameFence
+	{
+	public:
+		SWFrameFence() = default;
+		~SWFrameFence() = default;
+	public:
+		void Signal(uint64_t value) noexcept;
+
+		// Blocks until a value >= value was signaled.
+		void Wait(uint64_t value) const noexcept;
+	public:
+		[[nodiscard]] inline uint64_t CompletedValue() const noexcept { return m_Value.load(std::memory_order_acquire); }
+	private:
+		std::atomic<uint64_t> m_Value = 0;
+		mutable std::mutex m_Mutex;
+		mutable std::condition_variable m_CV;
+	private:
+		SWFrameFence(const SWFrameFence&) = delete;
+		SWFrameFence(SWFrameFence&&) = delete;
+		SWFrameFence& operator=(const SWFrameFence&) = delete;
+		SWFrameFence& operator=(SWFrameFence&&) = delete;
+	};
+
+	/* A ring of caller-owned framebuffers the renderer draws into directly.
+	 *
+	 * Every finished frame is published in place, signaling the fence and calling the ready callback with
+	 * the slot it lives in, so consumers (encoders, shared memory viewers) read it without an internal copy. */
+	class SWFrameRing
+	{
+	public:
+		// Called on the rendering thread for every published frame. Keep it short, it's part of the frame.
+		using ReadyCallback = std::function<void(size_t slot, uint64_t frameIndex, const SWFramebuffer& frame)>;
+	public:
+		// Every pointer must address at least stride * height pixels. (stride in pixels, at least width)
+		SWFrameRing(const std::vector<uint32_t*>& slotPixels, unsigned int width, unsigned int height, unsigned int stride,
+			SWRingReuse reuse = SWRingReuse::ON_RELEASE, ReadyCallback readyCallback = nullptr) noexcept;
+		~SWFrameRing() = default;
+	public:
+		// Renderer side. Returns the next slot to render into, or nullptr if it's still held by the consumer.
+		[[nodiscard]] SWFramebuffer* Acquire() noexcept;
+		void Publish(uint64_t frameIndex) noexcept; // Publishes the slot returned by the last Acquire.
+
+		// Consumer side, from any thread. Hands a published slot back to the renderer.
+		void Release(size_t slot) noexcept;
+	public:
+		[[nodiscard]] inline size_t SlotCount() const noexcept { return m_Slots.size(); }
+		[[nodiscard]] inline const SWFramebuffer& Slot(size_t slot) const noexcept { return m_Slots[slot]; }
+		[[nodiscard]] inline const SWFrameFence& Fence() const noexcept { return m_Fence; }
+		[[nodiscard]] inline unsigned int Width() const noexcept { return m_Width; }
+		[[nodiscard]] inline unsigned int Height() const noexcept { return m_Height; }
+
+		// Slot frame n (counting from 1) is published into with ON_RELEASE, as skipped frames don't advance the ring.
+		[[nodiscard]] inline size_t SlotOfFrame(uint64_t frameIndex) const noexcept { return (size_t)((frameIndex - 1) % m_Slots.size()); }
+
+		// Slot of the most recently published frame, for fence waiters. (e.g. Wait(n), then read LatestSlot)
+		[[nodiscard]] inline size_t LatestSlot() const noexcept { return m_LatestSlot.load(std::memory_order_acquire); }
+		[[nodiscard]] inline uint64_t FrameInSlot(size_t slot) const noexcept { return m_pSlotFrames[slot].load(std::memory_order_acquire); }
+
+		// Frames skipped since their slot wasn't released in time. (ON_RELEASE only)
+		[[nodiscard]] inline uint64_t SkippedFrames() const noexcept { return m_SkippedFrames.load(std::memory_order_relaxed); }
+	private:
+		std::vector<SWFramebuffer> m_Slots;
+		std::unique_ptr<std::atomic_bool[]> m_pIsHeld; // Per slot, true from Publish until Release.
+		std::unique_ptr<std::atomic<uint64_t>[]> m_pSlotFrames; // Per slot, index of the frame last published into it.
+		unsigned int m_Width, m_Height;
+		SWRingReuse m_Reuse;
+		ReadyCallback m_ReadyCallback;
+		SWFrameFence m_Fence;
+		size_t m_NextSlot = 0;
+		size_t m_AcquiredSlot = SIZE_MAX;
+		std::atomic<size_t> m_LatestSlot = 0;
+		std::atomic<uint64_t> m_SkippedFrames = 0;
+	private:
+		SWFrameRing(const SWFrameRing&) = delete;
+		SWFrameRing(SWFrameRing&&) = delete;
+		SWFrameRing& operator=(const SWFrameRing&) = delete;
+		SWFrameRing& operator=(SWFrameRing&&) = delete;
+	};
+}
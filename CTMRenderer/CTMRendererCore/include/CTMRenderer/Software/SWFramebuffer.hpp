@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Packs an un-normalized RGBA color into a BGRA8 pixel. (Byte order B, G, R, A in memory, same as DXGI_FORMAT_B8G8R8A8_UNORM)
+	[[nodiscard]] inline constexpr uint32_t PackBGRA8(unsigned char r, unsigned char g, unsigned char b, unsigned char a) noexcept
+	{
+		return ((uint32_t)a << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | (uint32_t)b;
+	}
+
+	[[nodiscard]] inline uint32_t PackBGRA8(const CTMDirectX::Graphics::DXColor& color) noexcept
+	{
+		return PackBGRA8(color.r(), color.g(), color.b(), color.a());
+	}
+
+	[[nodiscard]] inline uint32_t PackBGRA8(const CTMDirectX::Graphics::DXNormColor& color) noexcept
+	{
+		auto toByte = [](float channel) -> unsigned char {
+			channel = channel < 0.0f ? 0.0f : (channel > 1.0f ? 1.0f : channel);
+			return (unsigned char)(channel * 255.0f + 0.5f);
+		};
+
+		return PackBGRA8(toByte(color.r()), toByte(color.g()), toByte(color.b()), toByte(color.a()));
+	}
+
+	// An in-memory BGRA8 render target, either owning its pixels or wrapping caller-owned memory.
+	class SWFramebuffer
+	{
+	public:
+		SWFramebuffer() = default;
+		SWFramebuffer(unsigned int width, unsigned int height) noexcept;
+
+		// Wraps caller-owned memory of at least stride * height pixels, which must outlive the framebuffer.
+		// Copies of a wrapping framebuffer wrap the same memory.
+		SWFramebuffer(uint32_t* pExternalPixels, unsigned int width, unsigned int height, unsigned int stride) noexcept;
+		~SWFramebuffer() = default;
+	public:
+		// Resizes the framebuffer. Contents are undefined afterwards. Storage is only ever grown, so shrinking
+		// and growing back (e.g. through dynamic resolution) doesn't reallocate. Wrapped memory can't be resized.
+		void Resize(unsigned int width, unsigned int height) noexcept;
+		void Clear(uint32_t bgra) noexcept;
+	public:
+		[[nodiscard]] inline unsigned int Width() const noexcept { return m_Width; }
+		[[nodiscard]] inline unsigned int Height() const noexcept { return m_Height; }
+		[[nodiscard]] inline unsigned int Stride() const noexcept { return m_Stride; } // In pixels.
+		[[nodiscard]] inline bool IsExternal() const noexcept { return m_pExternalPixels != nullptr; }
+		[[nodiscard]] inline uint32_t* Data() noexcept { return m_pExternalPixels != nullptr ? m_pExternalPixels : m_Pixels.data(); }
+		[[nodiscard]] inline const uint32_t* Data() const noexcept { return m_pExternalPixels != nullptr ? m_pExternalPixels : m_Pixels.data(); }
+
+		[[nodiscard]] inline uint32_t* Row(unsigned int y) noexcept
+		{
+			RUNTIME_ASSERT(y < m_Height, "Row is out of bounds.\n");
+			return Data() + (size_t)y * m_Stride;
+		}
+
+		[[nodiscard]] inline const uint32_t* Row(unsigned int y) const noexcept
+		{
+			RUNTIME_ASSERT(y < m_Height, "Row is out of bounds.\n");
+			return Data() + (size_t)y * m_Stride;
+		}
+	private:
+		std::vector<uint32_t> m_Pixels;
+		uint32_t* m_pExternalPixels = nullptr;
+		unsigned int m_Width = 0, m_Height = 0;
+		unsigned int m_Stride = 0;
+	};
+
+	// Scales the whole of src onto the whole of dst with nearest neighbour sampling. (Used to upscale reduced resolution frames)
+	void BlitNearest(const SWFramebuffer& src, SWFramebuffer& dst) noexcept;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// A half-open pixel rectangle. [left, right) x [top, bottom)
+	struct SWPixelRect
+	{
+		int left = 0, top = 0, right = 0, bottom = 0;
+
+		[[nodiscard]] inline bool IsEmpty() const noexcept { return right <= left || bottom <= top; }
+	};
+
+	/* CPU implementation of the instanced rect pipeline. (DefaultRectVS.hlsl / DefaultRectPS.hlsl)
+	 *
+	 * Each instance scales and offsets the base quad in screen space, and the screen space is mapped onto the whole
+	 * target like the viewport does on the GPU. Rendering into a target smaller than the screen area therefore
+	 * renders the same scene at a reduced resolution.
+	 *
+	 * Pixels are covered when their center lies inside the rect, with the top-left rule deciding shared edges. */
+	class SWRasterizer
+	{
+	public:
+		SWRasterizer(const CTMDirectX::Window::Geometry::WindowArea& screenAreaRef) noexcept;
+		~SWRasterizer() = default;
+	public:
+		// Sets the quad every instance is expanded from. Defaults to the full screen area.
+		void SetBaseQuad(const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad) noexcept;
+
+		// Rasterizes the instances opaquely, in submission order.
+		void DrawInstances(SWFramebuffer& target, const CTMDirectX::Graphics::InstanceData* pInstances, size_t count) const noexcept;
+
+		// Returns the pixels an instance covers in the target, clipped to the target.
+		[[nodiscard]] SWPixelRect PixelBounds(const CTMDirectX::Graphics::InstanceData& instance, unsigned int targetWidth, unsigned int targetHeight) const noexcept;
+	private:
+		const CTMDirectX::Window::Geometry::WindowArea& m_ScreenAreaRef;
+		float m_QuadLeft = 0, m_QuadTop = 0, m_QuadRight = 0, m_QuadBottom = 0;
+	};
+
+	// Returns the pixels whose centers lie in the screen space rect, with the top-left rule, clipped to the target.
+	[[nodiscard]] SWPixelRect CoveredPixels(float left, float top, float right, float bottom, unsigned int targetWidth, unsigned int targetHeight) noexcept;
+
+	// Fills a pixel rect with a solid color. The rect must be within the target.
+	void FillRect(SWFramebuffer& target, const SWPixelRect& rect, uint32_t bgra) noexcept;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "CTMRenderer/IRenderer.hpp"
+#include "CTMRenderer/FrameGraph.hpp"
+#include "CTMRenderer/TestScene.hpp"
+#include "CTMRenderer/Software/SWRendererSettings.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+#include "CTMRenderer/Software/SWTiledRasterizer.hpp"
+#include "CTMRenderer/Software/SWScaledTarget.hpp"
+#include "CTMRenderer/Software/SWFrameCapture.hpp"
+#include "CTMRenderer/Software/SWDeltaEncoder.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	/* Headless backend rasterizing on the CPU.
+	 *
+	 * Consumes the same InstanceData as DefaultRectVS.hlsl, rendering it into an in-memory BGRA8 framebuffer,
+	 * so frames can be produced (and dumped for verification) on machines without a GPU or display. */
+	class SWRenderer : public IRenderer
+	{
+	public:
+		explicit SWRenderer(const SWRendererSettings& settings);
+
+		// Hosted renderer, sharing the worker pool of a RendererHost.
+		SWRenderer(const SWRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool);
+		~SWRenderer() = default;
+	public:
+		virtual void Step(double elapsedMillis) noexcept override;
+		[[nodiscard]] inline virtual unsigned int TargetFPS() const noexcept override { return m_Settings.TargetFPS; }
+
+		// Synchronously writes the last presented frame. Only call from the thread driving the renderer, or after it ended.
+		[[nodiscard]] bool DumpFrame(const std::filesystem::path& path) const noexcept;
+	public:
+		// Returns the last presented frame. (A slot of the output ring when one is set)
+		[[nodiscard]] inline const SWFramebuffer& Framebuffer() const noexcept { return *m_pLastFrame; }
+		[[nodiscard]] inline uint64_t FrameCount() const noexcept { return m_FrameCount; }
+		[[nodiscard]] inline const SWRendererSettings& Settings() const noexcept { return m_Settings; }
+		[[nodiscard]] inline const SWScaledTarget& ScaledTarget() const noexcept { return m_ScaledTarget; }
+		[[nodiscard]] inline const SWTiledRasterizer& TiledRasterizer() const noexcept { return m_TiledRasterizer; }
+
+		// Totals of the last capture, kept after the renderer ended.
+		[[nodiscard]] inline const SWCaptureStats& CaptureStats() const noexcept { return m_CaptureStats; }
+
+		// Passes of a frame. Capture and delta streaming are culled while off, and otherwise run in parallel.
+		[[nodiscard]] inline const CTMRenderer::FrameGraph& Graph() const noexcept { return m_FrameGraph; }
+
+		// Totals of the delta stream, kept after the renderer ended.
+		[[nodiscard]] inline const SWDeltaStats& DeltaStats() const noexcept { return m_DeltaStats; }
+	protected:
+		virtual void OnStart(const Event::StartEvent* pStartEvent) noexcept override;
+		virtual void OnEnd(const Event::EndEvent* pEndEvent) noexcept override;
+	private:
+		void BuildFrameGraph() noexcept;
+		void DoFrame(SWFramebuffer& output) noexcept;
+	private:
+		SWRendererSettings m_Settings;
+		CTMDirectX::Window::Geometry::WindowArea m_ScreenArea;
+		SWRasterizer m_Rasterizer;
+		SWTiledRasterizer m_TiledRasterizer;
+		SWScaledTarget m_ScaledTarget;
+		SWFramebuffer m_Framebuffer; // Unused while rendering into an output ring.
+		const SWFramebuffer* m_pLastFrame = &m_Framebuffer;
+		std::unique_ptr<SWFrameCapture> m_pCapture; // nullptr while capturing is off.
+		SWCaptureStats m_CaptureStats;
+		std::unique_ptr<SWDeltaEncoder> m_pDeltaEncoder; // nullptr while streaming is off.
+		SWDeltaStats m_DeltaStats;
+		CTMRenderer::FrameGraph m_FrameGraph;
+		SWFramebuffer* m_pFrameOutput = nullptr; // Output of the frame being executed.
+		uint32_t m_ClearColor;
+		uint64_t m_FrameCount = 0;
+	private:
+		SWRenderer(const SWRenderer&) = delete;
+		SWRenderer(SWRenderer&&) = delete;
+		SWRenderer& operator=(const SWRenderer&) = delete;
+		SWRenderer& operator=(SWRenderer&&) = delete;
+	};
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "Threading/ThreadConfig.hpp"
+#include "CTMRenderer/DynamicResolution.hpp"
+#include "CTMRenderer/Software/SWFrameCapture.hpp"
+#include "CTMRenderer/Software/SWFrameRing.hpp"
+#include "CTMRenderer/Software/SWDeltaEncoder.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	struct SWRendererSettings
+	{
+		inline SWRendererSettings(unsigned int targetFPS, const Threading::ThreadTopology& threads = {})
+			: TargetFPS(targetFPS), Threads(threads) {}
+
+		unsigned int TargetFPS; // 0 runs frames back to back.
+		Threading::ThreadTopology Threads;
+
+		// Size of the framebuffer and the screen the scene is prepared for.
+		unsigned int Width = 800;
+		unsigned int Height = 600;
+
+		// Size of the tiles the framebuffer is split into for multithreaded rasterization. 0 rasterizes on the event thread alone.
+		unsigned int TileSize = 64;
+
+		uint64_t MaxFrames = 0; // The renderer ends itself after this many frames. 0 runs until ended externally.
+
+		// Lowers the internal resolution when frames run over their budget. (Ignored when unpaced)
+		bool UseDynamicResolution = false;
+
+		// A TargetFrameMillis of 0, the default here, budgets frames to TargetFPS. Anything else overrides it.
+		DynamicResolutionSettings DynamicResolution = DynamicResolutionSettings(0.0);
+
+		// Caller-owned framebuffers (of Width x Height) frames are rendered into and published from. nullptr renders into an internal framebuffer.
+		std::shared_ptr<SWFrameRing> OutputRing;
+
+		// Finished frames are captured to disk in the background. (Off while Capture.Interval is 0)
+		SWCaptureSettings Capture;
+
+		// Every frame's changed tiles are streamed to Delta.Sink, on the frame loop. (Off while Delta.Sink is nullptr)
+		SWDeltaSettings Delta;
+	};
+}
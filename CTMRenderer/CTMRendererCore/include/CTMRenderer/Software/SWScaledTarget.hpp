@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CTMRenderer/DynamicResolution.hpp"
+#include "CTMRenderer/DirectX/Window/DXWindowGeometry.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	/* Offscreen render target whose resolution follows a DynamicResolution controller.
+	 *
+	 * Frames are rendered into a target scaled from the window area, then upscaled into the output.
+	 * At full scale the output is rendered into directly, so no resolve is paid. */
+	class SWScaledTarget
+	{
+	public:
+		SWScaledTarget(const CTMDirectX::Window::Geometry::WindowArea& windowAreaRef, const DynamicResolutionSettings& settings) noexcept;
+		~SWScaledTarget() = default;
+	public:
+		// Returns the target to render the frame into. (Either the offscreen target or output)
+		[[nodiscard]] SWFramebuffer& BeginFrame(SWFramebuffer& output) noexcept;
+
+		// Upscales the frame into output if needed, and feeds the frame's cost back into the controller.
+		void EndFrame(SWFramebuffer& output, double frameMillis) noexcept;
+	public:
+		[[nodiscard]] inline DynamicResolution& Controller() noexcept { return m_Controller; }
+		[[nodiscard]] inline const DynamicResolution& Controller() const noexcept { return m_Controller; }
+		[[nodiscard]] inline bool IsScaled() const noexcept { return m_RenderingOffscreen; }
+
+		// The last scaled frame, before it was upscaled into the output. (Only meaningful while IsScaled)
+		[[nodiscard]] inline const SWFramebuffer& Offscreen() const noexcept { return m_Offscreen; }
+	private:
+		const CTMDirectX::Window::Geometry::WindowArea& m_WindowAreaRef;
+		DynamicResolution m_Controller;
+		SWFramebuffer m_Offscreen;
+		bool m_RenderingOffscreen = false;
+	};
+}
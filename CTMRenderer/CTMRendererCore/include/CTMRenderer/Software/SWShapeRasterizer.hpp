@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Signed distance from (x, y) to a box centered on the origin with rounded corners. Negative inside. (Same as RoundedBoxDistance in util.hlsl)
+	[[nodiscard]] inline float RoundedBoxDistance(float x, float y, float halfWidth, float halfHeight, float radius) noexcept
+	{
+		const float qx = std::fabs(x) - halfWidth + radius;
+		const float qy = std::fabs(y) - halfHeight + radius;
+		const float outsideX = qx > 0.0f ? qx : 0.0f;
+		const float outsideY = qy > 0.0f ? qy : 0.0f;
+		const float inside = qx > qy ? qx : qy;
+
+		return std::sqrt(outsideX * outsideX + outsideY * outsideY) + (inside < 0.0f ? inside : 0.0f) - radius;
+	}
+
+	/* Draws analytic shapes (ShapeInstanceData) with antialiased edges, matching ShapePS.hlsl.
+	 *
+	 * Coverage is the signed distance at each pixel's center, clamped to one pixel of falloff, and shapes are blended
+	 * premultiplied over the target in submission order. Each row is clipped to the shape's extent, and the pixels
+	 * the fill fully covers are filled (or blended) as one span, so only the edges evaluate the distance. */
+	void DrawShapes(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept;
+
+	// Same as above, only touching the pixels within the scissor rect. (Like RSSetScissorRects)
+	void DrawShapes(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count, const SWPixelRect& scissor) noexcept;
+
+	// Splits the target into row bands drawn in parallel. Every band draws all shapes in order, so the result matches DrawShapes.
+	void DrawShapes(Threading::WorkerPool& pool, SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept;
+
+	// Evaluates the distance at every pixel of every shape's bounds. The reference DrawShapes is verified against.
+	void DrawShapesReference(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept;
+}
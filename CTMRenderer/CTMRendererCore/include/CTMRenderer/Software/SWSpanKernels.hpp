@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CTMRenderer::CTMSoftware
+{
+	enum class SWKernelISA
+	{
+		SCALAR, // Plain loops, kept as the reference the vector kernels are verified against.
+		SSE2,
+		AVX2,
+		AVX512  // AVX-512 F and BW.
+	};
+
+	// Span operations every software path is built on.
+	struct SWSpanKernels
+	{
+		SWKernelISA isa;
+		const char* name;
+
+		// Fills count pixels starting at pDst.
+		void (*FillSpan)(uint32_t* pDst, size_t count, uint32_t bgra) noexcept;
+
+		// Fills width x height pixels starting at pDst, with rows stride pixels apart.
+		void (*FillRect)(uint32_t* pDst, size_t stride, size_t width, size_t height, uint32_t bgra) noexcept;
+
+		// Blends count premultiplied pixels of pSrc, scaled by opacity, over pDst. (Matches BlendOverReference exactly)
+		void (*BlendSpan)(uint32_t* pDst, const uint32_t* pSrc, size_t count, unsigned char opacity) noexcept;
+
+		/* Absorbs count pixels of pSrc into S_HASH_LANES running hashes, pixel i going into lane i % S_HASH_LANES.
+		 * Every step is invertible, so a single changed pixel always changes the result. Every ISA produces the same lanes.
+		 * Lanes are independent, so wide kernels keep several multiplies in flight instead of waiting on each one. */
+		void (*HashSpan)(uint32_t* pLanes, const uint32_t* pSrc, size_t count) noexcept;
+	};
+
+	constexpr size_t S_HASH_LANES = 32;
+
+	// Returns the kernels in use. The widest kernels the CPU supports are selected on first call.
+	// Kernels are static, so references stay valid after switching with SelectSpanKernels.
+	[[nodiscard]] const SWSpanKernels& ActiveSpanKernels() noexcept;
+
+	// Returns the kernels of an instruction set, or nullptr if they weren't compiled in or the CPU doesn't support them.
+	[[nodiscard]] const SWSpanKernels* SpanKernels(SWKernelISA isa) noexcept;
+
+	// Switches the active kernels. (e.g. to SCALAR for verification) Returns false, keeping the current ones, if isa isn't supported.
+	bool SelectSpanKernels(SWKernelISA isa) noexcept;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Threading/WorkerPool.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	// Timings of the last SWTiledRasterizer::Draw.
+	struct SWTiledStats
+	{
+		double binMillis = 0.0;
+		double rasterMillis = 0.0;
+		size_t binJobs = 0;
+		size_t tiles = 0;
+		size_t binnedRects = 0;   // Rect-tile pairs, a rect spanning n tiles counts n times.
+		size_t occludedRects = 0; // Rect-tile pairs skipped since a later rect covered the whole tile.
+	};
+
+	/* Multithreaded front end of SWRasterizer.
+	 *
+	 * Draws run in two parallel passes. Binning splits the instances into consecutive chunks, and each chunk sorts
+	 * its rects into per-tile lists of its own. Rasterizing then walks every tile independently, clearing it and
+	 * filling the rects of each chunk's list in chunk order, so submission order holds inside every tile.
+	 * Tiles never share pixels, so neither pass needs a lock on the framebuffer or the bins. */
+	class SWTiledRasterizer
+	{
+	public:
+		static constexpr unsigned int S_DEFAULT_TILE_SIZE = 64;
+	public:
+		SWTiledRasterizer(const SWRasterizer& rasterizerRef, unsigned int tileSize = S_DEFAULT_TILE_SIZE) noexcept;
+		~SWTiledRasterizer() = default;
+	public:
+		// Clears target and draws the instances, rendering identically to Clear + SWRasterizer::DrawInstances.
+		void Draw(Threading::WorkerPool& pool, SWFramebuffer& target, uint32_t clearBgra, const CTMDirectX::Graphics::InstanceData* pInstances, size_t count) noexcept;
+	public:
+		[[nodiscard]] inline unsigned int TileSize() const noexcept { return m_TileSize; }
+		[[nodiscard]] inline const SWTiledStats& Stats() const noexcept { return m_Stats; }
+	private:
+		struct BinnedRect
+		{
+			SWPixelRect rect;
+			uint32_t bgra;
+		};
+	private:
+		void Resize(unsigned int targetWidth, unsigned int targetHeight, size_t binJobs) noexcept;
+		void BinChunk(size_t job, unsigned int targetWidth, unsigned int targetHeight, const CTMDirectX::Graphics::InstanceData* pInstances, size_t first, size_t last) noexcept;
+		void RasterTile(size_t tile, SWFramebuffer& target, uint32_t clearBgra) noexcept;
+		[[nodiscard]] inline std::vector<BinnedRect>& Bin(size_t job, size_t tile) noexcept { return m_Bins[job * m_TileCount + tile]; }
+	private:
+		const SWRasterizer& m_RasterizerRef;
+		unsigned int m_TileSize;
+		unsigned int m_TilesX = 0, m_TilesY = 0;
+		size_t m_TileCount = 0;
+		size_t m_BinJobs = 0;
+		std::vector<std::vector<BinnedRect>> m_Bins; // [job * m_TileCount + tile], capacity is kept across frames.
+		std::vector<size_t> m_OccludedPerTile;
+		SWTiledStats m_Stats;
+	};
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CTMRenderer/ShapeRegistry.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	/* A uniform grid over shape bounds, answering what lies under a point or within a rect without looking at
+	 * every shape. (e.g. hover and click handling)
+	 *
+	 * Each cell lists the bounds of the shapes overlapping it, so a point query reads one short contiguous list.
+	 * Shapes outside the grid's area are kept in the border cells, so they are still found, only less efficiently.
+	 * Moving a shape within the cells it already overlaps only rewrites its bounds. Otherwise just the cells
+	 * it leaves or enters are touched. Cells should be about the size of a typical shape. */
+	class SpatialGrid
+	{
+	public:
+		SpatialGrid(float width, float height, float cellSize = 32.0f) noexcept;
+		~SpatialGrid() = default;
+	public:
+		// Bounds are half open : a shape contains x if left <= x < right. Rects must not be empty.
+		void Insert(ShapeHandle handle, float left, float top, float right, float bottom) noexcept;
+		void Insert(ShapeHandle handle, const CTMDirectX::Graphics::Geometry::DXAABB& aabb) noexcept;
+
+		// Each returns false, changing nothing, if the handle isn't in the grid.
+		bool Update(ShapeHandle handle, float left, float top, float right, float bottom) noexcept;
+		bool Remove(ShapeHandle handle) noexcept;
+
+		void Clear() noexcept;
+
+		// Appends the handle of every shape containing the point to hits, in no particular order. Returns how many were appended.
+		// Mouse positions are pixels, so querying their center (PosX() + 0.5f) matches what was drawn there.
+		size_t QueryPoint(float x, float y, std::vector<ShapeHandle>& hits) const noexcept;
+
+		// Appends the handle of every shape overlapping the rect to hits once, in no particular order. Returns how many were appended.
+		size_t QueryRect(float left, float top, float right, float bottom, std::vector<ShapeHandle>& hits) const noexcept;
+	public:
+		[[nodiscard]] inline bool Contains(ShapeHandle handle) const noexcept { return handle.slot < m_Entries.size() && m_Entries[handle.slot].isPresent && m_Entries[handle.slot].handle == handle; }
+		[[nodiscard]] inline size_t Size() const noexcept { return m_Size; }
+		[[nodiscard]] inline float CellSize() const noexcept { return m_CellSize; }
+	private:
+		// Range of cells covered, both ends inclusive.
+		struct CellRange
+		{
+			int firstX, firstY, lastX, lastY;
+
+			[[nodiscard]] bool operator==(const CellRange&) const noexcept = default;
+		};
+
+		struct Entry
+		{
+			ShapeHandle handle;
+			CellRange cells;
+			bool isPresent = false;
+		};
+
+		// Bounds and handle are copied into every cell, so queries never leave the cell's list.
+		struct CellEntry
+		{
+			float left, top, right, bottom;
+			ShapeHandle handle;
+		};
+	private:
+		[[nodiscard]] int CellX(float x) const noexcept;
+		[[nodiscard]] int CellY(float y) const noexcept;
+		[[nodiscard]] CellRange Cells(float left, float top, float right, float bottom) const noexcept;
+		[[nodiscard]] inline std::vector<CellEntry>& Cell(int x, int y) noexcept { return m_Cells[(size_t)y * m_CellsX + x]; }
+		[[nodiscard]] inline const std::vector<CellEntry>& Cell(int x, int y) const noexcept { return m_Cells[(size_t)y * m_CellsX + x]; }
+	private:
+		float m_CellSize;
+		float m_InverseCellSize;
+		int m_CellsX, m_CellsY;
+		std::vector<std::vector<CellEntry>> m_Cells;
+		std::vector<Entry> m_Entries; // Indexed by handle slot.
+		size_t m_Size = 0;
+	};
+}
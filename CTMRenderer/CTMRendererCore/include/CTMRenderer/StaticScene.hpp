@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "CTMRenderer/DirectX/Graphics/DXColor.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXAABB.hpp"
+
+namespace CTMRenderer
+{
+	// A rect of a static scene, in screen pixels.
+	struct StaticRect
+	{
+		float left = 0, top = 0, right = 0, bottom = 0;
+		CTMDirectX::Graphics::DXColor color = {};
+	};
+
+	// The quad a static scene's instances are expanded from. The unit quad by default, so instances are sizes and corners.
+	struct StaticQuad
+	{
+		float left = 0, top = 0, right = 1, bottom = 1;
+	};
+
+	// The quad as an AABB, as the rasterizers and pipelines take it.
+	[[nodiscard]] inline CTMDirectX::Graphics::Geometry::DXAABB ToAABB(const StaticQuad& quad) noexcept
+	{
+		return CTMDirectX::Graphics::Geometry::DXAABB(quad.left, quad.top, quad.right, quad.bottom);
+	}
+
+	// Instances of a scene known at compile time, ready to upload, e.g. to a DXStrictVertexBuffer of N instances.
+	template <size_t N>
+	struct StaticScene
+	{
+		StaticQuad baseQuad = {};
+		std::array<CTMDirectX::Graphics::InstanceData, N> instances = {};
+	};
+
+	// Never defined : calling it while baking a scene stops compilation, naming the mistake.
+	void StaticRectMustNotBeEmpty() noexcept;
+	void StaticQuadMustNotBeEmpty() noexcept;
+
+	// The instance placing baseQuad onto the rect, with the same math, and so the same bits, as BuildInstancesReference.
+	[[nodiscard]] consteval CTMDirectX::Graphics::InstanceData BakeInstance(const StaticRect& rect, const StaticQuad& baseQuad) noexcept
+	{
+		if (!(rect.right > rect.left && rect.bottom > rect.top))
+			StaticRectMustNotBeEmpty();
+
+		CTMDirectX::Graphics::InstanceData instance;
+		instance.scalarXY = { (rect.right - rect.left) * (1.0f / (baseQuad.right - baseQuad.left)), (rect.bottom - rect.top) * (1.0f / (baseQuad.bottom - baseQuad.top)) };
+		instance.offsetXY = { rect.left - baseQuad.left, rect.top - baseQuad.top };
+		instance.color = rect.color;
+
+		return instance;
+	}
+
+	/* Bakes rects, in draw order, into instances at compile time, so static content described in code costs no work at
+	 * startup and lands in read-only data. e.g.
+	 *     constexpr auto S_CHROME = BakeScene({ StaticRect{ 0, 0, 1920, 32, DXColor(40, 40, 40, 255) }, ... }); */
+	template <size_t N>
+	[[nodiscard]] consteval StaticScene<N> BakeScene(const StaticRect (&rects)[N], const StaticQuad& baseQuad = {}) noexcept
+	{
+		if (!(baseQuad.right > baseQuad.left && baseQuad.bottom > baseQuad.top))
+			StaticQuadMustNotBeEmpty();
+
+		StaticScene<N> scene;
+		scene.baseQuad = baseQuad;
+
+		for (size_t i = 0; i < N; ++i)
+			scene.instances[i] = BakeInstance(rects[i], baseQuad);
+
+		return scene;
+	}
+}
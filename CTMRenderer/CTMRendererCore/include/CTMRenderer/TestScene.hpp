@@ -0,0 +1,13 @@
+#pragma once
+
+#include "CTMRenderer/StaticScene.hpp"
+
+namespace CTMRenderer
+{
+	/* The scene every backend renders for now : two rects instanced from the unit quad. Baked at compile time, so it doesn't
+	 * depend on the screen area, and read in place by every backend, as a single read-only object shared across the program. */
+	inline constexpr StaticScene<2> S_TEST_SCENE = BakeScene({
+		StaticRect{ 100, 100, 300, 300, CTMDirectX::Graphics::DXColor(CTMDirectX::Graphics::DXColorType::RED) },
+		StaticRect{ 450, 250, 700, 500, CTMDirectX::Graphics::DXColor(CTMDirectX::Graphics::DXColorType::GREEN) }
+	});
+}
@@ -5,13 +5,19 @@
 #include <string>
 #include <iostream>
 
+#ifdef _MSC_VER
+#define DEBUG_BREAK()			__debugbreak()
+#else
+#define DEBUG_BREAK()			__builtin_trap()
+#endif
+
 #define DO_WRAP(x)              do { x } while(0)
 #define IF_DEBUG(x)				x
 #define DEBUG_PRINT(msg)		std::cout << "[DEBUG_PRINT] " << msg 
 #define DEBUG_PRINT_ERROR(msg)	std::cout << "[DEBUG_PRINT_ERROR] " << msg
 #define DEBUG_ERROR(msg, code)	DO_WRAP( \
 									DEBUG_PRINT_ERROR(msg); \
-									__debugbreak();\
+									DEBUG_BREAK();\
 									exit(code); \
 								)
 #define RUNTIME_ASSERT(x, msg)	if (!(x)) \
@@ -1,12 +1,15 @@
 #pragma once
 
+#ifdef _WIN32
 // Include Windows stuff.
 #include "Core/WindowsDefines.hpp"
 #include <Windows.h>
 #include <windowsx.h>
 #include <stringapiset.h> // WideCharToMultiByte in CoreUtility.hpp's TranslateHResult(hResult).
 #include <WinNls.h> // CP_UTF8 for WideCharToMultiByte in CoreUtility.hpp's TranslateHResult(hResult).
+#endif
 
+#ifndef CTM_NO_DX
 // Include Direct3D stuff.
 #include <d3d11.h>
 #include <d3d11_1.h>
@@ -15,6 +18,7 @@
 #include <wrl.h>
 #include <dxgidebug.h>
 #include <DirectXMath.h>
+#endif
 
 // Other C++ utilities used throughout RendererCore.
 #include <iostream>
@@ -32,4 +36,7 @@
 #include <filesystem>
 #include <type_traits>
 #include <initializer_list>
-#include <array>
\ No newline at end of file
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+// Defined when building for x86, where the SIMD paths and cpuid are available.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CTM_X86
+#endif
+
+// MSVC accepts every intrinsic anywhere, GCC and Clang need the instruction set enabled on the function using it.
+#if defined(CTM_X86) && !defined(_MSC_VER)
+#define CTM_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CTM_TARGET(isa)
+#endif
+
+namespace CTMRenderer::Core
+{
+	// Instruction set extensions usable on the running CPU, with OS support for their registers checked.
+	struct CpuFeatures
+	{
+		bool sse2 = false;
+		bool sse41 = false;
+		bool avx2 = false;
+		bool avx512f = false;
+		bool avx512bw = false;
+	};
+
+	// Detected once on first call, then cached.
+	[[nodiscard]] const CpuFeatures& DetectCpuFeatures() noexcept;
+}
@@ -24,10 +24,10 @@ namespace CTMRenderer::Event
 	{
 	public:
 		virtual ~IEvent() = default;
-		virtual constexpr [[nodiscard]] ConcreteEventType ConcreteType() const noexcept = 0;
-		virtual constexpr [[nodiscard]] GenericEventType GenericType() const noexcept = 0;
+		[[nodiscard]] virtual constexpr ConcreteEventType ConcreteType() const noexcept = 0;
+		[[nodiscard]] virtual constexpr GenericEventType GenericType() const noexcept = 0;
 
-		inline static constexpr [[nodiscard]] std::string_view GenericTypeStr(GenericEventType type) noexcept
+		[[nodiscard]] inline static constexpr std::string_view GenericTypeStr(GenericEventType type) noexcept
 		{
 			switch (type)
 			{
@@ -40,7 +40,7 @@ namespace CTMRenderer::Event
 			}
 		}
 
-		inline static constexpr [[nodiscard]] std::string_view ConcreteTypeStr(ConcreteEventType type) noexcept
+		[[nodiscard]] inline static constexpr std::string_view ConcreteTypeStr(ConcreteEventType type) noexcept
 		{
 			switch (type)
 			{
@@ -50,27 +50,27 @@ namespace CTMRenderer::Event
 		}
 	};
 
-	template <typename Derived, ConcreteEventType EnumConcreteTy, GenericEventType EnumGenericTy>
+	template <typename Derived, ConcreteEventType EnumConcreteTyParam, GenericEventType EnumGenericTy>
 	class Event : public IEvent
 	{
 	public:
-		static constexpr ConcreteEventType EnumConcreteTy = EnumConcreteTy;
+		static constexpr ConcreteEventType EnumConcreteTy = EnumConcreteTyParam;
 	public:
 		virtual ~Event() = default;
 	public:
-		inline virtual constexpr [[nodiscard]] ConcreteEventType ConcreteType() const noexcept override { return EnumConcreteTy; }
-		inline virtual constexpr [[nodiscard]] GenericEventType GenericType() const noexcept override { return EnumGenericTy; }
-		inline constexpr [[nodiscard]] std::string_view ConcreteTypeToStr() const noexcept { return ConcreteTypeStr(EnumConcreteTy); }
-		inline constexpr [[nodiscard]] std::string_view GenericTypeToStr() const noexcept { return GenericTypeStr(EnumGenericTy); }
+		[[nodiscard]] inline virtual constexpr ConcreteEventType ConcreteType() const noexcept override { return EnumConcreteTy; }
+		[[nodiscard]] inline virtual constexpr GenericEventType GenericType() const noexcept override { return EnumGenericTy; }
+		[[nodiscard]] inline constexpr std::string_view ConcreteTypeToStr() const noexcept { return ConcreteTypeStr(EnumConcreteTy); }
+		[[nodiscard]] inline constexpr std::string_view GenericTypeToStr() const noexcept { return GenericTypeStr(EnumGenericTy); }
 
-		inline static constexpr [[nodiscard]] bool IsInstance(const IEvent* pEvent) noexcept
+		[[nodiscard]] inline static constexpr bool IsInstance(const IEvent* pEvent) noexcept
 		{
 			RUNTIME_ASSERT(pEvent != nullptr, "The provided IEvent is nullptr.\n");
 
 			return pEvent->ConcreteType() == EnumConcreteTy;
 		}
 
-		inline static constexpr [[nodiscard]] Derived* Cast(IEvent* pEvent) noexcept
+		[[nodiscard]] inline static constexpr Derived* Cast(IEvent* pEvent) noexcept
 		{
 			RUNTIME_ASSERT(pEvent != nullptr, "The provided IEvent is nullptr.\n");
 			RUNTIME_ASSERT(IsInstance(pEvent), "The event's ConcreteEventType doesn't match.");
@@ -97,7 +97,7 @@ namespace CTMRenderer::Event
 		~StartEvent() = default;
 	public:
 		inline void Update(unsigned int newPlaceholderArgs) noexcept { m_PlaceholderArgs = newPlaceholderArgs; }
-		inline [[nodiscard]] unsigned int PlaceholderArgs() const noexcept { return m_PlaceholderArgs; }
+		[[nodiscard]] inline unsigned int PlaceholderArgs() const noexcept { return m_PlaceholderArgs; }
 	private:
 		unsigned int m_PlaceholderArgs;
 	};
@@ -112,7 +112,7 @@ namespace CTMRenderer::Event
 		~EndEvent() = default;
 	public:
 		inline void Update(unsigned int newPlaceholderArgs) noexcept { m_PlaceholderArgs = newPlaceholderArgs; }
-		inline [[nodiscard]] unsigned int PlaceholderArgs() const noexcept { return m_PlaceholderArgs; }
+		[[nodiscard]] inline unsigned int PlaceholderArgs() const noexcept { return m_PlaceholderArgs; }
 	private:
 		unsigned int m_PlaceholderArgs;
 	};
@@ -127,8 +127,8 @@ namespace CTMRenderer::Event
 
 		virtual ~MouseEvent() = default;
 	public:
-		inline [[nodiscard]] unsigned int PosX() const noexcept { return m_PosX; }
-		inline [[nodiscard]] unsigned int PosY() const noexcept { return m_PosY; }
+		[[nodiscard]] inline unsigned int PosX() const noexcept { return m_PosX; }
+		[[nodiscard]] inline unsigned int PosY() const noexcept { return m_PosY; }
 	protected:
 		unsigned int m_PosX;
 		unsigned int m_PosY;
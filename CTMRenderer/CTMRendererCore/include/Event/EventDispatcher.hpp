@@ -23,7 +23,7 @@ namespace CTMRenderer::Event
 		void Unsubscribe(IConcreteListener* concreteListener) noexcept;
 
 		void DispatchQueued() noexcept;
-		inline [[nodiscard]] bool IsEventQueued() const noexcept { return m_IsEventQueued.load(std::memory_order_acquire); }
+		[[nodiscard]] inline bool IsEventQueued() const noexcept { return m_IsEventQueued.load(std::memory_order_acquire); }
 
 		// Creates a queues a concrete event for dispatching. Queued events must be dispatched via `DispatchQueued()`
 		// Requires ConcreteEventTy to be a concrete event type, like MouseMoveEvent.
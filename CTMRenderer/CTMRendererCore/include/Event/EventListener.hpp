@@ -12,28 +12,28 @@ namespace CTMRenderer::Event
 		friend class EventDispatcher;
 	public:
 		virtual ~IListener() = default;
-		virtual [[nodiscard]] bool ListensAbstract() const noexcept = 0;
-		virtual [[nodiscard]] bool ListensConcrete() const noexcept = 0;
+		[[nodiscard]] virtual bool ListensAbstract() const noexcept = 0;
+		[[nodiscard]] virtual bool ListensConcrete() const noexcept = 0;
 	protected:
 		inline void Register() noexcept { m_IsRegistered = true; }
 		inline void Unegister() noexcept { m_IsRegistered = false; }
-		inline constexpr [[nodiscard]] bool IsRegistered() const noexcept { return m_IsRegistered; }
+		[[nodiscard]] inline constexpr bool IsRegistered() const noexcept { return m_IsRegistered; }
 	protected:
 		bool m_IsRegistered = false;
 	};
 
-	class IGenericListener : public IListener
+	class IGenericListener : public virtual IListener
 	{
 	public:
 		virtual ~IGenericListener() = default;
-		virtual [[nodiscard]] GenericEventType ListenType() const noexcept = 0;
+		[[nodiscard]] virtual GenericEventType ListenType() const noexcept = 0;
 	};
 
-	class IConcreteListener : public IListener
+	class IConcreteListener : public virtual IListener
 	{
 	public:
 		virtual ~IConcreteListener() = default;
-		virtual [[nodiscard]] ConcreteEventType ListenType() const noexcept = 0;
+		[[nodiscard]] virtual ConcreteEventType ListenType() const noexcept = 0;
 	};
 
 	// TODO: Use a template-based callable.
@@ -69,8 +69,8 @@ namespace CTMRenderer::Event
 
 		~GenericListener() = default;
 	public:
-		inline virtual constexpr [[nodiscard]] bool ListensAbstract() const noexcept override { return true; }
-		inline virtual constexpr [[nodiscard]] bool ListensConcrete() const noexcept override { return false; }
+		[[nodiscard]] inline virtual constexpr bool ListensAbstract() const noexcept override { return true; }
+		[[nodiscard]] inline virtual constexpr bool ListensConcrete() const noexcept override { return false; }
 		inline virtual constexpr GenericEventType ListenType() const noexcept override { return EnumGenericTy; }
 	};
 
@@ -80,7 +80,7 @@ namespace CTMRenderer::Event
 	{
 	public:
 		inline ConcreteListener(std::function<void(ConcreteEventTy*)>& onNotifyFunc) noexcept
-			: Listener(onNotifyFunc) {}
+			: Listener<void(ConcreteEventTy*), ConcreteEventTy*>(onNotifyFunc) {}
 
 		// Secondary value constructor for lambda's.
 		inline ConcreteListener(std::function<void(ConcreteEventTy*)> onNotifyFunc) noexcept
@@ -88,8 +88,8 @@ namespace CTMRenderer::Event
 
 		~ConcreteListener() = default;
 	public:
-		inline virtual constexpr [[nodiscard]] bool ListensAbstract() const noexcept override { return false; }
-		inline virtual constexpr [[nodiscard]] bool ListensConcrete() const noexcept override { return true; }
+		[[nodiscard]] inline virtual constexpr bool ListensAbstract() const noexcept override { return false; }
+		[[nodiscard]] inline virtual constexpr bool ListensConcrete() const noexcept override { return true; }
 		inline virtual constexpr ConcreteEventType ListenType() const noexcept override { return EnumConcreteTy; }
 	};
 }
\ No newline at end of file
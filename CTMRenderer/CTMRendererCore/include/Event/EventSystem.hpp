@@ -10,7 +10,7 @@ namespace CTMRenderer::Event
 		EventSystem() noexcept;
 		~EventSystem() = default;
 	public:
-		inline [[nodiscard]] EventDispatcher& Dispatcher() noexcept { return m_Dispatcher; }
+		[[nodiscard]] inline EventDispatcher& Dispatcher() noexcept { return m_Dispatcher; }
 	private:
 		EventDispatcher m_Dispatcher;
 	};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "Threading/WorkerPool.hpp"
+
+namespace CTMRenderer::Threading
+{
+	/* Calls func(i) for every i in [0, count) across the pool and the calling thread, and blocks until all calls returned.
+	 *
+	 * Indices are claimed one at a time from a shared counter, so a thread finishing cheap items early keeps taking
+	 * items from the ones stuck on expensive ones, instead of the work being split up front. The caller works on
+	 * items too, which keeps nested calls from worker threads from deadlocking on a busy pool. */
+	void ParallelFor(WorkerPool& pool, size_t count, const std::function<void(size_t)>& func) noexcept;
+}
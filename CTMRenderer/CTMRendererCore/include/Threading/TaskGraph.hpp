@@ -0,0 +1,88 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <condition_variable>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+
+#include "CTMRenderer/Timer.hpp"
+#include "Threading/WorkerPool.hpp"
+
+namespace CTMRenderer::Threading
+{
+	using TaskID = size_t;
+
+	enum class TaskAffinity
+	{
+		ANY,   // Runs on any worker of the pool.
+		CALLER // Runs on the thread calling Run. (e.g. window creation, or anything using the immediate context)
+	};
+
+	// When and where a task ran, relative to the start of TaskGraph::Run.
+	struct TaskRecord
+	{
+		std::string name;
+		double startMillis = 0.0;
+		double endMillis = 0.0;
+		int workerIndex = -1; // -1 for the calling thread.
+	};
+
+	/* A dependency-aware set of tasks, run once.
+	 *
+	 * Tasks may only depend on tasks added before them, so the graph can never contain a cycle.
+	 * Each task is started as soon as all of its dependencies finished, which lets independent
+	 * steps (file reads, font setup, scene building) overlap each other. */
+	class TaskGraph
+	{
+	public:
+		TaskGraph() = default;
+		~TaskGraph() = default;
+	public:
+		TaskID Add(std::string_view name, std::function<void()> func, std::initializer_list<TaskID> dependencies = {}, TaskAffinity affinity = TaskAffinity::ANY) noexcept;
+
+		// For dependencies only known at runtime. (e.g. graphs built from a FrameGraph)
+		TaskID Add(std::string_view name, std::function<void()> func, const std::vector<TaskID>& dependencies, TaskAffinity affinity = TaskAffinity::ANY) noexcept;
+
+		// Runs every task and blocks until all of them finished. CALLER tasks are run on the calling thread.
+		void Run(WorkerPool& pool) noexcept;
+
+		void PrintTimeline(std::ostream& stream) const noexcept;
+	public:
+		[[nodiscard]] inline const std::vector<TaskRecord>& Timeline() const noexcept { return m_Timeline; }
+		[[nodiscard]] inline double TotalMillis() const noexcept { return m_TotalMillis; }
+		[[nodiscard]] inline size_t TaskCount() const noexcept { return m_Tasks.size(); }
+	private:
+		struct Task
+		{
+			std::function<void()> func;
+			std::vector<TaskID> dependents;
+			unsigned int dependencyCount = 0;
+			unsigned int remainingDependencies = 0;
+			TaskAffinity affinity = TaskAffinity::ANY;
+		};
+	private:
+		TaskID AddTask(std::string_view name, std::function<void()> func, const TaskID* pDependencies, size_t dependencyCount, TaskAffinity affinity) noexcept;
+		void Schedule(TaskID id, WorkerPool& pool) noexcept; // Requires m_Mutex to be held.
+		void Execute(TaskID id, WorkerPool& pool) noexcept;
+	private:
+		std::vector<Task> m_Tasks;
+		std::vector<TaskRecord> m_Timeline;
+		std::deque<TaskID> m_CallerQueue;
+		std::mutex m_Mutex;
+		std::condition_variable m_CV;
+		size_t m_CompletedTasks = 0;
+		Timer::Timer m_RunTimer;
+		double m_TotalMillis = 0.0;
+		bool m_HasRun = false;
+	private:
+		TaskGraph(const TaskGraph&) = delete;
+		TaskGraph(TaskGraph&&) = delete;
+		TaskGraph& operator=(const TaskGraph&) = delete;
+		TaskGraph& operator=(TaskGraph&&) = delete;
+	};
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CTMRenderer::Threading
+{
+	enum class ThreadPriority
+	{
+		LOWEST,
+		BELOW_NORMAL,
+		NORMAL,
+		ABOVE_NORMAL,
+		HIGHEST,
+		TIME_CRITICAL
+	};
+
+	// Where and how a renderer-owned thread runs.
+	struct ThreadPlacement
+	{
+		inline ThreadPlacement(std::string name = "")
+			: Name(std::move(name)) {}
+
+		std::string Name; // Empty leaves the name untouched. Pool threads get their worker index appended.
+
+		// Logical cores the thread may run on. Empty leaves placement to the OS, unless NumaNode is set.
+		std::vector<unsigned int> Cores;
+
+		// When Cores is empty and NumaNode >= 0, the thread is restricted to the cores of that NUMA node.
+		int NumaNode = -1;
+
+		// For pools, pins worker i to the i-th core (wrapping) instead of letting all workers float over the whole set.
+		bool PinEachToOneCore = false;
+
+		ThreadPriority Priority = ThreadPriority::NORMAL; // NORMAL leaves the priority untouched.
+	};
+
+	// Placement of every thread a renderer owns.
+	struct ThreadTopology
+	{
+		ThreadPlacement EventThread = ThreadPlacement("CTM Render"); // Runs the event loop and every frame.
+		ThreadPlacement Workers = ThreadPlacement("CTM Worker");
+		unsigned int WorkerCount = 0; // 0 for one worker per core of Workers' core set, or WorkerPool::DefaultThreadCount() without one.
+	};
+
+	/* Applies a placement to the calling thread. index selects the core when PinEachToOneCore is set, and is appended
+	 * to the name when >= 0. Failures (e.g. missing permissions to raise priority) are reported in debug builds and otherwise ignored. */
+	void ApplyThreadPlacement(const ThreadPlacement& placement, int index = -1) noexcept;
+
+	// Returns the cores a placement resolves to. (Cores, else the cores of NumaNode, else empty for no restriction)
+	[[nodiscard]] std::vector<unsigned int> ResolveCores(const ThreadPlacement& placement) noexcept;
+
+	// Returns the NUMA node count, 1 when the OS reports none.
+	[[nodiscard]] unsigned int NumaNodeCount() noexcept;
+	[[nodiscard]] std::vector<unsigned int> CoresOfNumaNode(unsigned int node) noexcept;
+
+	// Counts the node0, node1, ... entries of a sysfs node directory, as NumaNodeCount does on Linux. At least 1, even without the directory.
+	[[nodiscard]] unsigned int NumaNodeCount(const std::filesystem::path& nodeDirectory) noexcept;
+
+	/* Parses a sysfs cpu list. (e.g. "0-3,64-67") Malformed entries are skipped, and cores above maxCore are dropped.
+	 * Ids are kept as listed rather than checked against the online count, as sparse, offline or many-core sets are valid. */
+	[[nodiscard]] std::vector<unsigned int> ParseCpuList(std::string_view list, unsigned int maxCore) noexcept;
+
+	// Returns the worker count of a topology, resolving WorkerCount = 0.
+	[[nodiscard]] unsigned int ResolveWorkerCount(const ThreadTopology& topology) noexcept;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <deque>
+
+#include "Threading/ThreadConfig.hpp"
+
+namespace CTMRenderer::Threading
+{
+	// A fixed set of worker threads consuming a shared FIFO of tasks.
+	class WorkerPool
+	{
+	public:
+		explicit WorkerPool(unsigned int threadCount = DefaultThreadCount(), ThreadPlacement placement = {}) noexcept;
+		explicit WorkerPool(const ThreadTopology& topology) noexcept;
+		~WorkerPool() noexcept;
+	public:
+		void Submit(std::function<void()> task) noexcept;
+
+		// Returns the number of hardware threads minus one (for the thread submitting work), and at least 1.
+		[[nodiscard]] static unsigned int DefaultThreadCount() noexcept;
+
+		// Returns the index of the calling worker thread, or -1 if the caller isn't a pool thread.
+		[[nodiscard]] static int CurrentWorkerIndex() noexcept;
+	public:
+		[[nodiscard]] inline unsigned int ThreadCount() const noexcept { return (unsigned int)m_Threads.size(); }
+	private:
+		void WorkerLoop(unsigned int workerIndex) noexcept;
+	private:
+		ThreadPlacement m_Placement; // Applied by each worker to itself before taking tasks.
+		std::vector<std::thread> m_Threads;
+		std::deque<std::function<void()>> m_Tasks;
+		std::mutex m_Mutex;
+		std::condition_variable m_CV;
+		bool m_ShouldRun = true;
+	private:
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool(WorkerPool&&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		WorkerPool& operator=(WorkerPool&&) = delete;
+	};
+}
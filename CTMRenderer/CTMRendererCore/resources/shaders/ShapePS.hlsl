@@ -0,0 +1,34 @@
+#include "util.hlsl"
+
+struct PSInput
+{
+    nointerpolation float4 FillColor : PX_FILL_COLOR;
+    nointerpolation float4 BorderColor : PX_BORDER_COLOR;
+    nointerpolation float4 Shape : PX_SHAPE;
+    float2 Local : PX_LOCAL;
+};
+
+// Premultiplied output, blended with ONE / INV_SRC_ALPHA. Matches SWShapeRasterizer's reference.
+float4 main(PSInput input) : SV_TARGET
+{
+    // Clamped like SWShapeRasterizer's Prepare, so negative sizes, radii and borders render alike on both.
+    const float2 halfSize = max(input.Shape.xy, 0.0f);
+    const float smallerHalf = min(halfSize.x, halfSize.y);
+    const float radius = clamp(input.Shape.z, 0.0f, smallerHalf);
+    const float border = clamp(input.Shape.w, 0.0f, smallerHalf);
+
+    // Screen pixels map 1 : 1 to local units, so half a pixel of distance is half a pixel of coverage.
+    const float outerCoverage = saturate(0.5f - RoundedBoxDistance(input.Local, halfSize, radius));
+    float innerCoverage = outerCoverage;
+
+    if (border > 0.0f)
+    {
+        const float2 innerHalfSize = halfSize - border;
+        innerCoverage = all(innerHalfSize > 0.0f) ? saturate(0.5f - RoundedBoxDistance(input.Local, innerHalfSize, max(radius - border, 0.0f))) : 0.0f;
+    }
+
+    const float4 fill = float4(input.FillColor.rgb * input.FillColor.a, input.FillColor.a);
+    const float4 stroke = float4(input.BorderColor.rgb * input.BorderColor.a, input.BorderColor.a);
+
+    return fill * innerCoverage + stroke * (outerCoverage - innerCoverage);
+}
@@ -0,0 +1,44 @@
+#include "util.hlsl"
+
+cbuffer ScreenSpace : register(b0)
+{
+    float2 WidthHeight;
+}
+
+struct VSOutput
+{
+    nointerpolation float4 FillColor : PX_FILL_COLOR;
+    nointerpolation float4 BorderColor : PX_BORDER_COLOR;
+    nointerpolation float4 Shape : PX_SHAPE; // Half size XY, corner radius, border width.
+    float2 Local : PX_LOCAL; // Pixel position relative to the shape's center.
+    float4 Pos : SV_Position;
+};
+
+struct VertexInput
+{
+    float2 Corner : POSITION; // Corner of a quad from (-1, -1) to (1, 1).
+};
+
+struct InstanceInput
+{
+    float2 CenterXY : INSTANCE_CENTER;
+    float2 HalfSizeXY : INSTANCE_HALF_SIZE;
+    float CornerRadius : INSTANCE_CORNER_RADIUS;
+    float BorderWidth : INSTANCE_BORDER_WIDTH;
+    float4 FillColor : INSTANCE_FILL_COLOR;
+    float4 BorderColor : INSTANCE_BORDER_COLOR;
+};
+
+VSOutput main(VertexInput vInput, InstanceInput iInput)
+{
+    VSOutput output;
+
+    // One pixel of margin, so the antialiased edge isn't cut off by the quad. Half sizes are clamped to 0, like ShapePS.hlsl does.
+    output.Local = vInput.Corner * (max(iInput.HalfSizeXY, 0.0f) + 1.0f);
+    output.Pos = float4(ScreenToClipSpace(iInput.CenterXY + output.Local, WidthHeight), 0.0f, 1.0f);
+
+    output.FillColor = iInput.FillColor;
+    output.BorderColor = iInput.BorderColor;
+    output.Shape = float4(iInput.HalfSizeXY, iInput.CornerRadius, iInput.BorderWidth);
+    return output;
+}
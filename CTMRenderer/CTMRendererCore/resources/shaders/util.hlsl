@@ -10,4 +10,11 @@ float2 ScreenToClipSpace(float2 Pos, float2 WidthHeight)
     );
 }
 
+// Signed distance from a box centered on the origin with rounded corners. Negative inside.
+float RoundedBoxDistance(float2 Pos, float2 HalfSize, float Radius)
+{
+    const float2 q = abs(Pos) - HalfSize + Radius;
+    return length(max(q, 0.0f)) + min(max(q.x, q.y), 0.0f) - Radius;
+}
+
 #endif // UTILS_HLSL
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CpuFeatures.hpp"
+
+#ifdef CTM_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace CTMRenderer::Core
+{
+#ifdef CTM_X86
+	namespace
+	{
+		struct CpuidRegisters
+		{
+			unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+		};
+
+		CpuidRegisters Cpuid(unsigned int leaf, unsigned int subleaf) noexcept
+		{
+			CpuidRegisters registers;
+
+			#ifdef _MSC_VER
+				int values[4] = {};
+				__cpuidex(values, (int)leaf, (int)subleaf);
+				registers = { (unsigned int)values[0], (unsigned int)values[1], (unsigned int)values[2], (unsigned int)values[3] };
+			#else
+				__cpuid_count(leaf, subleaf, registers.eax, registers.ebx, registers.ecx, registers.edx);
+			#endif
+
+			return registers;
+		}
+
+		// Returns the register state the OS saves on context switches. (XCR0)
+		unsigned long long EnabledRegisterState() noexcept
+		{
+			#ifdef _MSC_VER
+				return _xgetbv(0);
+			#else
+				unsigned int eax = 0, edx = 0;
+				__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return ((unsigned long long)edx << 32) | eax;
+			#endif
+		}
+
+		CpuFeatures Detect() noexcept
+		{
+			CpuFeatures features;
+
+			const unsigned int maxLeaf = Cpuid(0, 0).eax;
+			const CpuidRegisters leaf1 = Cpuid(1, 0);
+
+			features.sse2 = (leaf1.edx >> 26) & 1;
+			features.sse41 = (leaf1.ecx >> 19) & 1;
+
+			// AVX registers are only usable if the OS enabled saving them. (OSXSAVE, then XMM and YMM state in XCR0)
+			const bool hasOSXSave = (leaf1.ecx >> 27) & 1;
+			const unsigned long long registerState = hasOSXSave ? EnabledRegisterState() : 0;
+			const bool hasYmmState = (registerState & 0x6) == 0x6;
+			const bool hasZmmState = (registerState & 0xE6) == 0xE6; // Plus opmask, ZMM0-15 upper halves and ZMM16-31.
+
+			if (maxLeaf >= 7)
+			{
+				const CpuidRegisters leaf7 = Cpuid(7, 0);
+
+				features.avx2 = hasYmmState && ((leaf7.ebx >> 5) & 1);
+				features.avx512f = hasZmmState && ((leaf7.ebx >> 16) & 1);
+				features.avx512bw = hasZmmState && ((leaf7.ebx >> 30) & 1);
+			}
+
+			return features;
+		}
+	}
+#else
+	namespace
+	{
+		CpuFeatures Detect() noexcept
+		{
+			return {};
+		}
+	}
+#endif
+
+	const CpuFeatures& DetectCpuFeatures() noexcept
+	{
+		static const CpuFeatures s_Features = Detect();
+		return s_Features;
+	}
+}
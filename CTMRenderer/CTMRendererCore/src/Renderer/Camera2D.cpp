@@ -0,0 +1,71 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Camera2D.hpp"
+
+namespace CTMRenderer
+{
+	Camera2D::Camera2D(float viewportWidth, float viewportHeight) noexcept
+	{
+		SetViewport(viewportWidth, viewportHeight);
+	}
+
+	#pragma region Public API
+	void Camera2D::SetViewport(float viewportWidth, float viewportHeight) noexcept
+	{
+		RUNTIME_ASSERT(viewportWidth > 0 && viewportHeight > 0, "Viewport cannot be empty.\n");
+
+		m_ViewportWidth = viewportWidth;
+		m_ViewportHeight = viewportHeight;
+	}
+
+	void Camera2D::SetCenter(double x, double y) noexcept
+	{
+		m_CenterX = x;
+		m_CenterY = y;
+	}
+
+	void Camera2D::SetZoom(double zoom) noexcept
+	{
+		RUNTIME_ASSERT(zoom > 0, "Zoom must be greater than 0.\n");
+
+		m_Zoom = std::clamp(zoom, S_MIN_ZOOM, S_MAX_ZOOM);
+	}
+
+	void Camera2D::Pan(float dxPixels, float dyPixels) noexcept
+	{
+		m_CenterX -= dxPixels / m_Zoom;
+		m_CenterY -= dyPixels / m_Zoom;
+	}
+
+	void Camera2D::ZoomAt(double factor, float screenX, float screenY) noexcept
+	{
+		double anchorX = 0, anchorY = 0;
+		ScreenToWorld(screenX, screenY, anchorX, anchorY);
+
+		SetZoom(m_Zoom * factor);
+
+		// Puts the anchor back under the screen point.
+		m_CenterX = anchorX - (screenX - m_ViewportWidth * 0.5) / m_Zoom;
+		m_CenterY = anchorY - (screenY - m_ViewportHeight * 0.5) / m_Zoom;
+	}
+
+	WorldRect Camera2D::View() const noexcept
+	{
+		const double halfWidth = m_ViewportWidth * 0.5 / m_Zoom, halfHeight = m_ViewportHeight * 0.5 / m_Zoom;
+		return { m_CenterX - halfWidth, m_CenterY - halfHeight, m_CenterX + halfWidth, m_CenterY + halfHeight };
+	}
+
+	void Camera2D::WorldToScreen(double worldX, double worldY, float& screenX, float& screenY) const noexcept
+	{
+		// Subtracts in double first, so the float only holds the small, screen relative part.
+		screenX = (float)((worldX - OriginX()) * m_Zoom);
+		screenY = (float)((worldY - OriginY()) * m_Zoom);
+	}
+
+	void Camera2D::ScreenToWorld(float screenX, float screenY, double& worldX, double& worldY) const noexcept
+	{
+		worldX = OriginX() + screenX / m_Zoom;
+		worldY = OriginY() + screenY / m_Zoom;
+	}
+	#pragma endregion
+}
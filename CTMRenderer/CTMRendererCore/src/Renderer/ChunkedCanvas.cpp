@@ -0,0 +1,309 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/ChunkedCanvas.hpp"
+
+#include <limits>
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		constexpr double S_HUGE = std::numeric_limits<double>::max();
+
+		/* Sorts keys holding a sequence below sequenceCount in their high half, with a least significant digit radix sort
+		 * over the bytes sequences use. Linear, where merging the visible chunks costs a heap operation per rect,
+		 * as the sequences of neighbouring chunks interleave almost rect by rect. */
+		void SortBySequence(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch, uint32_t sequenceCount) noexcept
+		{
+			unsigned int digits = 0;
+			while (digits < 4 && ((sequenceCount - 1) >> (digits * 8)) != 0)
+				++digits;
+
+			// Every digit's bucket sizes are counted in a single read of the keys.
+			size_t offsets[4][256] = {};
+			for (uint64_t key : keys)
+				for (unsigned int digit = 0; digit < digits; ++digit)
+					++offsets[digit][(key >> (32 + digit * 8)) & 0xFF];
+
+			scratch.resize(keys.size());
+
+			for (unsigned int digit = 0; digit < digits; ++digit)
+			{
+				size_t offset = 0;
+				for (size_t& bucket : offsets[digit])
+				{
+					const size_t bucketSize = bucket;
+					bucket = offset;
+					offset += bucketSize;
+				}
+
+				const unsigned int shift = 32 + digit * 8;
+				for (uint64_t key : keys)
+					scratch[offsets[digit][(key >> shift) & 0xFF]++] = key;
+
+				keys.swap(scratch);
+			}
+		}
+
+		// Spreads the low 16 bits of value to the even bits.
+		uint32_t SpreadBits(uint32_t value) noexcept
+		{
+			value &= 0x0000FFFF;
+			value = (value | (value << 8)) & 0x00FF00FF;
+			value = (value | (value << 4)) & 0x0F0F0F0F;
+			value = (value | (value << 2)) & 0x33333333;
+			value = (value | (value << 1)) & 0x55555555;
+			return value;
+		}
+
+		// Maps a coordinate within [min, min + 65535 / scale] to 16 bits.
+		uint32_t Quantize(double value, double min, double scale) noexcept
+		{
+			return (uint32_t)std::clamp((value - min) * scale, 0.0, 65535.0);
+		}
+	}
+
+	ChunkedCanvas::ChunkedCanvas(uint32_t chunkCapacity) noexcept
+		: m_ChunkCapacity(chunkCapacity)
+	{
+		RUNTIME_ASSERT(chunkCapacity > 0, "Chunk capacity must be greater than 0.\n");
+	}
+
+	#pragma region Public API
+	void ChunkedCanvas::Add(double left, double top, double right, double bottom, const CTMDirectX::Graphics::DXColor& color) noexcept
+	{
+		RUNTIME_ASSERT(right > left, "Right X position must be larger than left X position.\n");
+		RUNTIME_ASSERT(bottom > top, "Bottom Y position must be larger than top Y position.\n");
+
+		m_PendingLefts.push_back(left);
+		m_PendingTops.push_back(top);
+		m_PendingRights.push_back(right);
+		m_PendingBottoms.push_back(bottom);
+		m_PendingColors.push_back(color);
+	}
+
+	void ChunkedCanvas::Reserve(size_t count) noexcept
+	{
+		m_PendingLefts.reserve(count);
+		m_PendingTops.reserve(count);
+		m_PendingRights.reserve(count);
+		m_PendingBottoms.reserve(count);
+		m_PendingColors.reserve(count);
+
+		m_Lefts.reserve(count);
+		m_Tops.reserve(count);
+		m_Rights.reserve(count);
+		m_Bottoms.reserve(count);
+		m_Colors.reserve(count);
+		m_Sequences.reserve(count);
+	}
+
+	void ChunkedCanvas::Build() noexcept
+	{
+		const size_t pendingCount = m_PendingColors.size();
+		if (pendingCount == 0)
+			return;
+
+		RUNTIME_ASSERT(m_Colors.size() + pendingCount < UINT32_MAX, "Canvas is full.\n");
+
+		// Sorts by the Z order of the rects' centers over the area the centers cover, quantized to 16 bits per axis.
+		double minX = S_HUGE, minY = S_HUGE, maxX = -S_HUGE, maxY = -S_HUGE;
+		for (size_t i = 0; i < pendingCount; ++i)
+		{
+			const double centerX = (m_PendingLefts[i] + m_PendingRights[i]) * 0.5, centerY = (m_PendingTops[i] + m_PendingBottoms[i]) * 0.5;
+			minX = std::min(minX, centerX);
+			maxX = std::max(maxX, centerX);
+			minY = std::min(minY, centerY);
+			maxY = std::max(maxY, centerY);
+		}
+
+		const double scaleX = maxX > minX ? 65535.0 / (maxX - minX) : 0.0;
+		const double scaleY = maxY > minY ? 65535.0 / (maxY - minY) : 0.0;
+
+		// Key in the high half, pending index in the low half, so sorting plain integers sorts the rects.
+		std::vector<uint64_t> keys(pendingCount);
+		for (size_t i = 0; i < pendingCount; ++i)
+		{
+			const uint32_t x = Quantize((m_PendingLefts[i] + m_PendingRights[i]) * 0.5, minX, scaleX);
+			const uint32_t y = Quantize((m_PendingTops[i] + m_PendingBottoms[i]) * 0.5, minY, scaleY);
+			keys[i] = ((uint64_t)(SpreadBits(x) | (SpreadBits(y) << 1)) << 32) | (uint64_t)i;
+		}
+
+		std::sort(keys.begin(), keys.end());
+
+		const size_t firstRect = m_Colors.size();
+		m_Lefts.resize(firstRect + pendingCount);
+		m_Tops.resize(firstRect + pendingCount);
+		m_Rights.resize(firstRect + pendingCount);
+		m_Bottoms.resize(firstRect + pendingCount);
+		m_Colors.resize(firstRect + pendingCount);
+		m_Sequences.resize(firstRect + pendingCount);
+
+		for (size_t first = 0; first < pendingCount; first += m_ChunkCapacity)
+		{
+			CanvasChunk chunk;
+			chunk.first = (uint32_t)(firstRect + first);
+			chunk.count = (uint32_t)std::min<size_t>(m_ChunkCapacity, pendingCount - first);
+			chunk.bounds = { S_HUGE, S_HUGE, -S_HUGE, -S_HUGE };
+
+			// The curve picks the chunk's rects, which then go back to the order they were added in.
+			std::sort(keys.begin() + first, keys.begin() + first + chunk.count, [](uint64_t a, uint64_t b) { return (uint32_t)a < (uint32_t)b; });
+
+			for (size_t i = 0; i < chunk.count; ++i)
+			{
+				const size_t source = (size_t)(keys[first + i] & UINT32_MAX);
+				const size_t target = chunk.first + i;
+
+				m_Lefts[target] = m_PendingLefts[source];
+				m_Tops[target] = m_PendingTops[source];
+				m_Rights[target] = m_PendingRights[source];
+				m_Bottoms[target] = m_PendingBottoms[source];
+				m_Colors[target] = m_PendingColors[source];
+				m_Sequences[target] = (uint32_t)(firstRect + source);
+
+				chunk.bounds.left = std::min(chunk.bounds.left, m_Lefts[target]);
+				chunk.bounds.top = std::min(chunk.bounds.top, m_Tops[target]);
+				chunk.bounds.right = std::max(chunk.bounds.right, m_Rights[target]);
+				chunk.bounds.bottom = std::max(chunk.bounds.bottom, m_Bottoms[target]);
+			}
+
+			m_Chunks.push_back(chunk);
+		}
+
+		// Releases the pending copies, which are as large as the built rects.
+		m_PendingLefts = {};
+		m_PendingTops = {};
+		m_PendingRights = {};
+		m_PendingBottoms = {};
+		m_PendingColors = {};
+	}
+
+	void ChunkedCanvas::Clear() noexcept
+	{
+		m_PendingLefts.clear();
+		m_PendingTops.clear();
+		m_PendingRights.clear();
+		m_PendingBottoms.clear();
+		m_PendingColors.clear();
+
+		m_Lefts.clear();
+		m_Tops.clear();
+		m_Rights.clear();
+		m_Bottoms.clear();
+		m_Colors.clear();
+		m_Sequences.clear();
+		m_Chunks.clear();
+	}
+
+	void ChunkedCanvas::Cull(const Camera2D& camera, std::vector<uint32_t>& visibleChunks) const noexcept
+	{
+		const WorldRect view = camera.View();
+		visibleChunks.clear();
+
+		for (uint32_t i = 0; i < (uint32_t)m_Chunks.size(); ++i)
+			if (m_Chunks[i].bounds.Intersects(view))
+				visibleChunks.push_back(i);
+	}
+
+	size_t ChunkedCanvas::Submit(const Camera2D& camera, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		SortVisible(camera);
+
+		const size_t instanceCount = m_VisibleRects.size();
+
+		instances.resize(instanceCount);
+
+		const double originX = camera.OriginX(), originY = camera.OriginY(), zoom = camera.Zoom();
+		size_t written = 0;
+
+		for (RectBatch batch = RebaseNext(originX, originY, zoom); batch.count != 0; batch = RebaseNext(originX, originY, zoom))
+		{
+			BuildInstances(batch, baseQuad, instances.data() + written);
+			written += batch.count;
+		}
+
+		m_Stats.visibleChunks = m_VisibleChunks.size();
+		m_Stats.submittedRects = instanceCount;
+
+		return instanceCount;
+	}
+
+	size_t ChunkedCanvas::Submit(const Camera2D& camera, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, RectLod& lod, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		SortVisible(camera);
+
+		lod.Begin((unsigned int)std::ceil(camera.ViewportWidth()), (unsigned int)std::ceil(camera.ViewportHeight()), 0);
+
+		const double originX = camera.OriginX(), originY = camera.OriginY(), zoom = camera.Zoom();
+		size_t submittedRects = 0;
+
+		for (RectBatch batch = RebaseNext(originX, originY, zoom); batch.count != 0; batch = RebaseNext(originX, originY, zoom))
+		{
+			lod.Add(batch, baseQuad, instances);
+			submittedRects += batch.count;
+		}
+
+		lod.End(baseQuad, instances);
+
+		m_Stats.visibleChunks = m_VisibleChunks.size();
+		m_Stats.submittedRects = submittedRects;
+
+		return instances.size();
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void ChunkedCanvas::SortVisible(const Camera2D& camera) noexcept
+	{
+		Cull(camera, m_VisibleChunks);
+
+		m_VisibleRects.clear();
+		for (uint32_t chunkIndex : m_VisibleChunks)
+		{
+			const CanvasChunk& chunk = m_Chunks[chunkIndex];
+			for (uint32_t rect = chunk.first; rect < chunk.first + chunk.count; ++rect)
+				m_VisibleRects.push_back(((uint64_t)m_Sequences[rect] << 32) | rect);
+		}
+
+		m_NextVisibleRect = 0;
+
+		// A single chunk already is in add order.
+		if (m_VisibleChunks.size() > 1)
+			SortBySequence(m_VisibleRects, m_SortScratch, (uint32_t)m_Colors.size());
+	}
+
+	RectBatch ChunkedCanvas::RebaseNext(double originX, double originY, double zoom) noexcept
+	{
+		m_ScreenLefts.resize(m_ChunkCapacity);
+		m_ScreenTops.resize(m_ChunkCapacity);
+		m_ScreenRights.resize(m_ChunkCapacity);
+		m_ScreenBottoms.resize(m_ChunkCapacity);
+		m_ScreenColors.resize(m_ChunkCapacity);
+
+		const uint32_t count = (uint32_t)std::min<size_t>(m_ChunkCapacity, m_VisibleRects.size() - m_NextVisibleRect);
+
+		// Subtracts in double, like Camera2D::WorldToScreen, so only screen relative values are rounded to float.
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const size_t rect = (size_t)(m_VisibleRects[m_NextVisibleRect + i] & UINT32_MAX);
+			m_ScreenLefts[i] = (float)((m_Lefts[rect] - originX) * zoom);
+			m_ScreenTops[i] = (float)((m_Tops[rect] - originY) * zoom);
+			m_ScreenRights[i] = (float)((m_Rights[rect] - originX) * zoom);
+			m_ScreenBottoms[i] = (float)((m_Bottoms[rect] - originY) * zoom);
+			m_ScreenColors[i] = m_Colors[rect];
+		}
+
+		m_NextVisibleRect += count;
+
+		RectBatch batch;
+		batch.pLeft = m_ScreenLefts.data();
+		batch.pTop = m_ScreenTops.data();
+		batch.pRight = m_ScreenRights.data();
+		batch.pBottom = m_ScreenBottoms.data();
+		batch.pColors = m_ScreenColors.data();
+		batch.count = count;
+
+		return batch;
+	}
+	#pragma endregion
+}
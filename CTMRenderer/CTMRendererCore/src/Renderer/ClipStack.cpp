@@ -0,0 +1,161 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/ClipStack.hpp"
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		[[nodiscard]] ClipRect Intersect(const ClipRect& a, const ClipRect& b) noexcept
+		{
+			return { std::max(a.left, b.left), std::max(a.top, b.top), std::min(a.right, b.right), std::min(a.bottom, b.bottom) };
+		}
+	}
+
+	ClipStack::ClipStack(const ClipRect& root) noexcept
+	{
+		Clear(root);
+	}
+
+	#pragma region Public API
+	void ClipStack::Push(const ClipRect& clip) noexcept
+	{
+		m_Clips.push_back(Intersect(Current(), clip));
+	}
+
+	void ClipStack::Push(float left, float top, float right, float bottom) noexcept
+	{
+		Push(ClipRect{ left, top, right, bottom });
+	}
+
+	void ClipStack::Pop() noexcept
+	{
+		RUNTIME_ASSERT(m_Clips.size() > 1, "Cannot pop the root clip rect.\n");
+
+		m_Clips.pop_back();
+	}
+
+	void ClipStack::Clear(const ClipRect& root) noexcept
+	{
+		m_Clips.clear();
+		m_Clips.push_back(root);
+
+		m_Stats = {};
+	}
+
+	size_t ClipStack::Build(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		const ClipRect& clip = Current();
+
+		if (clip.IsEmpty())
+		{
+			m_Stats.discardedRects += rects.count;
+			return 0;
+		}
+
+		m_Lefts.resize(rects.count);
+		m_Tops.resize(rects.count);
+		m_Rights.resize(rects.count);
+		m_Bottoms.resize(rects.count);
+		m_Colors.resize(rects.count);
+
+		size_t kept = 0, trimmed = 0;
+
+		for (size_t i = 0; i < rects.count; ++i)
+		{
+			const float left = std::max(rects.pLeft[i], clip.left), top = std::max(rects.pTop[i], clip.top);
+			const float right = std::min(rects.pRight[i], clip.right), bottom = std::min(rects.pBottom[i], clip.bottom);
+
+			if (!(right > left && bottom > top))
+				continue;
+
+			trimmed += left != rects.pLeft[i] || top != rects.pTop[i] || right != rects.pRight[i] || bottom != rects.pBottom[i] ? 1 : 0;
+
+			m_Lefts[kept] = left;
+			m_Tops[kept] = top;
+			m_Rights[kept] = right;
+			m_Bottoms[kept] = bottom;
+			m_Colors[kept] = rects.pColors[i];
+			++kept;
+		}
+
+		m_Stats.keptRects += kept - trimmed;
+		m_Stats.trimmedRects += trimmed;
+		m_Stats.discardedRects += rects.count - kept;
+
+		if (kept == 0)
+			return 0;
+
+		RectBatch clipped;
+		clipped.pLeft = m_Lefts.data();
+		clipped.pTop = m_Tops.data();
+		clipped.pRight = m_Rights.data();
+		clipped.pBottom = m_Bottoms.data();
+		clipped.pColors = m_Colors.data();
+		clipped.count = kept;
+
+		const size_t first = instances.size();
+		instances.resize(first + kept);
+		BuildInstances(clipped, baseQuad, instances.data() + first);
+
+		return kept;
+	}
+
+	bool ClipStack::Build(const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count, std::vector<CTMDirectX::Graphics::ShapeInstanceData>& shapes) noexcept
+	{
+		RUNTIME_ASSERT(pShapes != nullptr || count == 0, "Shapes are nullptr.\n");
+
+		const ClipRect& clip = Current();
+		bool isScissored = false;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			// Antialiasing covers pixels whose centers are within half a pixel of the shape, bounded by a pixel like the rasterizer does.
+			const float halfWidth = std::max(pShapes[i].halfSizeXY.x, 0.0f) + 1.0f, halfHeight = std::max(pShapes[i].halfSizeXY.y, 0.0f) + 1.0f;
+			const float left = pShapes[i].centerXY.x - halfWidth, right = pShapes[i].centerXY.x + halfWidth;
+			const float top = pShapes[i].centerXY.y - halfHeight, bottom = pShapes[i].centerXY.y + halfHeight;
+
+			if (clip.IsEmpty() || right <= clip.left || left >= clip.right || bottom <= clip.top || top >= clip.bottom)
+			{
+				++m_Stats.discardedShapes;
+				continue;
+			}
+
+			if (left >= clip.left && right <= clip.right && top >= clip.top && bottom <= clip.bottom)
+			{
+				++m_Stats.keptShapes;
+			}
+			else
+			{
+				++m_Stats.scissoredShapes;
+				isScissored = true;
+			}
+
+			shapes.push_back(pShapes[i]);
+		}
+
+		return isScissored;
+	}
+
+	ClipRowRange ClipStack::VisibleRows(float firstTop, float rowHeight, size_t rowCount) const noexcept
+	{
+		RUNTIME_ASSERT(rowHeight > 0.0f, "Row height must be greater than 0.\n");
+
+		const ClipRect& clip = Current();
+
+		if (clip.IsEmpty())
+			return {};
+
+		// Rows overlapping the clip rect, rounded outwards.
+		const double first = std::floor(((double)clip.top - firstTop) / rowHeight);
+		const double end = std::ceil(((double)clip.bottom - firstTop) / rowHeight);
+
+		ClipRowRange range;
+		range.first = first <= 0.0 ? 0 : (first >= (double)rowCount ? rowCount : (size_t)first);
+		range.end = end <= 0.0 ? 0 : (end >= (double)rowCount ? rowCount : (size_t)end);
+		range.end = std::max(range.end, range.first);
+
+		return range;
+	}
+	#pragma endregion
+}
@@ -0,0 +1,202 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/DamageTracker.hpp"
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		// Keeps rounded coordinates representable, however far off screen a shape is.
+		constexpr float S_MAX_COORDINATE = 1 << 30;
+
+		DamageRect ToPixels(float left, float top, float right, float bottom) noexcept
+		{
+			DamageRect rect;
+			rect.left = (int)std::clamp(std::floor(left), -S_MAX_COORDINATE, S_MAX_COORDINATE);
+			rect.top = (int)std::clamp(std::floor(top), -S_MAX_COORDINATE, S_MAX_COORDINATE);
+			rect.right = (int)std::clamp(std::ceil(right), -S_MAX_COORDINATE, S_MAX_COORDINATE);
+			rect.bottom = (int)std::clamp(std::ceil(bottom), -S_MAX_COORDINATE, S_MAX_COORDINATE);
+			return rect;
+		}
+
+		inline bool Overlaps(const DamageRect& a, const DamageRect& b) noexcept
+		{
+			return a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+		}
+
+		inline DamageRect Union(const DamageRect& a, const DamageRect& b) noexcept
+		{
+			return { std::min(a.left, b.left), std::min(a.top, b.top), std::max(a.right, b.right), std::max(a.bottom, b.bottom) };
+		}
+	}
+
+	DamageTracker::DamageTracker(const DamageSettings& settings) noexcept
+		: m_Settings(settings)
+	{
+		RUNTIME_ASSERT(settings.MaxRects != 0, "At least one damage rect must be allowed.\n");
+		RUNTIME_ASSERT(settings.MaxBufferAge != 0, "Buffer age must allow at least the previous frame.\n");
+
+		Invalidate();
+	}
+
+	#pragma region Public API
+	void DamageTracker::Add(float left, float top, float right, float bottom) noexcept
+	{
+		if (m_Pending.isFull)
+			return;
+
+		const DamageRect rect = ToPixels(left, top, right, bottom);
+
+		if (!rect.IsEmpty())
+			Insert(m_Pending.rects, rect);
+	}
+
+	void DamageTracker::Add(const CTMDirectX::Graphics::Geometry::DXAABB& aabb) noexcept
+	{
+		Add(aabb.left, aabb.top, aabb.right, aabb.bottom);
+	}
+
+	void DamageTracker::AddChange(float oldLeft, float oldTop, float oldRight, float oldBottom, float newLeft, float newTop, float newRight, float newBottom) noexcept
+	{
+		if (m_Pending.isFull)
+			return;
+
+		const DamageRect oldRect = ToPixels(oldLeft, oldTop, oldRight, oldBottom);
+		const DamageRect newRect = ToPixels(newLeft, newTop, newRight, newBottom);
+
+		if (Overlaps(oldRect, newRect))
+			Insert(m_Pending.rects, Union(oldRect, newRect));
+		else
+		{
+			if (!oldRect.IsEmpty())
+				Insert(m_Pending.rects, oldRect);
+			if (!newRect.IsEmpty())
+				Insert(m_Pending.rects, newRect);
+		}
+	}
+
+	void DamageTracker::AddFull() noexcept
+	{
+		m_Pending.isFull = true;
+		m_Pending.rects.clear();
+	}
+
+	const DamageRegion& DamageTracker::Resolve(unsigned int width, unsigned int height, unsigned int bufferAge) noexcept
+	{
+		m_Region.rects.clear();
+		m_Region.isFull = m_Pending.isFull || bufferAge == 0 || bufferAge - 1 > m_History.size();
+
+		// The frames the target missed are repaired along with this one.
+		if (!m_Region.isFull)
+		{
+			m_Region.rects = m_Pending.rects;
+
+			for (size_t age = 1; age < bufferAge && !m_Region.isFull; ++age)
+			{
+				const FrameDamage& missed = m_History[age - 1];
+				m_Region.isFull = missed.isFull;
+
+				for (const DamageRect& rect : missed.rects)
+					Insert(m_Region.rects, rect);
+			}
+		}
+
+		// Clipping keeps the rects disjoint, so their areas add up to the damaged pixels.
+		const DamageRect targetRect = { 0, 0, (int)width, (int)height };
+		m_Region.pixels = 0;
+
+		for (size_t i = 0; i < m_Region.rects.size() && !m_Region.isFull;)
+		{
+			DamageRect& rect = m_Region.rects[i];
+			rect.left = std::max(rect.left, targetRect.left);
+			rect.top = std::max(rect.top, targetRect.top);
+			rect.right = std::min(rect.right, targetRect.right);
+			rect.bottom = std::min(rect.bottom, targetRect.bottom);
+
+			if (rect.IsEmpty())
+			{
+				rect = m_Region.rects.back();
+				m_Region.rects.pop_back();
+				continue;
+			}
+
+			m_Region.pixels += rect.Area();
+			++i;
+		}
+
+		if (!m_Region.isFull && m_Region.pixels > (uint64_t)(m_Settings.FullRedrawCoverage * (double)targetRect.Area()))
+			m_Region.isFull = true;
+
+		if (m_Region.isFull)
+		{
+			m_Region.rects.clear();
+			m_Region.pixels = targetRect.Area();
+		}
+
+		// Only MaxBufferAge - 1 previous frames are ever needed.
+		m_History.push_front(std::move(m_Pending));
+		if (m_History.size() >= m_Settings.MaxBufferAge)
+			m_History.pop_back();
+
+		m_Pending = FrameDamage();
+		return m_Region;
+	}
+
+	void DamageTracker::Invalidate() noexcept
+	{
+		m_History.clear();
+		AddFull();
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void DamageTracker::Insert(std::vector<DamageRect>& rects, DamageRect rect) const noexcept
+	{
+		// A merged rect can reach rects the original didn't, so merging repeats until nothing overlaps.
+		for (size_t i = 0; i < rects.size();)
+		{
+			if (Overlaps(rect, rects[i]))
+			{
+				rect = Union(rect, rects[i]);
+				rects[i] = rects.back();
+				rects.pop_back();
+				i = 0;
+			}
+			else
+				++i;
+		}
+
+		rects.push_back(rect);
+
+		if (rects.size() <= m_Settings.MaxRects)
+			return;
+
+		// Merges the pair whose bounding rect covers the fewest pixels neither of them did.
+		size_t bestFirst = 0, bestSecond = 1;
+		uint64_t bestWaste = UINT64_MAX;
+
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			for (size_t j = i + 1; j < rects.size(); ++j)
+			{
+				const uint64_t waste = Union(rects[i], rects[j]).Area() - rects[i].Area() - rects[j].Area();
+
+				if (waste < bestWaste)
+				{
+					bestWaste = waste;
+					bestFirst = i;
+					bestSecond = j;
+				}
+			}
+		}
+
+		const DamageRect merged = Union(rects[bestFirst], rects[bestSecond]);
+		rects[bestSecond] = rects.back();
+		rects.pop_back();
+		rects[bestFirst] = rects.back();
+		rects.pop_back();
+
+		Insert(rects, merged);
+	}
+	#pragma endregion
+}
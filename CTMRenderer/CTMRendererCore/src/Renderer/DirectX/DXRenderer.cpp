@@ -5,36 +5,44 @@
 
 namespace CTMRenderer::CTMDirectX
 {
-	DXRenderer::DXRenderer(const unsigned int targetFPS)
-		: IRenderer(), m_Settings(targetFPS), m_Window(m_Settings, m_EventSystem.Dispatcher()),
-		  m_Graphics(m_Settings, m_Window.ClientArea(), m_Window.Mouse())
+	DXRenderer::DXRenderer(const DXRendererSettings& settings)
+		: IRenderer(settings.Threads), m_Settings(settings),
+		  m_OwnedSharedResources(std::make_unique<Graphics::DXSharedResources>()), m_SharedResourcesRef(*m_OwnedSharedResources),
+		  m_Window(m_Settings, m_EventSystem.Dispatcher()),
+		  m_Graphics(m_Settings, m_Window.ClientArea(), m_Window.Mouse(), m_SharedResourcesRef)
 	{
 	}
 
-	#pragma region Public API
-	void DXRenderer::Start() noexcept
+	DXRenderer::DXRenderer(const DXRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool, Graphics::DXSharedResources& sharedResourcesRef)
+		: IRenderer(sharedWorkerPool), m_Settings(settings), m_SharedResourcesRef(sharedResourcesRef),
+		  m_Window(m_Settings, m_EventSystem.Dispatcher()),
+		  m_Graphics(m_Settings, m_Window.ClientArea(), m_Window.Mouse(), m_SharedResourcesRef)
 	{
-		m_ShouldRun.store(true, std::memory_order_release);
-		m_EventThread = std::thread(&DXRenderer::EventLoop, this);
+	}
 
-		// Wait for the event loop to start.
-		std::unique_lock<std::mutex> lock(m_RendererMutex);
-		m_RendererCV.wait(lock, [this] { return m_EventLoopStarted.load(std::memory_order_acquire); });
+	#pragma region Public API
+	void DXRenderer::Step(double elapsedMillis) noexcept
+	{
+		if (m_RendererStarted.load(std::memory_order_acquire))
+		{
+			BOOL result;
+			MSG msg;
 
-		// TODO: Figure out way to have events be dispatched on the Renderer's thread
-		//		 to prevent creation of the window on the main thread. (Dispatching queue)
-		m_EventSystem.Dispatcher().QueueEvent<Event::StartEvent>(1738u); // ayy
+			m_Window.HandleMessages(result, msg);
+			DoFrame(elapsedMillis / 1000);
+		}
 
-		//DEBUG_PRINT("Initialized renderer.\n");
+		DispatchQueuedEvents();
 	}
 
-	void DXRenderer::JoinForShutdown() noexcept
+	void DXRenderer::Detach() noexcept
 	{
-		m_EventThread.join();
+		IRenderer::Detach();
+		m_Window.Close();
 	}
 	#pragma endregion
 
-	#pragma region Private Functions
+	#pragma region Protected Functions
 	void DXRenderer::OnStart(const Event::StartEvent* pStartEvent) noexcept
 	{
 		RUNTIME_ASSERT(pStartEvent != nullptr, "Start event is nullptr. How TF did this happen?\n");
@@ -42,8 +50,16 @@ namespace CTMRenderer::CTMDirectX
 
 		DEBUG_PRINT("Start args : " << pStartEvent->PlaceholderArgs() << '\n');
 
-		m_Window.Start();
-		m_Graphics.Init(m_Window.Handle());
+		// Independent startup steps run in parallel on the worker pool, the rest stays on this thread.
+		Threading::TaskGraph startupGraph;
+
+		const Threading::TaskID windowTaskID = startupGraph.Add("DXWindow::Start", [this] { m_Window.Start(); }, {}, Threading::TaskAffinity::CALLER);
+		m_Graphics.AddInitTasks(startupGraph, windowTaskID, m_Window);
+
+		startupGraph.Run(m_WorkerPool);
+		m_StartupTimeline = startupGraph.Timeline();
+
+		IF_DEBUG(startupGraph.PrintTimeline(std::cout));
 
 		m_RendererStarted.store(true, std::memory_order_release);
 
@@ -52,129 +68,25 @@ namespace CTMRenderer::CTMDirectX
 
 	void DXRenderer::OnEnd(const Event::EndEvent* pEndEvent) noexcept
 	{
-		RUNTIME_ASSERT(pEndEvent != nullptr, "End event is nullptr. How TF did this happen?\n");
-		RUNTIME_ASSERT(m_EventLoopStarted.load(std::memory_order_acquire) == true, "Event loop hasn't started.\n");
-		RUNTIME_ASSERT(m_RendererStarted.load(std::memory_order_acquire) == true, "Renderer hasn't started.\n");
-		RUNTIME_ASSERT(m_ShouldRun.load(std::memory_order_acquire) == true, "Renderer has already shutdown.\n");
+		IF_DEBUG(m_Graphics.Modules().PrintReport(std::cout));
+		IF_DEBUG(m_Graphics.Graph().PrintReport(std::cout));
 
-		DEBUG_PRINT("End args : " << pEndEvent->PlaceholderArgs() << '\n');
-
-		m_ShouldRun.store(false, std::memory_order_release);
-
-		DEBUG_PRINT("Renderer ended.\n");
+		IRenderer::OnEnd(pEndEvent);
 	}
 
-	void DXRenderer::EventLoop() noexcept
+	void DXRenderer::OnMouseMove(const Event::MouseMoveEvent* pMouseMoveEvent) noexcept
 	{
-		// The passed onNotifyFunc will be called when an event is dispatched.
-		Event::GenericListener<Event::GenericEventType::CTM_ANY> eventListenerAny(
-			std::bind(&DXRenderer::HandleEvent, this, std::placeholders::_1)
-		);
-
-		Event::EventDispatcher& eventDispatcher = m_EventSystem.Dispatcher();
-		eventDispatcher.Subscribe(&eventListenerAny);
-
-		{
-			std::lock_guard<std::mutex> lock(m_RendererMutex);
-			m_EventLoopStarted.store(true, std::memory_order_release);
-
-			m_RendererCV.notify_one();
-		}
-
-		DEBUG_PRINT("Renderer event loop started.\n");
-
-		const double targetFrameDuration = 1000.0 / m_Settings.TargetFPS;
-		double actualFrameDuration = 0.0;
-		double frameStartTime = 0.0;
-		double remainingFrameTime = 0.0;
-
-		BOOL result;
-		MSG msg;
-		while (m_ShouldRun.load(std::memory_order_acquire))
-		{
-			frameStartTime = m_Timer.ElapsedMillis();
-
-			if (m_RendererStarted.load(std::memory_order_acquire))
-			{
-				m_Window.HandleMessages(result, msg);
-				DoFrame(frameStartTime / 1000);
-			}
-
-			if (eventDispatcher.IsEventQueued())
-				eventDispatcher.DispatchQueued();
-
-			actualFrameDuration = m_Timer.ElapsedMillis() - frameStartTime;
-			remainingFrameTime = Utility::MinDB(targetFrameDuration - actualFrameDuration, 0);
-			RUNTIME_ASSERT(actualFrameDuration >= 0, "YOU DID SOMETHING WRONG YOU IDIOT!!!\n");
-			RUNTIME_ASSERT(remainingFrameTime >= 0, "YOU DID SOMETHING WRONG YOU IDIOT!!!\n");
-
-			Sleep(static_cast<DWORD>(remainingFrameTime));
-		}
-
-		DEBUG_PRINT("Event loop end.\n");
+		m_Window.Mouse().SetPos(pMouseMoveEvent->PosX(), pMouseMoveEvent->PosY());
+		m_Window.SetTitle(std::wstring(L'(' + std::to_wstring(pMouseMoveEvent->PosX()) + L", " + std::to_wstring(pMouseMoveEvent->PosY()) + L')'));
 	}
+	#pragma endregion
 
+	#pragma region Private Functions
 	void DXRenderer::DoFrame(double elapsedMillis) noexcept
 	{
 		m_Graphics.StartFrame(elapsedMillis);
-		m_Graphics.Draw();
+		m_Graphics.Draw(m_WorkerPool);
 		m_Graphics.EndFrame();
 	}
-
-	void DXRenderer::HandleEvent(Event::IEvent* pEvent) noexcept
-	{
-		RUNTIME_ASSERT(pEvent != nullptr, "Event received is nullptr.\n");
-
-		Event::GenericEventType genericType = pEvent->GenericType();
-
-		switch (genericType)
-		{
-		case Event::GenericEventType::CTM_ANY:
-			RUNTIME_ASSERT(false, "No events should have CTM_ANY as their GenericEventType, as it is a marker type used for event listening.\n");
-			break;
-		case Event::GenericEventType::CTM_STATE_EVENT:
-			HandleStateEvent(pEvent);
-			break;
-		case Event::GenericEventType::CTM_MOUSE_EVENT:
-			HandleMouseEvent(pEvent);
-			break;
-		default: break;
-		}
-	}
-
-	void DXRenderer::HandleStateEvent(Event::IEvent* pEvent) noexcept
-	{
-		RUNTIME_ASSERT(pEvent->GenericType() == Event::GenericEventType::CTM_STATE_EVENT, "The provided event wasn't a CTM_STATE_EVENT.\n");
-
-		switch (pEvent->ConcreteType())
-		{
-		case Event::ConcreteEventType::CTM_STATE_START_EVENT:
-			OnStart(Event::StartEvent::Cast(pEvent));
-			break;
-		case Event::ConcreteEventType::CTM_STATE_END_EVENT:
-			OnEnd(Event::EndEvent::Cast(pEvent));
-			break;
-		default:
-			RUNTIME_ASSERT(false, "State event wasn't handled.\n");
-		}
-	}
-
-	void DXRenderer::HandleMouseEvent(Event::IEvent* pEvent) noexcept
-	{
-		RUNTIME_ASSERT(pEvent->GenericType() == Event::GenericEventType::CTM_MOUSE_EVENT, "The provided event wasn't a CTM_STATE_EVENT.\n");
-
-		switch (pEvent->ConcreteType())
-		{
-		case Event::ConcreteEventType::CTM_MOUSE_MOVE_EVENT:
-		{
-			Event::MouseMoveEvent* pMMoveEvent = Event::MouseMoveEvent::Cast(pEvent);
-			m_Window.Mouse().SetPos(pMMoveEvent->PosX(), pMMoveEvent->PosY());
-			m_Window.SetTitle(std::wstring(L'(' + std::to_wstring(pMMoveEvent->PosX()) + L", " + std::to_wstring(pMMoveEvent->PosY()) + L')'));
-			break;
-		}
-		default:
-			RUNTIME_ASSERT(false, "Mouse event wasn't handled.\n");
-		}
-	}
 	#pragma endregion
 }
@@ -3,6 +3,7 @@
 #include "Core/CoreUtility.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXGraphics.hpp"
 #include "CTMRenderer/DirectX/Graphics/DXGraphicsUtility.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXInstanceData.hpp"
 #include "CTMRenderer/DirectX/Graphics/Geometry/DXShape.hpp"
 #include "CTMRenderer/DirectX/Graphics/Bindable/DXBuffer.hpp"
 #include "CTMRenderer/DirectX/Graphics/Bindable/DXShader.hpp"
@@ -11,16 +12,36 @@
 
 namespace CTMRenderer::CTMDirectX::Graphics
 {
-	DXGraphics::DXGraphics(const DXRendererSettings& settingsRef, const Window::Geometry::WindowArea& windowAreaRef, const Control::Mouse& mouseRef) noexcept
-		: m_SettingsRef(settingsRef), m_WindowAreaRef(windowAreaRef), m_MouseRef(mouseRef),
-		  m_2DRender(), m_TextRender(), m_ClearColor(0, 0, .1f, 1.0f)
+	DXGraphics::DXGraphics(const DXRendererSettings& settingsRef, const Window::Geometry::WindowArea& windowAreaRef, const Control::Mouse& mouseRef, DXSharedResources& sharedResourcesRef) noexcept
+		: m_SettingsRef(settingsRef), m_WindowAreaRef(windowAreaRef), m_MouseRef(mouseRef), m_SharedResourcesRef(sharedResourcesRef),
+		  m_2DRender(), m_TextRender(), m_ClearColor(0, 0, .1f, 1.0f), m_Frame(windowAreaRef, FramePasses())
 	{
+		m_TextRender.text = m_SettingsRef.TestText;
+
+		m_2DModuleID = m_Modules.Register("Direct2D", [this] { Init2D(); });
+		m_TextFormatModuleID = m_Modules.Register("DirectWrite", [this] { InitTextFormat(); });
+		m_TextModuleID = m_Modules.Register("Text", [this] { InitTextBrush(); }, { m_2DModuleID, m_TextFormatModuleID });
 	}
 
-	void DXGraphics::Init(const HWND windowHandle) noexcept
+	void DXGraphics::AddInitTasks(Threading::TaskGraph& graph, Threading::TaskID windowTaskID, const Window::DXWindow& windowRef) noexcept
 	{
 		DEBUG_PRINT("(Graphics.Init) Target FPS : " + std::to_string(m_SettingsRef.TargetFPS) + '\n');
 
+		// Independent of the window and device, so these start right away on the pool.
+		const Threading::TaskID shadersTaskID = graph.Add("LoadTestShaders", [this] { LoadTestShaders(); });
+		const Threading::TaskID batchesTaskID = graph.Add("BuildBatches", [this] { m_Frame.BuildBatches(); });
+
+		// Everything touching the device context stays on the render thread.
+		const Threading::TaskID deviceTaskID = graph.Add(
+			"InitDevice", [this, &windowRef] { InitDevice(windowRef.Handle()); },
+			{ windowTaskID }, Threading::TaskAffinity::CALLER
+		);
+
+		graph.Add("InitTestScene", [this] { InitTestScene(); }, { deviceTaskID, shadersTaskID, batchesTaskID }, Threading::TaskAffinity::CALLER);
+	}
+
+	void DXGraphics::InitDevice(const HWND windowHandle) noexcept
+	{
 		m_WindowHandle = windowHandle;
 
 		DXGI_SWAP_CHAIN_DESC swapDesc = {};
@@ -34,10 +55,10 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		swapDesc.SampleDesc.Count = 1;
 		swapDesc.SampleDesc.Quality = 0; // Quality must be zero for a sample count of 1.
 		swapDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT | DXGI_USAGE_SHADER_INPUT;
-		swapDesc.BufferCount = 2; // For buffer flipping.
+		swapDesc.BufferCount = BUFFER_COUNT; // For buffer flipping.
 		swapDesc.OutputWindow = m_WindowHandle;
 		swapDesc.Windowed = TRUE;
-		swapDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+		swapDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL; // Keeps the back buffers' content, so frames only redraw their damage.
 		swapDesc.Flags = 0;
 
 		Microsoft::WRL::ComPtr<ID3D11Device> pBaseDevice;
@@ -78,10 +99,6 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		// Create the RTV.
 		hResult = mP_Device->CreateRenderTargetView(pBackBuffer.Get(), nullptr, mP_RTV.GetAddressOf());
 		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
-
-		Init2D();
-		InitText();
-		InitTestScene();
 	}
 
 	void DXGraphics::Init2D() noexcept
@@ -130,47 +147,51 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		);
 	}
 
-	void DXGraphics::InitText() noexcept
+	void DXGraphics::InitTextFormat() noexcept
 	{
-		m_TextRender.text = L"Hello World!!!";
-		
-		HRESULT hResult = DWriteCreateFactory(
-			DWRITE_FACTORY_TYPE_ISOLATED,
-			__uuidof(IDWriteFactory),
-			reinterpret_cast<IUnknown**>(m_TextRender.pDWriteFactory.GetAddressOf())
-		);
+		// The format (and its font data) is shared with every other renderer using the same font.
+		HRESULT hResult = m_SharedResourcesRef.TextFormat(L"Gabriola", 72.0f, m_TextRender.pTextFormat);
 		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
 
-		hResult = m_TextRender.pDWriteFactory->CreateTextFormat(
-			L"Gabriola", // Font family name.
-			NULL,		 // Font collection (NULL sets it to use the system font collection).
-			DWRITE_FONT_WEIGHT_REGULAR,
-			DWRITE_FONT_STYLE_NORMAL,
-			DWRITE_FONT_STRETCH_NORMAL,
-			72.0f,
-			L"en-us",
-			m_TextRender.pTextFormat.GetAddressOf()
+		m_TextRender.layoutRect = D2D1::RectF(
+			0.0f,
+			0.0f,
+			(FLOAT)m_WindowAreaRef.width,
+			(FLOAT)m_WindowAreaRef.height
 		);
-		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
-
-		hResult = m_TextRender.pTextFormat->SetTextAlignment(DWRITE_TEXT_ALIGNMENT_CENTER);
-		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
-
-		hResult = m_TextRender.pTextFormat->SetParagraphAlignment(DWRITE_PARAGRAPH_ALIGNMENT_CENTER);
-		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
+	}
 
-		hResult = m_2DRender.pRTV->CreateSolidColorBrush(
+	void DXGraphics::InitTextBrush() noexcept
+	{
+		HRESULT hResult = m_2DRender.pRTV->CreateSolidColorBrush(
 			D2D1::ColorF(D2D1::ColorF::Cyan),
 			m_TextRender.pSCBrush.GetAddressOf()
 		);
 		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
+	}
 
-		m_TextRender.layoutRect = D2D1::RectF(
-			0.0f,
-			0.0f,
-			(FLOAT)m_WindowAreaRef.width,
-			(FLOAT)m_WindowAreaRef.height
-		);
+	void DXGraphics::LoadTestShaders() noexcept
+	{
+		// Target Path (for now) : C:\dev\projects\cpp\Direct3D\RendererTest\bin\out\Debug-windows-x86_64\RendererCore\ 
+		const std::filesystem::path shaderPath = Utility::GetBinDirectory().string() + Utility::GetOutDirectory().string();
+		const std::string shaderPathStr = shaderPath.string();
+
+		const std::filesystem::path pixelShaderPath = shaderPathStr + "DefaultRectPS.cso";
+		const std::filesystem::path vertexShaderPath = shaderPathStr + "DefaultRectVS.cso";
+		const std::filesystem::path shapePixelShaderPath = shaderPathStr + "ShapePS.cso";
+		const std::filesystem::path shapeVertexShaderPath = shaderPathStr + "ShapeVS.cso";
+
+		HRESULT hResult = m_SharedResourcesRef.ShaderBlob(pixelShaderPath, m_TestScene.pPixelShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, "Failed to read pixel shader.\n");
+
+		hResult = m_SharedResourcesRef.ShaderBlob(vertexShaderPath, m_TestScene.pVertexShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, "Failed to read vertex shader.\n");
+
+		hResult = m_SharedResourcesRef.ShaderBlob(shapePixelShaderPath, m_TestScene.pShapePixelShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, "Failed to read shape pixel shader.\n");
+
+		hResult = m_SharedResourcesRef.ShaderBlob(shapeVertexShaderPath, m_TestScene.pShapeVertexShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, "Failed to read shape vertex shader.\n");
 	}
 
 	void DXGraphics::InitTestScene() noexcept
@@ -194,119 +215,80 @@ namespace CTMRenderer::CTMDirectX::Graphics
 			},
 			mP_Device, mP_DeviceContext
 		);
-		RUNTIME_ASSERT(cScreenBuffer.Create() == S_OK, "Failed to create constant buffer.\n");
+		HRESULT hResult = cScreenBuffer.Create();
+		RUNTIME_ASSERT(hResult == S_OK, "Failed to create constant buffer.\n");
 		cScreenBuffer.Bind();
 
-		struct Vertex {
-			DirectX::XMFLOAT2 pos;
-		};
-
-		Geometry::DXRect sourceRect(
-			0, 0, (float)m_WindowAreaRef.width, (float)m_WindowAreaRef.height,
-			DXColor(DXColorType::BLUE)
-		);
-
-		DEBUG_PRINT("Rect Left : " << sourceRect.AABB.left << '\n');
-		DEBUG_PRINT("Rect Top : " << sourceRect.AABB.top << '\n');
-		DEBUG_PRINT("Rect Right : " << sourceRect.AABB.right << '\n');
-		DEBUG_PRINT("Rect Bottom : " << sourceRect.AABB.bottom << '\n');
-
-		// Define basic quad geometry from base quad / rect.
-		Bindable::DXStrictVertexBuffer<Vertex, 4> vGeometryBuffer(
-			{
-				{ { sourceRect.AABB.left,  sourceRect.AABB.top }   },
-				{ { sourceRect.AABB.right, sourceRect.AABB.top }   },
-				{ { sourceRect.AABB.right, sourceRect.AABB.bottom } },
-				{ { sourceRect.AABB.left,  sourceRect.AABB.bottom } }
-			},
-			mP_Device, mP_DeviceContext
-		);
-		RUNTIME_ASSERT(vGeometryBuffer.Create() == S_OK, "Failed to create buffer.\n");
-		vGeometryBuffer.Bind(); // Pass in base quad as per vertex data.
-
-		Geometry::DXRect targetRectOne(
-			100, 100, 300, 300,
-			DXColor(DXColorType::RED)
-		);
+		// Rects are instanced from the scene's base quad.
+		const Geometry::DXAABB baseQuad = ToAABB(S_TEST_SCENE.baseQuad);
+
+		m_RectPipeline = std::make_unique<RectPipeline>(
+			std::array<QuadVertex, 4>{ {
+				{ { baseQuad.left,  baseQuad.top }    },
+				{ { baseQuad.right, baseQuad.top }    },
+				{ { baseQuad.right, baseQuad.bottom } },
+				{ { baseQuad.left,  baseQuad.bottom } }
+			} },
+			S_TEST_SCENE.instances,
+			std::array<D3D11_INPUT_ELEMENT_DESC, 4>{ {
+				{ "POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, 0u, D3D11_INPUT_PER_VERTEX_DATA, 0u },
 
-		Geometry::DXRect targetRectTwo(
-			450, 250, 700, 500,
-			DXColor(DXColorType::GREEN)
+				{ "INSTANCE_SCALAR", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, 0u, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_OFFSET", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, offsetof(InstanceData, offsetXY), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_COLOR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 1u, offsetof(InstanceData, color), D3D11_INPUT_PER_INSTANCE_DATA, 1u }
+			} },
+			m_TestScene.pVertexShaderBlob, mP_Device, mP_DeviceContext
 		);
 
-		float scalarXOne = targetRectOne.AABB.width / sourceRect.AABB.width;
-		float scalarYOne = targetRectOne.AABB.height / sourceRect.AABB.height;
-
-		float scalarXTwo = targetRectTwo.AABB.width / sourceRect.AABB.width;
-		float scalarYTwo = targetRectTwo.AABB.height / sourceRect.AABB.height;
-
-		float offsetXOne = targetRectOne.AABB.left - sourceRect.AABB.left;
-		float offsetYOne = targetRectOne.AABB.top - sourceRect.AABB.top;
-
-		float offsetXTwo = targetRectTwo.AABB.left - sourceRect.AABB.left;
-		float offsetYTwo = targetRectTwo.AABB.top - sourceRect.AABB.top;
-
-		struct InstanceData {
-			DirectX::XMFLOAT2 scalarXY = {}; // X and Y scale factors.
-			DirectX::XMFLOAT2 offsetXY = {}; // X and Y scale factors.
-			DXColor color = {};
-		};
-
-		/*Bindable::DXRuntimeVertexBuffer<InstanceData> vInstanceBuffer(2, mP_Device, mP_DeviceContext);
-		
-		vInstanceBuffer.EmplaceNext(DirectX::XMFLOAT2(scalarXOne, scalarYOne), DirectX::XMFLOAT2(offsetXOne, offsetYOne), targetRectOne.color);
-		vInstanceBuffer.EmplaceNext(DirectX::XMFLOAT2(scalarXTwo, scalarYTwo), DirectX::XMFLOAT2(offsetXTwo, offsetYTwo), targetRectTwo.color);
-		RUNTIME_ASSERT(vInstanceBuffer.Create() == S_OK, "Failed to create instance buffer.\n");
-		vInstanceBuffer.Bind(1);*/
+		// Shader bytecode was read ahead of time by LoadTestShaders.
+		hResult = m_RectPipeline->Create(m_TestScene.pPixelShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
 
-		Bindable::DXStrictVertexBuffer<InstanceData, 2> vInstanceBuffer(
-			{
-				{ { scalarXOne, scalarYOne }, { offsetXOne, offsetYOne }, targetRectOne.color },
-				{ { scalarXTwo, scalarYTwo}, { offsetXTwo, offsetYTwo }, targetRectTwo.color }
-			},
-			mP_Device, mP_DeviceContext
-		);
-		RUNTIME_ASSERT(vInstanceBuffer.Create() == S_OK, "Failed to create instance buffer.\n");
-		vInstanceBuffer.Bind(1);
+		// Shapes are instanced from a quad of (-1, -1) to (1, 1), which ShapeVS.hlsl scales by each shape's half size.
+		m_ShapePipeline = std::make_unique<ShapePipeline>(
+			std::array<QuadVertex, 4>{ {
+				{ { -1.0f, -1.0f } },
+				{ {  1.0f, -1.0f } },
+				{ {  1.0f,  1.0f } },
+				{ { -1.0f,  1.0f } }
+			} },
+			m_Frame.ShapeInstances(),
+			std::array<D3D11_INPUT_ELEMENT_DESC, 7>{ {
+				{ "POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, 0u, D3D11_INPUT_PER_VERTEX_DATA, 0u },
 
-		Bindable::DXStrictIndexBuffer<short, 6, DXGI_FORMAT_R16_UINT> iBuffer(
-			{
-				0, 1, 2, // First Triangle
-				2, 3, 0  // Second Triangle
-			},
-			mP_Device, mP_DeviceContext
+				{ "INSTANCE_CENTER", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, offsetof(ShapeInstanceData, centerXY), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_HALF_SIZE", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, offsetof(ShapeInstanceData, halfSizeXY), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_CORNER_RADIUS", 0u, DXGI_FORMAT_R32_FLOAT, 1u, offsetof(ShapeInstanceData, cornerRadius), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_BORDER_WIDTH", 0u, DXGI_FORMAT_R32_FLOAT, 1u, offsetof(ShapeInstanceData, borderWidth), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_FILL_COLOR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 1u, offsetof(ShapeInstanceData, fillColor), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+				{ "INSTANCE_BORDER_COLOR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 1u, offsetof(ShapeInstanceData, borderColor), D3D11_INPUT_PER_INSTANCE_DATA, 1u }
+			} },
+			m_TestScene.pShapeVertexShaderBlob, mP_Device, mP_DeviceContext
 		);
-		RUNTIME_ASSERT(iBuffer.Create() == S_OK, "Failed to create index buffer.\n");
-		iBuffer.Bind();
-
-		// Target Path (for now) : C:\dev\projects\cpp\Direct3D\RendererTest\bin\out\Debug-windows-x86_64\RendererCore\ 
-		const std::filesystem::path shaderPath = Utility::GetBinDirectory().string() + Utility::GetOutDirectory().string();
-		const std::string shaderPathStr = shaderPath.string();
 
-		const std::filesystem::path pixelShaderPath = shaderPathStr + "DefaultRectPS.cso";
-		const std::filesystem::path vertexShaderPath = shaderPathStr + "DefaultRectVS.cso";
-		
-		Microsoft::WRL::ComPtr<ID3DBlob> pBlob;
-		DXPixelShader pixelShader(mP_Device, mP_DeviceContext);
-		RUNTIME_ASSERT(pixelShader.Create(pixelShaderPath, pBlob)  == S_OK, "Failed to create pixel shader.\n");
-		pixelShader.Bind();
+		hResult = m_ShapePipeline->Create(m_TestScene.pShapePixelShaderBlob);
+		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
 
-		DXVertexShader vertexShader(mP_Device, mP_DeviceContext);
-		RUNTIME_ASSERT(vertexShader.Create(vertexShaderPath, pBlob) == S_OK, "Failed to create vertex shader.\n");
-		vertexShader.Bind();
+		// ShapePS.hlsl outputs premultiplied color, so it's blended over the target with ONE / INV_SRC_ALPHA.
+		D3D11_BLEND_DESC blendDesc = {};
+		blendDesc.RenderTarget[0].BlendEnable = TRUE;
+		blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_ONE;
+		blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+		blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+		blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+		blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+		blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+		hResult = mP_Device->CreateBlendState(&blendDesc, mP_PremultipliedBlend.GetAddressOf());
+		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
 
-		DXInputLayout<4> inputLayout(
-			{
-				{ "POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, 0u, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		// The default state, with the scissor test on, so draws stay within the damage rect being redrawn.
+		D3D11_RASTERIZER_DESC rasterizerDesc = CD3D11_RASTERIZER_DESC(CD3D11_DEFAULT());
+		rasterizerDesc.ScissorEnable = TRUE;
 
-				{ "INSTANCE_SCALAR", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, 0u, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
-				{ "INSTANCE_OFFSET", 0u, DXGI_FORMAT_R32G32_FLOAT, 1u, sizeof(DirectX::XMFLOAT2), D3D11_INPUT_PER_INSTANCE_DATA, 1u },
-				{ "INSTANCE_COLOR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 1u, sizeof(DirectX::XMFLOAT2) * 2, D3D11_INPUT_PER_INSTANCE_DATA, 1u }
-			},
-			pBlob, mP_Device, mP_DeviceContext
-		);
-		RUNTIME_ASSERT(inputLayout.Create() == S_OK, "Failed to create input layout.\n");
-		inputLayout.Bind();
+		hResult = mP_Device->CreateRasterizerState(&rasterizerDesc, mP_ScissorRasterizer.GetAddressOf());
+		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
 
 		Bindable::DXViewport viewport(
 			0.0f, // Top-left x.
@@ -329,14 +311,74 @@ namespace CTMRenderer::CTMDirectX::Graphics
 	{
 		// Rebind the RenderTargetView.
 		BindRTV();
+		mP_DeviceContext->RSSetState(mP_ScissorRasterizer.Get());
+
+		// Buffers are presented in turn, so once each was drawn, the back buffer holds the frame from BUFFER_COUNT frames ago.
+		m_Frame.Begin(m_PresentedFrames < BUFFER_COUNT ? 0 : BUFFER_COUNT);
 
-		mP_DeviceContext->ClearRenderTargetView(mP_RTV.Get(), m_ClearColor.rgba);
+		m_DamageRects.clear();
+
+		for (const DamageRect& rect : m_Frame.DamageRects())
+			m_DamageRects.push_back({ rect.left, rect.top, rect.right, rect.bottom });
+	}
+
+	void DXGraphics::Draw(Threading::WorkerPool& pool) noexcept
+	{
+		m_Frame.Execute(pool);
+	}
+
+	SceneFramePasses DXGraphics::FramePasses() noexcept
+	{
+		SceneFramePasses passes;
+
+		// ClearRenderTargetView ignores the scissor, ClearView takes the rects instead.
+		passes.Clear = [this] {
+			if (!m_DamageRects.empty())
+				mP_DeviceContext->ClearView(mP_RTV.Get(), m_ClearColor.rgba, m_DamageRects.data(), (UINT)m_DamageRects.size());
+		};
+
+		passes.Rects = [this] { DrawTestRects(); };
+		passes.Shapes = [this] { DrawTestShapes(); };
+
+		// Only declared when there's text, so views without it never initialize Direct2D or DirectWrite.
+		if (!m_SettingsRef.TestText.empty())
+			passes.Text = [this] { DrawTestText(); };
+
+		return passes;
+	}
+
+	template <typename DrawFunction>
+	void DXGraphics::DrawDamaged(DrawFunction&& draw) noexcept
+	{
+		for (const D3D11_RECT& rect : m_DamageRects)
+		{
+			mP_DeviceContext->RSSetScissorRects(1, &rect);
+			draw();
+		}
 	}
 
-	void DXGraphics::Draw() noexcept
+	void DXGraphics::DrawTestRects() noexcept
 	{
-		mP_DeviceContext->DrawIndexedInstanced(6, 2, 0, 0, 0);
+		// Every pass binds its own pipeline, as the passes before it may have bound another one.
+		m_RectPipeline->Bind();
+		mP_DeviceContext->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFFu);
+
+		DrawDamaged([this] { mP_DeviceContext->DrawIndexedInstanced(RectPipeline::S_INDICES, RectPipeline::S_INSTANCES, 0, 0, 0); });
+		RUNTIME_ASSERT(m_InfoQueue.IsQueueEmpty() == true, m_InfoQueue.GetMessages());
+	}
+
+	void DXGraphics::DrawTestShapes() noexcept
+	{
+		m_ShapePipeline->Bind();
+		mP_DeviceContext->OMSetBlendState(mP_PremultipliedBlend.Get(), nullptr, 0xFFFFFFFFu);
+
+		DrawDamaged([this] { mP_DeviceContext->DrawIndexedInstanced(ShapePipeline::S_INDICES, ShapePipeline::S_INSTANCES, 0, 0, 0); });
 		RUNTIME_ASSERT(m_InfoQueue.IsQueueEmpty() == true, m_InfoQueue.GetMessages());
+	}
+
+	void DXGraphics::DrawTestText() noexcept
+	{
+		m_Modules.Require(m_TextModuleID);
 
 		m_2DRender.pRTV->BeginDraw();
 		// Note to self : Clearing the D2D RTV when it references the same texture as the D3D RTV 
@@ -345,13 +387,22 @@ namespace CTMRenderer::CTMDirectX::Graphics
 
 		//m_2DRender.pRTV->SetTransform(D2D1::IdentityMatrix());
 
-		m_2DRender.pRTV->DrawText(
-			m_TextRender.text.data(),
-			(UINT32)m_TextRender.text.size(),
-			m_TextRender.pTextFormat.Get(),
-			m_TextRender.layoutRect,
-			m_TextRender.pSCBrush.Get()
-		);
+		// Direct2D ignores the Direct3D scissor, so text is clipped to each damage rect on its own.
+		// Antialiased edges drawn again over the same text would otherwise thicken.
+		for (const D3D11_RECT& rect : m_DamageRects)
+		{
+			m_2DRender.pRTV->PushAxisAlignedClip(D2D1::RectF((FLOAT)rect.left, (FLOAT)rect.top, (FLOAT)rect.right, (FLOAT)rect.bottom), D2D1_ANTIALIAS_MODE_ALIASED);
+
+			m_2DRender.pRTV->DrawText(
+				m_TextRender.text.data(),
+				(UINT32)m_TextRender.text.size(),
+				m_TextRender.pTextFormat.Get(),
+				m_TextRender.layoutRect,
+				m_TextRender.pSCBrush.Get()
+			);
+
+			m_2DRender.pRTV->PopAxisAlignedClip();
+		}
 
 		HRESULT hResult = m_2DRender.pRTV->EndDraw();
 		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
@@ -362,6 +413,8 @@ namespace CTMRenderer::CTMDirectX::Graphics
 		HRESULT hResult = mP_SwapChain->Present(SYNC_INTERVAL, 0u);
 		RUNTIME_ASSERT(m_InfoQueue.IsQueueEmpty() == true, m_InfoQueue.GetMessages());
 		RUNTIME_ASSERT(hResult == S_OK, Utility::TranslateHResult(hResult));
+
+		++m_PresentedFrames;
 	}
 
 	void DXGraphics::BindRTV() const noexcept
@@ -0,0 +1,84 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/DirectX/Graphics/DXSharedResources.hpp"
+#include "CTMRenderer/DirectX/Graphics/Bindable/DXShader.hpp"
+
+namespace CTMRenderer::CTMDirectX::Graphics
+{
+	HRESULT DXSharedResources::ShaderBlob(const std::filesystem::path& shaderPath, Microsoft::WRL::ComPtr<ID3DBlob>& pBlobOut) noexcept
+	{
+		const std::wstring key = std::filesystem::absolute(shaderPath).wstring();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		auto blobIt = m_ShaderBlobs.find(key);
+		if (blobIt == m_ShaderBlobs.end())
+		{
+			Microsoft::WRL::ComPtr<ID3DBlob> pBlob;
+
+			HRESULT hResult = ReadShaderBlob(shaderPath, pBlob);
+			if (hResult != S_OK)
+				return hResult;
+
+			blobIt = m_ShaderBlobs.emplace(key, std::move(pBlob)).first;
+		}
+
+		pBlobOut = blobIt->second;
+		return S_OK;
+	}
+
+	HRESULT DXSharedResources::TextFormat(std::wstring_view familyName, float fontSize, Microsoft::WRL::ComPtr<IDWriteTextFormat>& pTextFormatOut) noexcept
+	{
+		const std::wstring key = std::wstring(familyName) + L'@' + std::to_wstring(fontSize);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		auto formatIt = m_TextFormats.find(key);
+		if (formatIt == m_TextFormats.end())
+		{
+			HRESULT hResult = S_OK;
+
+			// The shared factory also shares its font cache with every other shared factory of the process.
+			if (mP_DWriteFactory == nullptr)
+			{
+				hResult = DWriteCreateFactory(
+					DWRITE_FACTORY_TYPE_SHARED,
+					__uuidof(IDWriteFactory),
+					reinterpret_cast<IUnknown**>(mP_DWriteFactory.GetAddressOf())
+				);
+
+				if (hResult != S_OK)
+					return hResult;
+			}
+
+			Microsoft::WRL::ComPtr<IDWriteTextFormat> pTextFormat;
+			const std::wstring family(familyName);
+
+			hResult = mP_DWriteFactory->CreateTextFormat(
+				family.c_str(), // Font family name.
+				NULL,           // Font collection (NULL sets it to use the system font collection).
+				DWRITE_FONT_WEIGHT_REGULAR,
+				DWRITE_FONT_STYLE_NORMAL,
+				DWRITE_FONT_STRETCH_NORMAL,
+				fontSize,
+				L"en-us",
+				pTextFormat.GetAddressOf()
+			);
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = pTextFormat->SetTextAlignment(DWRITE_TEXT_ALIGNMENT_CENTER);
+			if (hResult != S_OK)
+				return hResult;
+
+			hResult = pTextFormat->SetParagraphAlignment(DWRITE_PARAGRAPH_ALIGNMENT_CENTER);
+			if (hResult != S_OK)
+				return hResult;
+
+			formatIt = m_TextFormats.emplace(key, std::move(pTextFormat)).first;
+		}
+
+		pTextFormatOut = formatIt->second;
+		return S_OK;
+	}
+}
@@ -3,7 +3,7 @@
 
 namespace CTMRenderer::CTMDirectX::Graphics::Geometry
 {
-	IShape::IShape(ShapeType type)
+	IShape::IShape(ShapeType type) noexcept
 		: m_Type(type)
 	{
 
@@ -13,4 +13,40 @@ namespace CTMRenderer::CTMDirectX::Graphics::Geometry
 		: IShape(ShapeType::RECT), AABB(left, top, right, bottom), color(color)
 	{
 	}
-}
\ No newline at end of file
+
+	DXAABB& DXRect::Aabb() noexcept
+	{
+		return AABB;
+	}
+
+	const DXColor& DXRect::Color() const noexcept
+	{
+		return color;
+	}
+
+	DXCircle::DXCircle(float centerX, float centerY, float radius, const DXColor& color, float borderWidth, const DXColor& borderColor) noexcept
+		: IShape(ShapeType::CIRCLE), m_CenterX(centerX), m_CenterY(centerY), m_Radius(radius), m_BorderWidth(borderWidth),
+		  m_Color(color), m_BorderColor(borderColor)
+	{
+	}
+
+	ShapeInstanceData DXCircle::Instance() const noexcept
+	{
+		return { { m_CenterX, m_CenterY }, { m_Radius, m_Radius }, m_Radius, m_BorderWidth, m_Color, m_BorderColor };
+	}
+
+	DXRoundedRect::DXRoundedRect(float left, float top, float right, float bottom, float cornerRadius, const DXColor& color, float borderWidth, const DXColor& borderColor) noexcept
+		: IShape(ShapeType::ROUNDED_RECT), m_AABB(left, top, right, bottom), m_CornerRadius(cornerRadius), m_BorderWidth(borderWidth),
+		  m_Color(color), m_BorderColor(borderColor)
+	{
+	}
+
+	ShapeInstanceData DXRoundedRect::Instance() const noexcept
+	{
+		return {
+			{ (m_AABB.left + m_AABB.right) * 0.5f, (m_AABB.top + m_AABB.bottom) * 0.5f },
+			{ m_AABB.width * 0.5f, m_AABB.height * 0.5f },
+			m_CornerRadius, m_BorderWidth, m_Color, m_BorderColor
+		};
+	}
+}
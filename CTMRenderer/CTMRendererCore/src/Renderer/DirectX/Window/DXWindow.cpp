@@ -50,6 +50,18 @@ namespace CTMRenderer::CTMDirectX::Window
     {
         SetWindowTextW(m_WindowHandle, title.c_str());
     }
+
+    void DXWindow::Close() noexcept
+    {
+        if (m_WindowHandle == nullptr)
+            return;
+
+        DestroyWindow(m_WindowHandle);
+        m_WindowHandle = nullptr;
+
+        m_IsShown.store(false, std::memory_order_release);
+        m_IsRunning.store(false, std::memory_order_release);
+    }
     #pragma endregion
 
     #pragma region Private Functions
@@ -57,28 +69,7 @@ namespace CTMRenderer::CTMDirectX::Window
     {
         RUNTIME_ASSERT(m_IsInitialized.load() == false, "The window is already initialized.\n");
 
-        WNDCLASSEXW wndClass = {};
-        wndClass.cbSize = sizeof(WNDCLASSEXW);
-        wndClass.lpfnWndProc = WndProcSetup;    /*  Set the window procedure to the static setup function that will eventually thunk (redirect / forward)
-                                                 *  Window's messages to an instance function that has access to Window and Renderer state.
-                                                 *
-                                                 *  The function assigned to lpfnWndProc has to be static due to how instance functions work in C++,
-                                                 *  and how windows procedures are defined in the WinAPI.
-                                                 *
-                                                 *  For context, Instance functions implicitly take in an argument of this, which is incompatible with
-                                                 *  the WinAPI window procedure standard, thus static functions are required as they omit the this argument.
-                                                 *
-                                                 *  In conclusion, the indirection is required to be able to access CTMRenderer::Window state in the window procedure without
-                                                 *  the introduction of global state.
-                                                 */
-
-        wndClass.hInstance = GetModuleHandleW(nullptr);
-        RUNTIME_ASSERT(wndClass.hInstance != nullptr, "Failed to get the HINSTANCE.\n");
-
-        wndClass.lpszClassName = SP_WINDOW_CLASS_NAME;
-
-        bool registeredClass = RegisterClassEx(&wndClass);
-        RUNTIME_ASSERT(registeredClass != false, "Failed to register window class.\n");
+        RegisterWindowClass();
 
         constexpr int windowSizePadding = 100;
         RECT windowClientAreaRect = {};
@@ -114,6 +105,38 @@ namespace CTMRenderer::CTMDirectX::Window
         m_IsShown.store(true, std::memory_order_release);
     }
 
+    void DXWindow::RegisterWindowClass() noexcept
+    {
+        // Every window of the process shares the class, so registering it per window would fail for the second one.
+        static std::once_flag s_RegisteredClass;
+
+        std::call_once(s_RegisteredClass, []
+        {
+            WNDCLASSEXW wndClass = {};
+            wndClass.cbSize = sizeof(WNDCLASSEXW);
+            wndClass.lpfnWndProc = WndProcSetup;    /*  Set the window procedure to the static setup function that will eventually thunk (redirect / forward)
+                                                     *  Window's messages to an instance function that has access to Window and Renderer state.
+                                                     *
+                                                     *  The function assigned to lpfnWndProc has to be static due to how instance functions work in C++,
+                                                     *  and how windows procedures are defined in the WinAPI.
+                                                     *
+                                                     *  For context, Instance functions implicitly take in an argument of this, which is incompatible with
+                                                     *  the WinAPI window procedure standard, thus static functions are required as they omit the this argument.
+                                                     *
+                                                     *  In conclusion, the indirection is required to be able to access CTMRenderer::Window state in the window procedure without
+                                                     *  the introduction of global state.
+                                                     */
+
+            wndClass.hInstance = GetModuleHandleW(nullptr);
+            RUNTIME_ASSERT(wndClass.hInstance != nullptr, "Failed to get the HINSTANCE.\n");
+
+            wndClass.lpszClassName = SP_WINDOW_CLASS_NAME;
+
+            bool registeredClass = RegisterClassEx(&wndClass);
+            RUNTIME_ASSERT(registeredClass != false, "Failed to register window class.\n");
+        });
+    }
+
     LRESULT CALLBACK DXWindow::WndProcSetup(HWND windowHandle, UINT msgCode, WPARAM wParam, LPARAM lParam) noexcept
     {
         // If we get a message before the WM_NCCREATE message, handle with default window procedure provided by the WinAPI.
@@ -153,7 +176,9 @@ namespace CTMRenderer::CTMDirectX::Window
                 return S_OK;
             // Fall through if Esc was pressed.
         case WM_CLOSE:
-            PostQuitMessage(0);
+            // End only this window's renderer, other renderers may share the thread and its message queue.
+            if (m_IsRunning.exchange(false, std::memory_order_acq_rel))
+                m_EventDispatcherRef.QueueEvent<Event::EndEvent>(1738u);
             return S_OK;
         case WM_MOUSEMOVE:
             m_EventDispatcherRef.QueueEvent<Event::MouseMoveEvent>(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
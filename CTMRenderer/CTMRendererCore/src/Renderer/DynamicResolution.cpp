@@ -0,0 +1,91 @@
+#include "Core/CorePCH.hpp"
+#include "CTMRenderer/DynamicResolution.hpp"
+
+namespace CTMRenderer
+{
+	DynamicResolution::DynamicResolution(const DynamicResolutionSettings& settings) noexcept
+		: m_Settings(settings), m_Scale(settings.MaxScale)
+	{
+		RUNTIME_ASSERT(settings.TargetFrameMillis > 0, "Target frame time must be greater than 0.\n");
+		RUNTIME_ASSERT(settings.MinScale > 0 && settings.MinScale <= settings.MaxScale, "Invalid scale range.\n");
+		RUNTIME_ASSERT(settings.ScaleStep > 0, "Scale step must be greater than 0.\n");
+		RUNTIME_ASSERT(settings.UpscaleThreshold <= settings.DownscaleThreshold, "Upscale threshold above the downscale threshold will oscillate.\n");
+	}
+
+	bool DynamicResolution::Update(double frameMillis) noexcept
+	{
+		if (!m_HasSample)
+		{
+			m_AverageMillis = frameMillis;
+			m_HasSample = true;
+		}
+		else
+			m_AverageMillis += (frameMillis - m_AverageMillis) * m_Settings.Smoothing;
+
+		const double budget = m_Settings.TargetFrameMillis;
+
+		if (m_AverageMillis > budget * m_Settings.DownscaleThreshold)
+		{
+			m_HeadroomFrames = 0;
+
+			if (++m_OverBudgetFrames >= m_Settings.DownscaleFrames && m_Scale > m_Settings.MinScale)
+				return SetScale(m_Scale - m_Settings.ScaleStep);
+
+			return false;
+		}
+
+		m_OverBudgetFrames = 0;
+
+		if (m_Scale >= m_Settings.MaxScale)
+			return false;
+
+		// Fill cost grows with the pixel count, so predict the cost at the next scale before committing to it.
+		const double nextScale = std::min(m_Scale + m_Settings.ScaleStep, m_Settings.MaxScale);
+		const double growth = (nextScale * nextScale) / ((double)m_Scale * m_Scale);
+
+		if (m_AverageMillis * growth < budget * m_Settings.UpscaleThreshold)
+		{
+			if (++m_HeadroomFrames >= m_Settings.UpscaleFrames)
+				return SetScale((float)nextScale);
+		}
+		else
+			m_HeadroomFrames = 0;
+
+		return false;
+	}
+
+	void DynamicResolution::Reset() noexcept
+	{
+		m_Scale = m_Settings.MaxScale;
+		m_AverageMillis = 0.0;
+		m_OverBudgetFrames = 0;
+		m_HeadroomFrames = 0;
+		m_HasSample = false;
+	}
+
+	CTMDirectX::Window::Geometry::WindowArea DynamicResolution::ScaledArea(const CTMDirectX::Window::Geometry::WindowArea& area) const noexcept
+	{
+		const unsigned int width = (unsigned int)std::lround(area.width * m_Scale);
+		const unsigned int height = (unsigned int)std::lround(area.height * m_Scale);
+
+		return CTMDirectX::Window::Geometry::WindowArea(std::max(width, 1u), std::max(height, 1u));
+	}
+
+	bool DynamicResolution::SetScale(float scale) noexcept
+	{
+		const float newScale = std::clamp(scale, m_Settings.MinScale, m_Settings.MaxScale);
+
+		if (newScale == m_Scale)
+			return false;
+
+		// Carry the average over to the new pixel count, otherwise the stale average would trigger further steps.
+		m_AverageMillis *= ((double)newScale * newScale) / ((double)m_Scale * m_Scale);
+		m_Scale = newScale;
+
+		// Restart both counters so a change has to be confirmed by frames rendered at the new scale.
+		m_OverBudgetFrames = 0;
+		m_HeadroomFrames = 0;
+
+		return true;
+	}
+}
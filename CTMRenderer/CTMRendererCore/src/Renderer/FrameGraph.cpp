@@ -0,0 +1,298 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/FrameGraph.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		constexpr size_t S_NONE = std::numeric_limits<size_t>::max();
+
+		inline void AddUnique(std::vector<size_t>& values, size_t value) noexcept
+		{
+			if (std::find(values.begin(), values.end(), value) == values.end())
+				values.emplace_back(value);
+		}
+	}
+
+	#pragma region Public API
+	FrameResourceID FrameGraph::Import(std::string_view name) noexcept
+	{
+		RUNTIME_ASSERT(!m_IsCompiled, "Resources can't be added to a compiled frame graph.\n");
+
+		m_Resources.emplace_back().name = name;
+		return m_Resources.size() - 1;
+	}
+
+	FrameResourceID FrameGraph::CreateTransient(std::string_view name, const FrameResourceDesc& desc) noexcept
+	{
+		RUNTIME_ASSERT(!m_IsCompiled, "Resources can't be added to a compiled frame graph.\n");
+
+		Resource& resource = m_Resources.emplace_back();
+		resource.name = name;
+		resource.desc = desc;
+		resource.isTransient = true;
+
+		return m_Resources.size() - 1;
+	}
+
+	void FrameGraph::MarkOutput(FrameResourceID resource) noexcept
+	{
+		RUNTIME_ASSERT(!m_IsCompiled, "Outputs can't be changed on a compiled frame graph.\n");
+		RUNTIME_ASSERT(resource < m_Resources.size(), "Resource doesn't exist.\n");
+
+		m_Resources[resource].isOutput = true;
+	}
+
+	FramePassID FrameGraph::AddPass(std::string_view name, std::initializer_list<FrameResourceID> reads, std::initializer_list<FrameResourceID> writes,
+		std::function<void()> execute, Threading::TaskAffinity affinity) noexcept
+	{
+		RUNTIME_ASSERT(!m_IsCompiled, "Passes can't be added to a compiled frame graph.\n");
+		RUNTIME_ASSERT(execute != nullptr, "Pass function is empty.\n");
+
+		Pass& pass = m_Passes.emplace_back();
+		pass.name = name;
+		pass.reads = reads;
+		pass.writes = writes;
+		pass.execute = std::move(execute);
+		pass.affinity = affinity;
+
+		RUNTIME_ASSERT(std::all_of(reads.begin(), reads.end(), [this](FrameResourceID resource) { return resource < m_Resources.size(); }),
+			"Pass reads a resource that doesn't exist.\n");
+		RUNTIME_ASSERT(std::all_of(writes.begin(), writes.end(), [this](FrameResourceID resource) { return resource < m_Resources.size(); }),
+			"Pass writes a resource that doesn't exist.\n");
+
+		return m_Passes.size() - 1;
+	}
+
+	void FrameGraph::Compile() noexcept
+	{
+		RUNTIME_ASSERT(!m_IsCompiled, "Frame graph is already compiled.\n");
+
+		Cull();
+		Order();
+		Alias();
+
+		m_Stats.passes = m_Passes.size();
+		m_Stats.culledPasses = m_Passes.size() - m_LivePasses.size();
+		m_Stats.physicalTransients = m_PhysicalDescs.size();
+		m_Timeline.resize(m_LivePasses.size());
+
+		for (size_t position = 0; position < m_LivePasses.size(); ++position)
+			m_Timeline[position].name = m_Passes[m_LivePasses[position]].name;
+
+		m_IsCompiled = true;
+	}
+
+	void FrameGraph::Execute(Threading::WorkerPool& pool) noexcept
+	{
+		RUNTIME_ASSERT(m_IsCompiled, "Frame graph must be compiled before it's executed.\n");
+
+		Timer::Timer timer;
+
+		if (m_IsSerial)
+		{
+			// Nothing may leave the calling thread, scheduling would only add overhead.
+			for (size_t position = 0; position < m_LivePasses.size(); ++position)
+			{
+				Threading::TaskRecord& record = m_Timeline[position];
+				record.startMillis = timer.ElapsedMillis();
+
+				m_Passes[m_LivePasses[position]].execute();
+
+				record.endMillis = timer.ElapsedMillis();
+			}
+		}
+		else
+		{
+			Threading::TaskGraph graph;
+
+			for (FramePassID id : m_LivePasses)
+			{
+				const Pass& pass = m_Passes[id];
+				graph.Add(pass.name, [&pass] { pass.execute(); }, pass.dependencies, pass.affinity);
+			}
+
+			graph.Run(pool);
+			m_Timeline = graph.Timeline();
+		}
+
+		m_Stats.executeMillis = timer.ElapsedMillis();
+	}
+
+	void FrameGraph::PrintReport(std::ostream& stream) const noexcept
+	{
+		stream << "Frame graph (" << m_Stats.passes - m_Stats.culledPasses << " of " << m_Stats.passes << " passes, "
+			<< m_Stats.physicalTransients << " physical for " << m_Stats.transients << " transients) :\n";
+
+		for (const Pass& pass : m_Passes)
+		{
+			stream << "  " << pass.name << " : ";
+
+			if (!pass.isLive)
+			{
+				stream << "culled\n";
+				continue;
+			}
+
+			stream << (pass.affinity == Threading::TaskAffinity::CALLER ? "caller" : "any thread");
+
+			for (FrameResourceID resource : pass.writes)
+			{
+				stream << ", writes " << m_Resources[resource].name;
+
+				if (m_Resources[resource].physicalIndex != S_NOT_PHYSICAL)
+					stream << " (physical " << m_Resources[resource].physicalIndex << ')';
+			}
+
+			stream << '\n';
+		}
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void FrameGraph::Cull() noexcept
+	{
+		std::vector<FramePassID> lastWriters(m_Resources.size(), S_NONE);
+
+		for (FramePassID id = 0; id < m_Passes.size(); ++id)
+		{
+			Pass& pass = m_Passes[id];
+
+			for (FrameResourceID resource : pass.reads)
+			{
+				RUNTIME_ASSERT(!m_Resources[resource].isTransient || lastWriters[resource] != S_NONE, "A transient is read before it was written.\n");
+
+				if (lastWriters[resource] != S_NONE)
+					AddUnique(pass.producers, lastWriters[resource]);
+			}
+
+			for (FrameResourceID resource : pass.writes)
+				lastWriters[resource] = id;
+		}
+
+		for (FrameResourceID resource = 0; resource < m_Resources.size(); ++resource)
+			if (m_Resources[resource].isOutput && lastWriters[resource] != S_NONE)
+				m_Passes[lastWriters[resource]].isLive = true;
+
+		// Producers are always declared before their readers, so a single backwards walk reaches every contributing pass.
+		for (FramePassID id = m_Passes.size(); id-- > 0;)
+			if (m_Passes[id].isLive)
+				for (FramePassID producer : m_Passes[id].producers)
+					m_Passes[producer].isLive = true;
+
+		for (FramePassID id = 0; id < m_Passes.size(); ++id)
+			if (m_Passes[id].isLive)
+				m_LivePasses.emplace_back(id);
+	}
+
+	void FrameGraph::Order() noexcept
+	{
+		// Only live passes are ordered against each other, so a culled pass can't leave two live writers unordered.
+		std::vector<size_t> lastWriters(m_Resources.size(), S_NONE);   // Positions in m_LivePasses.
+		std::vector<std::vector<size_t>> readers(m_Resources.size()); // Positions reading the last write.
+
+		for (size_t position = 0; position < m_LivePasses.size(); ++position)
+		{
+			Pass& pass = m_Passes[m_LivePasses[position]];
+
+			// Reads wait for the last write. Writes also wait for the last write, and for everything still reading it.
+			for (FrameResourceID resource : pass.reads)
+				if (lastWriters[resource] != S_NONE)
+					AddUnique(pass.dependencies, lastWriters[resource]);
+
+			for (FrameResourceID resource : pass.writes)
+			{
+				if (lastWriters[resource] != S_NONE)
+					AddUnique(pass.dependencies, lastWriters[resource]);
+
+				for (size_t reader : readers[resource])
+					if (reader != position)
+						AddUnique(pass.dependencies, reader);
+			}
+
+			for (FrameResourceID resource : pass.writes)
+			{
+				lastWriters[resource] = position;
+				readers[resource].clear();
+			}
+
+			for (FrameResourceID resource : pass.reads)
+				if (lastWriters[resource] != position)
+					readers[resource].emplace_back(position);
+
+			if (pass.affinity != Threading::TaskAffinity::CALLER)
+				m_IsSerial = false;
+		}
+	}
+
+	void FrameGraph::Alias() noexcept
+	{
+		struct Physical
+		{
+			FrameResourceDesc desc;
+			std::vector<size_t> users; // Positions using the current occupant, in order.
+			bool isPinned = false;     // Holds an output, which lives past the frame.
+		};
+
+		std::vector<std::vector<size_t>> users(m_Resources.size());
+
+		for (size_t position = 0; position < m_LivePasses.size(); ++position)
+		{
+			const Pass& pass = m_Passes[m_LivePasses[position]];
+
+			for (FrameResourceID resource : pass.reads)
+				if (m_Resources[resource].isTransient && (users[resource].empty() || users[resource].back() != position))
+					users[resource].emplace_back(position);
+			for (FrameResourceID resource : pass.writes)
+				if (m_Resources[resource].isTransient && (users[resource].empty() || users[resource].back() != position))
+					users[resource].emplace_back(position);
+		}
+
+		std::vector<Physical> physicals;
+
+		for (size_t position = 0; position < m_LivePasses.size(); ++position)
+		{
+			Pass& pass = m_Passes[m_LivePasses[position]];
+
+			// Transients are always written first, so a transient's first user is a writer.
+			for (FrameResourceID id : pass.writes)
+			{
+				Resource& resource = m_Resources[id];
+
+				if (!resource.isTransient || resource.physicalIndex != S_NOT_PHYSICAL)
+					continue;
+
+				size_t physicalIndex = S_NONE;
+
+				for (size_t i = 0; i < physicals.size() && physicalIndex == S_NONE; ++i)
+					if (!physicals[i].isPinned && physicals[i].desc == resource.desc && physicals[i].users.back() < position)
+						physicalIndex = i;
+
+				if (physicalIndex == S_NONE)
+				{
+					physicalIndex = physicals.size();
+					physicals.emplace_back().desc = resource.desc;
+				}
+				else
+				{
+					// The previous occupant's users come first in declaration order, but may not be ordered
+					// against this pass. Waiting for them keeps parallel execution from overwriting what they use.
+					for (size_t user : physicals[physicalIndex].users)
+						AddUnique(pass.dependencies, user);
+				}
+
+				physicals[physicalIndex].users = users[id];
+				physicals[physicalIndex].isPinned = resource.isOutput;
+				resource.physicalIndex = physicalIndex;
+
+				++m_Stats.transients;
+			}
+		}
+
+		for (const Physical& physical : physicals)
+			m_PhysicalDescs.emplace_back(physical.desc);
+	}
+	#pragma endregion
+}
@@ -0,0 +1,176 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/IRenderer.hpp"
+
+namespace CTMRenderer
+{
+	IRenderer::IRenderer(const Threading::ThreadTopology& threadTopology) noexcept
+		: m_OwnedWorkerPool(std::make_unique<Threading::WorkerPool>(threadTopology)), m_WorkerPool(*m_OwnedWorkerPool),
+		  m_EventThreadPlacement(threadTopology.EventThread),
+		  // The passed onNotifyFunc will be called when an event is dispatched.
+		  m_EventListener(std::bind(&IRenderer::HandleEvent, this, std::placeholders::_1))
+	{
+	}
+
+	IRenderer::IRenderer(Threading::WorkerPool& sharedWorkerPool) noexcept
+		: m_WorkerPool(sharedWorkerPool),
+		  m_EventListener(std::bind(&IRenderer::HandleEvent, this, std::placeholders::_1))
+	{
+	}
+
+	#pragma region Public API
+	void IRenderer::Start() noexcept
+	{
+		RUNTIME_ASSERT(!IsHosted(), "Hosted renderers are started by their RendererHost.\n");
+
+		m_ShouldRun.store(true, std::memory_order_release);
+		m_EventThread = std::thread(&IRenderer::EventLoop, this);
+
+		// Wait for the event loop to start.
+		std::unique_lock<std::mutex> lock(m_RendererMutex);
+		m_RendererCV.wait(lock, [this] { return m_EventLoopStarted.load(std::memory_order_acquire); });
+	}
+
+	void IRenderer::JoinForShutdown() noexcept
+	{
+		RUNTIME_ASSERT(!IsHosted(), "Hosted renderers are joined through their RendererHost.\n");
+
+		m_EventThread.join();
+	}
+
+	void IRenderer::Attach() noexcept
+	{
+		m_EventSystem.Dispatcher().Subscribe(&m_EventListener);
+		m_ShouldRun.store(true, std::memory_order_release);
+
+		// Queued on the driving thread, so anything created on start lives on the thread that steps the renderer.
+		m_EventSystem.Dispatcher().QueueEvent<Event::StartEvent>(1738u); // ayy
+
+		{
+			std::lock_guard<std::mutex> lock(m_RendererMutex);
+			m_EventLoopStarted.store(true, std::memory_order_release);
+
+			m_RendererCV.notify_one();
+		}
+	}
+
+	void IRenderer::Detach() noexcept
+	{
+		m_EventSystem.Dispatcher().Unsubscribe(&m_EventListener);
+	}
+	#pragma endregion
+
+	#pragma region Protected Functions
+	void IRenderer::OnEnd([[maybe_unused]] const Event::EndEvent* pEndEvent) noexcept
+	{
+		RUNTIME_ASSERT(pEndEvent != nullptr, "End event is nullptr. How TF did this happen?\n");
+		RUNTIME_ASSERT(m_EventLoopStarted.load(std::memory_order_acquire) == true, "Event loop hasn't started.\n");
+		RUNTIME_ASSERT(m_RendererStarted.load(std::memory_order_acquire) == true, "Renderer hasn't started.\n");
+		RUNTIME_ASSERT(m_ShouldRun.load(std::memory_order_acquire) == true, "Renderer has already shutdown.\n");
+
+		DEBUG_PRINT("End args : " << pEndEvent->PlaceholderArgs() << '\n');
+
+		m_ShouldRun.store(false, std::memory_order_release);
+
+		DEBUG_PRINT("Renderer ended.\n");
+	}
+
+	void IRenderer::OnMouseMove(const Event::MouseMoveEvent*) noexcept
+	{
+	}
+
+	void IRenderer::DispatchQueuedEvents() noexcept
+	{
+		Event::EventDispatcher& eventDispatcher = m_EventSystem.Dispatcher();
+
+		if (eventDispatcher.IsEventQueued())
+			eventDispatcher.DispatchQueued();
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void IRenderer::EventLoop() noexcept
+	{
+		Threading::ApplyThreadPlacement(m_EventThreadPlacement);
+
+		Attach();
+
+		DEBUG_PRINT("Renderer event loop started.\n");
+
+		const double targetFrameDuration = TargetFPS() != 0 ? 1000.0 / TargetFPS() : 0.0;
+		double actualFrameDuration = 0.0;
+		double frameStartTime = 0.0;
+		double remainingFrameTime = 0.0;
+
+		while (m_ShouldRun.load(std::memory_order_acquire))
+		{
+			frameStartTime = m_Timer.ElapsedMillis();
+
+			Step(frameStartTime);
+
+			actualFrameDuration = m_Timer.ElapsedMillis() - frameStartTime;
+			remainingFrameTime = std::max(targetFrameDuration - actualFrameDuration, 0.0);
+			RUNTIME_ASSERT(actualFrameDuration >= 0, "YOU DID SOMETHING WRONG YOU IDIOT!!!\n");
+
+			if (remainingFrameTime > 0.0)
+				std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(remainingFrameTime));
+		}
+
+		Detach();
+
+		DEBUG_PRINT("Event loop end.\n");
+	}
+
+	void IRenderer::HandleEvent(Event::IEvent* pEvent) noexcept
+	{
+		RUNTIME_ASSERT(pEvent != nullptr, "Event received is nullptr.\n");
+
+		Event::GenericEventType genericType = pEvent->GenericType();
+
+		switch (genericType)
+		{
+		case Event::GenericEventType::CTM_ANY:
+			RUNTIME_ASSERT(false, "No events should have CTM_ANY as their GenericEventType, as it is a marker type used for event listening.\n");
+			break;
+		case Event::GenericEventType::CTM_STATE_EVENT:
+			HandleStateEvent(pEvent);
+			break;
+		case Event::GenericEventType::CTM_MOUSE_EVENT:
+			HandleMouseEvent(pEvent);
+			break;
+		default: break;
+		}
+	}
+
+	void IRenderer::HandleStateEvent(Event::IEvent* pEvent) noexcept
+	{
+		RUNTIME_ASSERT(pEvent->GenericType() == Event::GenericEventType::CTM_STATE_EVENT, "The provided event wasn't a CTM_STATE_EVENT.\n");
+
+		switch (pEvent->ConcreteType())
+		{
+		case Event::ConcreteEventType::CTM_STATE_START_EVENT:
+			OnStart(Event::StartEvent::Cast(pEvent));
+			break;
+		case Event::ConcreteEventType::CTM_STATE_END_EVENT:
+			OnEnd(Event::EndEvent::Cast(pEvent));
+			break;
+		default:
+			RUNTIME_ASSERT(false, "State event wasn't handled.\n");
+		}
+	}
+
+	void IRenderer::HandleMouseEvent(Event::IEvent* pEvent) noexcept
+	{
+		RUNTIME_ASSERT(pEvent->GenericType() == Event::GenericEventType::CTM_MOUSE_EVENT, "The provided event wasn't a CTM_MOUSE_EVENT.\n");
+
+		switch (pEvent->ConcreteType())
+		{
+		case Event::ConcreteEventType::CTM_MOUSE_MOVE_EVENT:
+			OnMouseMove(Event::MouseMoveEvent::Cast(pEvent));
+			break;
+		default:
+			RUNTIME_ASSERT(false, "Mouse event wasn't handled.\n");
+		}
+	}
+	#pragma endregion
+}
@@ -0,0 +1,261 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Core/CpuFeatures.hpp"
+#include "CTMRenderer/InstanceBuilder.hpp"
+#include "Threading/ParallelFor.hpp"
+
+#ifdef CTM_X86
+#include <immintrin.h>
+#endif
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		using CTMDirectX::Graphics::InstanceData;
+
+		// The vector builders move colors and instances around as packed 32 bit lanes.
+		static_assert(sizeof(CTMDirectX::Graphics::DXColor) == sizeof(float), "DXColor must be 4 bytes.");
+		static_assert(sizeof(InstanceData) == sizeof(float) * 5, "InstanceData must be 5 floats.");
+
+		// Rects per chunk when building across a pool. Large enough that claiming a chunk costs nothing next to building it.
+		constexpr size_t S_CHUNK_RECTS = 16384;
+
+		/* Ranges writing at least this many bytes of instances store them non-temporally, around the cache. Their instances
+		 * would be evicted before being read again anyway, and streaming skips reading every written line in first. */
+		constexpr size_t S_STREAM_BYTES = 256 * 1024;
+
+		/* The base quad's values the builders need, pulled out of the AABB once. Scales multiply by the reciprocal of the
+		 * quad's size rather than dividing by it, the division costing many times a multiply, every builder and BakeInstance
+		 * doing the same so they round alike. */
+		struct BaseQuad
+		{
+			float left, top, invWidth, invHeight;
+		};
+
+		using BuildFunction = void (*)(const RectBatch& rects, size_t first, size_t last, const BaseQuad& base, InstanceData* pInstances) noexcept;
+
+		#pragma region Scalar
+		void BuildScalar(const RectBatch& rects, size_t first, size_t last, const BaseQuad& base, InstanceData* pInstances) noexcept
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				pInstances[i].scalarXY = { (rects.pRight[i] - rects.pLeft[i]) * base.invWidth, (rects.pBottom[i] - rects.pTop[i]) * base.invHeight };
+				pInstances[i].offsetXY = { rects.pLeft[i] - base.left, rects.pTop[i] - base.top };
+				pInstances[i].color = rects.pColors[i];
+			}
+		}
+		#pragma endregion
+
+		#ifdef CTM_X86
+		#pragma region SSE2
+		CTM_TARGET("sse2") void BuildSSE2(const RectBatch& rects, size_t first, size_t last, const BaseQuad& base, InstanceData* pInstances) noexcept
+		{
+			const __m128 baseLeft = _mm_set1_ps(base.left), baseTop = _mm_set1_ps(base.top);
+			const __m128 invWidth = _mm_set1_ps(base.invWidth), invHeight = _mm_set1_ps(base.invHeight);
+
+			// Copied out, since the stores below could alias the batch as far as the compiler knows.
+			const float* pLeft = rects.pLeft, * pTop = rects.pTop, * pRight = rects.pRight, * pBottom = rects.pBottom;
+			const CTMDirectX::Graphics::DXColor* pColors = rects.pColors;
+
+			size_t i = first;
+
+			for (; i + 4 <= last; i += 4)
+			{
+				const __m128 left = _mm_loadu_ps(pLeft + i), top = _mm_loadu_ps(pTop + i);
+				const __m128 right = _mm_loadu_ps(pRight + i), bottom = _mm_loadu_ps(pBottom + i);
+
+				const __m128 scalarX = _mm_mul_ps(_mm_sub_ps(right, left), invWidth);
+				const __m128 scalarY = _mm_mul_ps(_mm_sub_ps(bottom, top), invHeight);
+				const __m128 offsetX = _mm_sub_ps(left, baseLeft);
+				const __m128 offsetY = _mm_sub_ps(top, baseTop);
+
+				// Transposes the 4 components of 4 rects, so each register holds one instance's scale and offset.
+				const __m128 scalar01 = _mm_unpacklo_ps(scalarX, scalarY), scalar23 = _mm_unpackhi_ps(scalarX, scalarY);
+				const __m128 offset01 = _mm_unpacklo_ps(offsetX, offsetY), offset23 = _mm_unpackhi_ps(offsetX, offsetY);
+
+				_mm_storeu_ps(&pInstances[i + 0].scalarXY.x, _mm_movelh_ps(scalar01, offset01));
+				_mm_storeu_ps(&pInstances[i + 1].scalarXY.x, _mm_movehl_ps(offset01, scalar01));
+				_mm_storeu_ps(&pInstances[i + 2].scalarXY.x, _mm_movelh_ps(scalar23, offset23));
+				_mm_storeu_ps(&pInstances[i + 3].scalarXY.x, _mm_movehl_ps(offset23, scalar23));
+
+				for (size_t j = 0; j < 4; ++j)
+					pInstances[i + j].color = pColors[i + j];
+			}
+
+			BuildScalar(rects, i, last, base, pInstances);
+		}
+		#pragma endregion
+
+		#pragma region AVX2
+		// Lane n of the result is lane in of source.
+		CTM_TARGET("avx2") inline __m256 Permute(__m256 source, int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7) noexcept
+		{
+			return _mm256_permutevar8x32_ps(source, _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7));
+		}
+
+		CTM_TARGET("avx2") void BuildAVX2(const RectBatch& rects, size_t first, size_t last, const BaseQuad& base, InstanceData* pInstances) noexcept
+		{
+			const __m256 baseLeft = _mm256_set1_ps(base.left), baseTop = _mm256_set1_ps(base.top);
+			const __m256 invWidth = _mm256_set1_ps(base.invWidth), invHeight = _mm256_set1_ps(base.invHeight);
+
+			const float* pLeft = rects.pLeft, * pTop = rects.pTop, * pRight = rects.pRight, * pBottom = rects.pBottom;
+			const CTMDirectX::Graphics::DXColor* pColors = rects.pColors;
+
+			size_t i = first;
+
+			// Streaming stores must be 32 byte aligned. 8 instances are 160 bytes, so once one group is aligned, all are.
+			const bool isStreaming = (last - first) * sizeof(InstanceData) >= S_STREAM_BYTES;
+
+			if (isStreaming)
+			{
+				size_t alignedFirst = first;
+				while (alignedFirst < last && ((uintptr_t)&pInstances[alignedFirst] & 31) != 0)
+					++alignedFirst;
+
+				BuildScalar(rects, first, alignedFirst, base, pInstances);
+				i = alignedFirst;
+			}
+
+			for (; i + 8 <= last; i += 8)
+			{
+				const __m256 left = _mm256_loadu_ps(pLeft + i), top = _mm256_loadu_ps(pTop + i);
+				const __m256 right = _mm256_loadu_ps(pRight + i), bottom = _mm256_loadu_ps(pBottom + i);
+
+				const __m256 scalarX = _mm256_mul_ps(_mm256_sub_ps(right, left), invWidth);
+				const __m256 scalarY = _mm256_mul_ps(_mm256_sub_ps(bottom, top), invHeight);
+				const __m256 offsetX = _mm256_sub_ps(left, baseLeft);
+				const __m256 offsetY = _mm256_sub_ps(top, baseTop);
+
+				const __m256 colors = _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i*)(pColors + i)));
+
+				// Transposes within each 128 bit lane, so instancesNM holds rect N's scale and offset in its low lane and rect M's in its high lane.
+				const __m256 scalar01 = _mm256_unpacklo_ps(scalarX, scalarY), scalar23 = _mm256_unpackhi_ps(scalarX, scalarY);
+				const __m256 offset01 = _mm256_unpacklo_ps(offsetX, offsetY), offset23 = _mm256_unpackhi_ps(offsetX, offsetY);
+
+				const __m256 instances04 = _mm256_shuffle_ps(scalar01, offset01, _MM_SHUFFLE(1, 0, 1, 0));
+				const __m256 instances15 = _mm256_shuffle_ps(scalar01, offset01, _MM_SHUFFLE(3, 2, 3, 2));
+				const __m256 instances26 = _mm256_shuffle_ps(scalar23, offset23, _MM_SHUFFLE(1, 0, 1, 0));
+				const __m256 instances37 = _mm256_shuffle_ps(scalar23, offset23, _MM_SHUFFLE(3, 2, 3, 2));
+
+				/* The 8 instances are 40 floats, written as 5 full registers instead of a store per instance and color.
+				 * Each register gathers its floats from at most 3 sources. (x, y, z, w for scale X / Y and offset X / Y, c for color)
+				 *   0 : 0x 0y 0z 0w 0c 1x 1y 1z    1 : 1w 1c 2x 2y 2z 2w 2c 3x    2 : 3y 3z 3w 3c 4x 4y 4z 4w
+				 *   3 : 4c 5x 5y 5z 5w 5c 6x 6y    4 : 6z 6w 6c 7x 7y 7z 7w 7c */
+				__m256 packed0 = _mm256_blend_ps(instances04, Permute(instances15, 0, 0, 0, 0, 0, 0, 1, 2), 0xE0);
+				packed0 = _mm256_blend_ps(packed0, Permute(colors, 0, 0, 0, 0, 0, 0, 0, 0), 0x10);
+
+				__m256 packed1 = _mm256_blend_ps(Permute(instances15, 3, 0, 0, 0, 0, 0, 0, 0), Permute(instances26, 0, 0, 0, 1, 2, 3, 0, 0), 0x3C);
+				packed1 = _mm256_blend_ps(packed1, Permute(instances37, 0, 0, 0, 0, 0, 0, 0, 0), 0x80);
+				packed1 = _mm256_blend_ps(packed1, Permute(colors, 0, 1, 0, 0, 0, 0, 2, 0), 0x42);
+
+				__m256 packed2 = _mm256_blend_ps(Permute(instances37, 1, 2, 3, 0, 0, 0, 0, 0), instances04, 0xF0);
+				packed2 = _mm256_blend_ps(packed2, Permute(colors, 0, 0, 0, 3, 0, 0, 0, 0), 0x08);
+
+				__m256 packed3 = _mm256_blend_ps(Permute(instances15, 0, 4, 5, 6, 7, 0, 0, 0), Permute(instances26, 0, 0, 0, 0, 0, 0, 4, 5), 0xC0);
+				packed3 = _mm256_blend_ps(packed3, Permute(colors, 4, 0, 0, 0, 0, 5, 0, 0), 0x21);
+
+				__m256 packed4 = _mm256_blend_ps(Permute(instances26, 6, 7, 0, 0, 0, 0, 0, 0), Permute(instances37, 0, 0, 0, 4, 5, 6, 7, 0), 0x78);
+				packed4 = _mm256_blend_ps(packed4, Permute(colors, 0, 0, 6, 0, 0, 0, 0, 7), 0x84);
+
+				float* pDst = &pInstances[i].scalarXY.x;
+
+				if (isStreaming)
+				{
+					_mm256_stream_ps(pDst + 0, packed0);
+					_mm256_stream_ps(pDst + 8, packed1);
+					_mm256_stream_ps(pDst + 16, packed2);
+					_mm256_stream_ps(pDst + 24, packed3);
+					_mm256_stream_ps(pDst + 32, packed4);
+				}
+				else
+				{
+					_mm256_storeu_ps(pDst + 0, packed0);
+					_mm256_storeu_ps(pDst + 8, packed1);
+					_mm256_storeu_ps(pDst + 16, packed2);
+					_mm256_storeu_ps(pDst + 24, packed3);
+					_mm256_storeu_ps(pDst + 32, packed4);
+				}
+			}
+
+			// Orders the streamed stores before whatever the caller does next, e.g. handing the instances to another thread.
+			if (isStreaming)
+				_mm_sfence();
+
+			BuildScalar(rects, i, last, base, pInstances);
+		}
+		#pragma endregion
+		#endif
+
+		struct Builder
+		{
+			BuildFunction Build;
+			const char* name;
+		};
+
+		Builder SelectBuilder() noexcept
+		{
+			#ifdef CTM_X86
+			const Core::CpuFeatures& features = Core::DetectCpuFeatures();
+
+			if (features.avx2)
+				return { BuildAVX2, "AVX2" };
+			if (features.sse2)
+				return { BuildSSE2, "SSE2" };
+			#endif
+
+			return { BuildScalar, "Scalar" };
+		}
+
+		const Builder& ActiveBuilder() noexcept
+		{
+			static const Builder s_Builder = SelectBuilder();
+			return s_Builder;
+		}
+
+		BaseQuad ToBaseQuad(const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad) noexcept
+		{
+			return { baseQuad.left, baseQuad.top, 1.0f / baseQuad.width, 1.0f / baseQuad.height };
+		}
+
+		void AssertBatch([[maybe_unused]] const RectBatch& rects, [[maybe_unused]] const InstanceData* pInstances) noexcept
+		{
+			RUNTIME_ASSERT(rects.count == 0 || (rects.pLeft != nullptr && rects.pTop != nullptr && rects.pRight != nullptr && rects.pBottom != nullptr && rects.pColors != nullptr), "Rect batch arrays are nullptr.\n");
+			RUNTIME_ASSERT(rects.count == 0 || pInstances != nullptr, "Instances are nullptr.\n");
+		}
+	}
+
+	#pragma region Public API
+	void BuildInstances(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, InstanceData* pInstances) noexcept
+	{
+		AssertBatch(rects, pInstances);
+
+		ActiveBuilder().Build(rects, 0, rects.count, ToBaseQuad(baseQuad), pInstances);
+	}
+
+	void BuildInstances(Threading::WorkerPool& pool, const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, InstanceData* pInstances) noexcept
+	{
+		AssertBatch(rects, pInstances);
+
+		const BaseQuad base = ToBaseQuad(baseQuad);
+		const BuildFunction build = ActiveBuilder().Build;
+
+		Threading::ParallelFor(pool, (rects.count + S_CHUNK_RECTS - 1) / S_CHUNK_RECTS, [&](size_t chunk) {
+			const size_t first = chunk * S_CHUNK_RECTS;
+			build(rects, first, std::min(first + S_CHUNK_RECTS, rects.count), base, pInstances);
+		});
+	}
+
+	void BuildInstancesReference(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, InstanceData* pInstances) noexcept
+	{
+		AssertBatch(rects, pInstances);
+
+		BuildScalar(rects, 0, rects.count, ToBaseQuad(baseQuad), pInstances);
+	}
+
+	const char* InstanceBuilderISA() noexcept
+	{
+		return ActiveBuilder().name;
+	}
+	#pragma endregion
+}
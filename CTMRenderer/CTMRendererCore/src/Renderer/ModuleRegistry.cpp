@@ -0,0 +1,54 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/ModuleRegistry.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+namespace CTMRenderer
+{
+	ModuleID ModuleRegistry::Register(std::string_view name, std::function<void()> initFunc, std::initializer_list<ModuleID> dependencies) noexcept
+	{
+		RUNTIME_ASSERT(initFunc != nullptr, "Module init function is empty.\n");
+
+		const ModuleID id = m_Modules.size();
+
+		RUNTIME_ASSERT(
+			std::all_of(dependencies.begin(), dependencies.end(), [id](ModuleID dependency) { return dependency < id; }),
+			"Modules can only depend on previously registered modules.\n"
+		);
+
+		m_Modules.emplace_back(Module{ std::move(initFunc), std::vector<ModuleID>(dependencies) });
+		m_Records.emplace_back().name = name;
+
+		return id;
+	}
+
+	void ModuleRegistry::PrintReport(std::ostream& stream) const noexcept
+	{
+		stream << "Modules :\n";
+
+		for (const ModuleRecord& record : m_Records)
+		{
+			stream << "  " << record.name << " : ";
+
+			if (record.isInitialized)
+				stream << record.initMillis << "ms\n";
+			else
+				stream << "not initialized\n";
+		}
+	}
+
+	void ModuleRegistry::Initialize(ModuleID id) noexcept
+	{
+		for (ModuleID dependency : m_Modules[id].dependencies)
+			Require(dependency);
+
+		Timer::Timer initTimer;
+		m_Modules[id].initFunc();
+
+		ModuleRecord& record = m_Records[id];
+		record.initMillis = initTimer.ElapsedMillis();
+		record.isInitialized = true;
+
+		DEBUG_PRINT("Initialized module " << record.name << " in " << record.initMillis << "ms.\n");
+	}
+}
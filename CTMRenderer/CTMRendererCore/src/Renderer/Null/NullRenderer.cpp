@@ -0,0 +1,106 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Null/NullRenderer.hpp"
+
+namespace CTMRenderer::CTMNull
+{
+	NullRenderer::NullRenderer(const NullRendererSettings& settings)
+		: IRenderer(settings.Threads), m_Settings(settings), m_ScreenArea(settings.Width, settings.Height),
+		  m_ClearColor(0, 0, .1f, 1.0f), m_Frame(m_ScreenArea, FramePasses())
+	{
+	}
+
+	NullRenderer::NullRenderer(const NullRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool)
+		: IRenderer(sharedWorkerPool), m_Settings(settings), m_ScreenArea(settings.Width, settings.Height),
+		  m_ClearColor(0, 0, .1f, 1.0f), m_Frame(m_ScreenArea, FramePasses())
+	{
+	}
+
+	#pragma region Public API
+	void NullRenderer::Step(double) noexcept
+	{
+		if (m_RendererStarted.load(std::memory_order_acquire) && IsRunning())
+		{
+			DoFrame();
+
+			// Without a window to close, a frame budget is what ends a headless run.
+			if (m_Settings.MaxFrames != 0 && ++m_FrameCount == m_Settings.MaxFrames)
+				m_EventSystem.Dispatcher().QueueEvent<Event::EndEvent>(1738u);
+		}
+
+		DispatchQueuedEvents();
+	}
+	#pragma endregion
+
+	#pragma region Protected Functions
+	void NullRenderer::OnStart([[maybe_unused]] const Event::StartEvent* pStartEvent) noexcept
+	{
+		RUNTIME_ASSERT(pStartEvent != nullptr, "Start event is nullptr. How TF did this happen?\n");
+		RUNTIME_ASSERT(m_RendererStarted.load(std::memory_order_acquire) == false, "Renderer has already started.\n");
+
+		DEBUG_PRINT("Start args : " << pStartEvent->PlaceholderArgs() << '\n');
+
+		// The rects are baked into S_TEST_SCENE, so building the shape batch is all DXGraphics::AddInitTasks does without a device.
+		Threading::TaskGraph startupGraph;
+		startupGraph.Add("BuildBatches", [this] { m_Frame.BuildBatches(); });
+
+		startupGraph.Run(m_WorkerPool);
+		m_StartupTimeline = startupGraph.Timeline();
+
+		IF_DEBUG(startupGraph.PrintTimeline(std::cout));
+
+		m_RendererStarted.store(true, std::memory_order_release);
+
+		DEBUG_PRINT("Renderer started.\n");
+	}
+
+	void NullRenderer::OnEnd(const Event::EndEvent* pEndEvent) noexcept
+	{
+		IF_DEBUG(m_Frame.Graph().PrintReport(std::cout));
+
+		IRenderer::OnEnd(pEndEvent);
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void NullRenderer::DoFrame() noexcept
+	{
+		// Buffers are presented in turn, so once each was drawn, the back buffer holds the frame from BUFFER_COUNT frames ago.
+		m_Frame.Begin(m_PresentedFrames < BUFFER_COUNT ? 0 : BUFFER_COUNT);
+		m_Frame.Execute(m_WorkerPool);
+
+		m_Sink.Present();
+		++m_PresentedFrames;
+	}
+
+	SceneFramePasses NullRenderer::FramePasses() noexcept
+	{
+		SceneFramePasses passes;
+
+		passes.Clear = [this] {
+			if (!m_Frame.DamageRects().empty())
+				m_Sink.Clear(m_ClearColor, m_Frame.DamageRects().size());
+		};
+
+		passes.Rects = [this] {
+			DrawDamaged([this] { m_Sink.DrawIndexedInstanced(6, S_TEST_SCENE.instances.data(), S_TEST_SCENE.instances.size()); });
+		};
+
+		passes.Shapes = [this] {
+			DrawDamaged([this] { m_Sink.DrawIndexedInstanced(6, m_Frame.ShapeInstances().data(), m_Frame.ShapeInstances().size()); });
+		};
+
+		if (!m_Settings.TestText.empty())
+			passes.Text = [this] { DrawDamaged([this] { m_Sink.DrawString(m_Settings.TestText.size()); }); };
+
+		return passes;
+	}
+
+	template <typename DrawFunction>
+	void NullRenderer::DrawDamaged(DrawFunction&& draw) noexcept
+	{
+		for (size_t i = 0; i < m_Frame.DamageRects().size(); ++i)
+			draw();
+	}
+	#pragma endregion
+}
@@ -0,0 +1,384 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/RectLod.hpp"
+
+#include <bit> // std::countr_zero
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		using CTMDirectX::Graphics::DXColor;
+		using CTMDirectX::Graphics::InstanceData;
+
+		struct CellGrid
+		{
+			unsigned int width = 0, height = 0, cellSize = 1;
+			unsigned int cellsX = 0, cellsY = 0;
+		};
+
+		CellGrid MakeCellGrid(unsigned int width, unsigned int height, unsigned int cellSize) noexcept
+		{
+			RUNTIME_ASSERT(width > 0 && height > 0, "Target cannot be empty.\n");
+			RUNTIME_ASSERT(cellSize > 0, "Cell size must be greater than 0.\n");
+
+			return { width, height, cellSize, (width + cellSize - 1) / cellSize, (height + cellSize - 1) / cellSize };
+		}
+
+		[[nodiscard]] bool IsSmall(float width, float height, float minRectSize) noexcept
+		{
+			return width < minRectSize && height < minRectSize;
+		}
+
+		// Finds the cell holding the rect's center, returning false when the center is outside the target.
+		[[nodiscard]] bool CellOf(const CellGrid& grid, float left, float top, float right, float bottom, unsigned int& x, unsigned int& y) noexcept
+		{
+			const float centerX = (left + right) * 0.5f, centerY = (top + bottom) * 0.5f;
+
+			if (!(centerX >= 0.0f && centerX < (float)grid.width && centerY >= 0.0f && centerY < (float)grid.height))
+				return false;
+
+			// Power of two cell sizes, the usual ones, shift instead of dividing, as this runs for every small rect.
+			if ((grid.cellSize & (grid.cellSize - 1)) == 0)
+			{
+				const int shift = std::countr_zero(grid.cellSize);
+
+				x = (unsigned int)centerX >> shift;
+				y = (unsigned int)centerY >> shift;
+			}
+			else
+			{
+				x = (unsigned int)centerX / grid.cellSize;
+				y = (unsigned int)centerY / grid.cellSize;
+			}
+
+			return true;
+		}
+
+		template <typename CellSumTy>
+		void Accumulate(CellSumTy& sum, float area, const DXColor& color) noexcept
+		{
+			sum.area += area;
+			sum.red += area * color.rgba[DXColor::RED_CHANNEL];
+			sum.green += area * color.rgba[DXColor::GREEN_CHANNEL];
+			sum.blue += area * color.rgba[DXColor::BLUE_CHANNEL];
+			sum.alpha += area * color.rgba[DXColor::ALPHA_CHANNEL];
+		}
+
+		// Rounds a non-negative channel value to nearest.
+		[[nodiscard]] unsigned char ToChannel(float value) noexcept
+		{
+			return (unsigned char)std::min(value + 0.5f, 255.0f);
+		}
+
+		// Appends a cell's rect, clipped to the target, and resolved color to the columns.
+		template <typename CellSumTy>
+		void AppendCell(const CellGrid& grid, unsigned int x, unsigned int y, const CellSumTy& sum, std::vector<float>& lefts, std::vector<float>& tops,
+			std::vector<float>& rights, std::vector<float>& bottoms, std::vector<DXColor>& colors) noexcept
+		{
+			const float left = (float)(x * grid.cellSize), top = (float)(y * grid.cellSize);
+			const float right = (float)std::min((x + 1) * grid.cellSize, grid.width), bottom = (float)std::min((y + 1) * grid.cellSize, grid.height);
+
+			const float inverseArea = 1.0f / sum.area;
+			const float coverage = std::min(sum.area / ((right - left) * (bottom - top)), 1.0f);
+
+			lefts.push_back(left);
+			tops.push_back(top);
+			rights.push_back(right);
+			bottoms.push_back(bottom);
+			colors.emplace_back(ToChannel(sum.red * inverseArea), ToChannel(sum.green * inverseArea), ToChannel(sum.blue * inverseArea),
+				ToChannel(sum.alpha * inverseArea * coverage));
+		}
+
+		[[nodiscard]] RectBatch ToBatch(const std::vector<float>& lefts, const std::vector<float>& tops, const std::vector<float>& rights,
+			const std::vector<float>& bottoms, const std::vector<DXColor>& colors) noexcept
+		{
+			RectBatch batch;
+			batch.pLeft = lefts.data();
+			batch.pTop = tops.data();
+			batch.pRight = rights.data();
+			batch.pBottom = bottoms.data();
+			batch.pColors = colors.data();
+			batch.count = colors.size();
+
+			return batch;
+		}
+
+		// Returns count rects of batch, starting at first.
+		[[nodiscard]] RectBatch SubBatch(const RectBatch& batch, size_t first, size_t count) noexcept
+		{
+			RectBatch subBatch;
+			subBatch.pLeft = batch.pLeft + first;
+			subBatch.pTop = batch.pTop + first;
+			subBatch.pRight = batch.pRight + first;
+			subBatch.pBottom = batch.pBottom + first;
+			subBatch.pColors = batch.pColors + first;
+			subBatch.count = count;
+
+			return subBatch;
+		}
+	}
+
+	RectLod::RectLod(const LodSettings& settings) noexcept
+		: m_Settings(settings)
+	{
+		RUNTIME_ASSERT(settings.CellSize > 0, "Cell size must be greater than 0.\n");
+	}
+
+	#pragma region Public API
+	void RectLod::Begin(unsigned int width, unsigned int height, size_t firstInstance) noexcept
+	{
+		const CellGrid grid = MakeCellGrid(width, height, m_Settings.CellSize);
+
+		// End resets the sums it reads, so this only finds any after a pass left without End.
+		for (unsigned int y = 0; y < (unsigned int)m_RowSpans.size(); ++y)
+		{
+			RowSpan& span = m_RowSpans[y];
+			if (span.firstX <= span.lastX)
+				std::fill(m_Sums.begin() + (size_t)y * m_CellsX + span.firstX, m_Sums.begin() + (size_t)y * m_CellsX + span.lastX + 1, CellSum());
+
+			span = {};
+		}
+
+		m_TouchedCells.clear();
+		m_Sums.resize((size_t)grid.cellsX * grid.cellsY);
+		m_RowSpans.resize(grid.cellsY);
+
+		m_Width = width;
+		m_Height = height;
+		m_CellsX = grid.cellsX;
+		m_CellsY = grid.cellsY;
+		m_FirstInstance = firstInstance;
+		m_InstanceCount = firstInstance;
+		m_Stats = {};
+	}
+
+	void RectLod::Add(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		// Zoomed in, batches usually have no small rect at all, and are built as they are.
+		size_t firstSmall = 0;
+		while (firstSmall < rects.count && !IsSmall(rects.pRight[firstSmall] - rects.pLeft[firstSmall], rects.pBottom[firstSmall] - rects.pTop[firstSmall], m_Settings.MinRectSize))
+			++firstSmall;
+
+		if (firstSmall == rects.count)
+		{
+			m_Stats.keptRects += rects.count;
+			BuildInstances(rects, baseQuad, Write(rects.count, instances));
+			return;
+		}
+
+		size_t smallCount = 0;
+		for (size_t i = firstSmall; i < rects.count; ++i)
+			smallCount += IsSmall(rects.pRight[i] - rects.pLeft[i], rects.pBottom[i] - rects.pTop[i], m_Settings.MinRectSize);
+
+		const size_t keptCount = rects.count - smallCount;
+		m_Stats.keptRects += keptCount;
+
+		// With few small rects, kept ones come in long runs, built in place rather than copied out into a batch of their own.
+		if (smallCount * S_RUN_RATIO < rects.count)
+		{
+			CTMDirectX::Graphics::InstanceData* pKept = Write(keptCount, instances);
+			size_t runStart = 0;
+
+			for (size_t i = firstSmall; i < rects.count; ++i)
+			{
+				const float left = rects.pLeft[i], top = rects.pTop[i], right = rects.pRight[i], bottom = rects.pBottom[i];
+
+				if (!IsSmall(right - left, bottom - top, m_Settings.MinRectSize))
+					continue;
+
+				if (i > runStart)
+				{
+					BuildInstances(SubBatch(rects, runStart, i - runStart), baseQuad, pKept);
+					pKept += i - runStart;
+				}
+
+				runStart = i + 1;
+				Aggregate(left, top, right, bottom, rects.pColors[i]);
+			}
+
+			if (rects.count > runStart)
+				BuildInstances(SubBatch(rects, runStart, rects.count - runStart), baseQuad, pKept);
+
+			return;
+		}
+
+		m_Lefts.clear();
+		m_Tops.clear();
+		m_Rights.clear();
+		m_Bottoms.clear();
+		m_Colors.clear();
+
+		for (size_t i = 0; i < rects.count; ++i)
+		{
+			const float left = rects.pLeft[i], top = rects.pTop[i], right = rects.pRight[i], bottom = rects.pBottom[i];
+
+			if (!IsSmall(right - left, bottom - top, m_Settings.MinRectSize))
+			{
+				m_Lefts.push_back(left);
+				m_Tops.push_back(top);
+				m_Rights.push_back(right);
+				m_Bottoms.push_back(bottom);
+				m_Colors.push_back(rects.pColors[i]);
+				continue;
+			}
+
+			Aggregate(left, top, right, bottom, rects.pColors[i]);
+		}
+
+		if (keptCount > 0)
+			BuildInstances(ToBatch(m_Lefts, m_Tops, m_Rights, m_Bottoms, m_Colors), baseQuad, Write(keptCount, instances));
+	}
+
+	void RectLod::End(const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		const CellGrid grid = { m_Width, m_Height, m_Settings.CellSize, m_CellsX, m_CellsY };
+
+		m_Lefts.clear();
+		m_Tops.clear();
+		m_Rights.clear();
+		m_Bottoms.clear();
+		m_Colors.clear();
+
+		size_t spannedCells = 0;
+		for (const RowSpan& span : m_RowSpans)
+			spannedCells += span.firstX <= span.lastX ? span.lastX - span.firstX + 1 : 0;
+
+		// Sparse cells, like a few small rects spread over the target, are sorted into row major order, dense ones are
+		// found walking every row's span.
+		if (m_TouchedCells.size() * S_SORT_CELLS_RATIO < spannedCells)
+		{
+			std::sort(m_TouchedCells.begin(), m_TouchedCells.end());
+			m_TouchedCells.erase(std::unique(m_TouchedCells.begin(), m_TouchedCells.end()), m_TouchedCells.end());
+
+			for (uint32_t cell : m_TouchedCells)
+			{
+				if (m_Sums[cell].area > 0.0f)
+					AppendCell(grid, cell % m_CellsX, cell / m_CellsX, m_Sums[cell], m_Lefts, m_Tops, m_Rights, m_Bottoms, m_Colors);
+
+				m_Sums[cell] = {};
+			}
+
+			std::fill(m_RowSpans.begin(), m_RowSpans.end(), RowSpan());
+		}
+		else
+		{
+			for (unsigned int y = 0; y < m_CellsY; ++y)
+			{
+				RowSpan& span = m_RowSpans[y];
+				if (span.firstX > span.lastX)
+					continue;
+
+				CellSum* pRow = m_Sums.data() + (size_t)y * m_CellsX;
+
+				for (unsigned int x = span.firstX; x <= span.lastX; ++x)
+				{
+					if (pRow[x].area > 0.0f)
+						AppendCell(grid, x, y, pRow[x], m_Lefts, m_Tops, m_Rights, m_Bottoms, m_Colors);
+
+					pRow[x] = {};
+				}
+
+				span = {};
+			}
+		}
+
+		m_TouchedCells.clear();
+
+		// Builds the cells straight into place, beneath the instances the pass wrote, and trims anything past them.
+		const size_t cellCount = m_Colors.size();
+		const size_t keptCount = m_InstanceCount - m_FirstInstance;
+
+		instances.resize(m_InstanceCount + cellCount);
+		std::memmove(instances.data() + m_FirstInstance + cellCount, instances.data() + m_FirstInstance, keptCount * sizeof(InstanceData));
+
+		if (cellCount > 0)
+			BuildInstances(ToBatch(m_Lefts, m_Tops, m_Rights, m_Bottoms, m_Colors), baseQuad, instances.data() + m_FirstInstance);
+
+		m_Stats.cells = cellCount;
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	CTMDirectX::Graphics::InstanceData* RectLod::Write(size_t count, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		const size_t first = m_InstanceCount;
+		m_InstanceCount += count;
+
+		if (instances.size() < m_InstanceCount)
+			instances.resize(m_InstanceCount);
+
+		return instances.data() + first;
+	}
+
+	void RectLod::Aggregate(float left, float top, float right, float bottom, const CTMDirectX::Graphics::DXColor& color) noexcept
+	{
+		const CellGrid grid = { m_Width, m_Height, m_Settings.CellSize, m_CellsX, m_CellsY };
+
+		unsigned int x = 0, y = 0;
+		if (!CellOf(grid, left, top, right, bottom, x, y))
+		{
+			++m_Stats.droppedRects;
+			return;
+		}
+
+		CellSum& sum = m_Sums[(size_t)y * m_CellsX + x];
+		if (sum.area == 0.0f)
+			m_TouchedCells.push_back(y * m_CellsX + x);
+
+		Accumulate(sum, (right - left) * (bottom - top), color);
+
+		RowSpan& span = m_RowSpans[y];
+		span.firstX = std::min(span.firstX, x);
+		span.lastX = std::max(span.lastX, x);
+
+		++m_Stats.aggregatedRects;
+	}
+	#pragma endregion
+
+	void AggregateReference(const RectBatch& rects, const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad, unsigned int width, unsigned int height,
+		const LodSettings& settings, std::vector<CTMDirectX::Graphics::InstanceData>& instances) noexcept
+	{
+		struct Sum
+		{
+			float area = 0;
+			float red = 0, green = 0, blue = 0, alpha = 0;
+		};
+
+		const CellGrid grid = MakeCellGrid(width, height, settings.CellSize);
+
+		std::vector<Sum> sums((size_t)grid.cellsX * grid.cellsY);
+		std::vector<float> lefts, tops, rights, bottoms;
+		std::vector<DXColor> colors;
+
+		for (size_t i = 0; i < rects.count; ++i)
+		{
+			const float left = rects.pLeft[i], top = rects.pTop[i], right = rects.pRight[i], bottom = rects.pBottom[i];
+			unsigned int x = 0, y = 0;
+
+			if (IsSmall(right - left, bottom - top, settings.MinRectSize) && CellOf(grid, left, top, right, bottom, x, y))
+				Accumulate(sums[(size_t)y * grid.cellsX + x], (right - left) * (bottom - top), rects.pColors[i]);
+		}
+
+		for (unsigned int y = 0; y < grid.cellsY; ++y)
+			for (unsigned int x = 0; x < grid.cellsX; ++x)
+				if (sums[(size_t)y * grid.cellsX + x].area > 0.0f)
+					AppendCell(grid, x, y, sums[(size_t)y * grid.cellsX + x], lefts, tops, rights, bottoms, colors);
+
+		for (size_t i = 0; i < rects.count; ++i)
+		{
+			if (!IsSmall(rects.pRight[i] - rects.pLeft[i], rects.pBottom[i] - rects.pTop[i], settings.MinRectSize))
+			{
+				lefts.push_back(rects.pLeft[i]);
+				tops.push_back(rects.pTop[i]);
+				rights.push_back(rects.pRight[i]);
+				bottoms.push_back(rects.pBottom[i]);
+				colors.push_back(rects.pColors[i]);
+			}
+		}
+
+		instances.resize(colors.size());
+		if (!colors.empty())
+			BuildInstancesReference(ToBatch(lefts, tops, rights, bottoms, colors), baseQuad, instances.data());
+	}
+}
@@ -0,0 +1,154 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/RectMerger.hpp"
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		using CTMDirectX::Graphics::DXColor;
+
+		// The color's channels as one value, so colors compare in one instruction.
+		[[nodiscard]] inline uint32_t ColorKey(const DXColor& color) noexcept
+		{
+			uint32_t key;
+			std::memcpy(&key, color.rgba, sizeof(key));
+			return key;
+		}
+
+		// Sorts the edges of both sides, removing duplicates.
+		void CollectEdges(const float* pLow, const float* pHigh, size_t count, std::vector<float>& edges) noexcept
+		{
+			edges.resize(count * 2);
+			std::memcpy(edges.data(), pLow, count * sizeof(float));
+			std::memcpy(edges.data() + count, pHigh, count * sizeof(float));
+
+			std::sort(edges.begin(), edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+		}
+
+		// Index of an edge, which must be one of the sorted edges.
+		[[nodiscard]] inline size_t EdgeIndex(const std::vector<float>& edges, float edge) noexcept
+		{
+			return (size_t)(std::lower_bound(edges.begin(), edges.end(), edge) - edges.begin());
+		}
+	}
+
+	RectMerger::RectMerger(const MergeSettings& settings) noexcept
+		: m_Settings(settings)
+	{
+	}
+
+	#pragma region Public API
+	RectBatch RectMerger::Merge(const RectBatch& rects) noexcept
+	{
+		RUNTIME_ASSERT(rects.count < S_NO_RECT, "Too many rects to merge.\n");
+
+		m_Lefts.clear();
+		m_Tops.clear();
+		m_Rights.clear();
+		m_Bottoms.clear();
+		m_Colors.clear();
+
+		m_Stats = {};
+		m_Stats.inputRects = rects.count;
+
+		if (rects.count == 0)
+		{
+			m_Stats.isMerged = true;
+			return Batch();
+		}
+
+		CollectEdges(rects.pLeft, rects.pRight, rects.count, m_EdgesX);
+		CollectEdges(rects.pTop, rects.pBottom, rects.count, m_EdgesY);
+
+		const size_t columns = m_EdgesX.size() - 1, rows = m_EdgesY.size() - 1;
+		m_Stats.cells = columns * rows;
+
+		if (rows != 0 && columns > m_Settings.MaxCells / rows)
+		{
+			m_Stats.outputRects = rects.count;
+			return rects;
+		}
+
+		// Paints every rect's index over the cells it covers, in draw order, leaving each cell the last rect drawn over it.
+		m_CellRects.assign(m_Stats.cells, S_NO_RECT);
+
+		for (size_t i = 0; i < rects.count; ++i)
+		{
+			RUNTIME_ASSERT(rects.pLeft[i] < rects.pRight[i] && rects.pTop[i] < rects.pBottom[i], "Rect cannot be empty.\n");
+
+			const size_t firstX = EdgeIndex(m_EdgesX, rects.pLeft[i]), endX = EdgeIndex(m_EdgesX, rects.pRight[i]);
+			const size_t firstY = EdgeIndex(m_EdgesY, rects.pTop[i]), endY = EdgeIndex(m_EdgesY, rects.pBottom[i]);
+
+			for (size_t y = firstY; y < endY; ++y)
+				std::fill(m_CellRects.begin() + (y * columns + firstX), m_CellRects.begin() + (y * columns + endX), (uint32_t)i);
+		}
+
+		// Whether a cell is left, and drawn with the color.
+		auto isColor = [&](size_t cell, uint32_t colorKey) {
+			return m_CellRects[cell] != S_NO_RECT && ColorKey(rects.pColors[m_CellRects[cell]]) == colorKey;
+		};
+
+		// Whether every cell of a row from firstX to endX is left, and drawn with the color.
+		auto isRunColor = [&](size_t y, size_t firstX, size_t endX, uint32_t colorKey) {
+			for (size_t x = firstX; x < endX; ++x)
+			{
+				if (!isColor(y * columns + x, colorKey))
+					return false;
+			}
+
+			return true;
+		};
+
+		for (size_t y = 0; y < rows; ++y)
+		{
+			for (size_t x = 0; x < columns; ++x)
+			{
+				const uint32_t rect = m_CellRects[y * columns + x];
+				if (rect == S_NO_RECT)
+					continue;
+
+				const uint32_t colorKey = ColorKey(rects.pColors[rect]);
+
+				size_t endX = x + 1;
+				while (endX < columns && isColor(y * columns + endX, colorKey))
+					++endX;
+
+				size_t endY = y + 1;
+				while (endY < rows && isRunColor(endY, x, endX, colorKey))
+					++endY;
+
+				for (size_t mergedY = y; mergedY < endY; ++mergedY)
+					std::fill(m_CellRects.begin() + (mergedY * columns + x), m_CellRects.begin() + (mergedY * columns + endX), S_NO_RECT);
+
+				m_Lefts.push_back(m_EdgesX[x]);
+				m_Tops.push_back(m_EdgesY[y]);
+				m_Rights.push_back(m_EdgesX[endX]);
+				m_Bottoms.push_back(m_EdgesY[endY]);
+				m_Colors.push_back(rects.pColors[rect]);
+			}
+		}
+
+		m_Stats.outputRects = m_Colors.size();
+		m_Stats.isMerged = true;
+
+		return Batch();
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	RectBatch RectMerger::Batch() const noexcept
+	{
+		RectBatch batch;
+		batch.pLeft = m_Lefts.data();
+		batch.pTop = m_Tops.data();
+		batch.pRight = m_Rights.data();
+		batch.pBottom = m_Bottoms.data();
+		batch.pColors = m_Colors.data();
+		batch.count = m_Colors.size();
+
+		return batch;
+	}
+	#pragma endregion
+}
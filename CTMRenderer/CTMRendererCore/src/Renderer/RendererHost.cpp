@@ -0,0 +1,176 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/RendererHost.hpp"
+#include "CTMRenderer/Null/NullRenderer.hpp"
+#include "CTMRenderer/Software/SWRenderer.hpp"
+
+#ifndef CTM_NO_DX
+#include "CTMRenderer/DirectX/DXRenderer.hpp"
+#endif
+
+namespace CTMRenderer
+{
+	RendererHost::RendererHost(const Threading::ThreadTopology& threadTopology) noexcept
+		: m_ThreadTopology(threadTopology), m_WorkerPool(threadTopology)
+	{
+	}
+
+	RendererHost::~RendererHost() noexcept
+	{
+		JoinForShutdown();
+	}
+
+	#pragma region Public API
+	IRenderer& RendererHost::Add(RendererType rendererType, unsigned int targetFPS) noexcept
+	{
+		std::unique_ptr<IRenderer> pRenderer;
+
+		if (rendererType == RendererType::CTM_DIRECTX)
+		{
+			#ifdef CTM_NO_DX
+				RUNTIME_ASSERT(false, "RendererHost cannot create a DirectX renderer, as it was explicitly defined to not include it via the macro CTM_NO_DX.\n");
+			#else
+				CTMDirectX::DXRendererSettings settings(targetFPS, m_ThreadTopology);
+				pRenderer = std::make_unique<CTMDirectX::DXRenderer>(settings, m_WorkerPool, m_DXSharedResources);
+			#endif
+		}
+		else if (rendererType == RendererType::CTM_NULL)
+		{
+			CTMNull::NullRendererSettings settings(targetFPS, m_ThreadTopology);
+			pRenderer = std::make_unique<CTMNull::NullRenderer>(settings, m_WorkerPool);
+		}
+		else if (rendererType == RendererType::CTM_SOFTWARE)
+		{
+			CTMSoftware::SWRendererSettings settings(targetFPS, m_ThreadTopology);
+			pRenderer = std::make_unique<CTMSoftware::SWRenderer>(settings, m_WorkerPool);
+		}
+		else
+			RUNTIME_ASSERT(false, "Failed to add a renderer due to the provided renderType being unknown.\n");
+
+		return Add(std::move(pRenderer));
+	}
+
+	IRenderer& RendererHost::Add(std::unique_ptr<IRenderer> pRenderer) noexcept
+	{
+		RUNTIME_ASSERT(pRenderer != nullptr, "Added renderer is nullptr.\n");
+		RUNTIME_ASSERT(pRenderer->IsHosted(), "Renderers added to a host must use the host's worker pool.\n");
+
+		Instance instance;
+		instance.frameMillis = pRenderer->TargetFPS() != 0 ? 1000.0 / pRenderer->TargetFPS() : 0.0;
+		instance.pRenderer = std::move(pRenderer);
+
+		IRenderer& rendererRef = *instance.pRenderer;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_PendingInstances.emplace_back(std::move(instance));
+		}
+
+		m_CV.notify_one();
+		return rendererRef;
+	}
+
+	void RendererHost::Start() noexcept
+	{
+		RUNTIME_ASSERT(!m_IsStarted.load(std::memory_order_acquire), "The host has already started.\n");
+
+		m_IsStarted.store(true, std::memory_order_release);
+		m_HostThread = std::thread(&RendererHost::HostLoop, this);
+	}
+
+	void RendererHost::JoinForShutdown() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_IsStopRequested = true;
+		}
+
+		m_CV.notify_one();
+
+		if (m_HostThread.joinable())
+			m_HostThread.join();
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void RendererHost::HostLoop() noexcept
+	{
+		Threading::ApplyThreadPlacement(m_ThreadTopology.EventThread);
+
+		DEBUG_PRINT("Renderer host loop started.\n");
+
+		while (true)
+		{
+			AttachPending();
+
+			const double nowMillis = m_Timer.ElapsedMillis();
+			double nextDueMillis = nowMillis + 1000.0;
+			size_t runningCount = 0;
+
+			for (Instance& instance : m_Instances)
+			{
+				if (instance.isDetached)
+					continue;
+
+				if (!instance.pRenderer->IsRunning())
+				{
+					instance.pRenderer->Detach();
+					instance.isDetached = true;
+					continue;
+				}
+
+				++runningCount;
+
+				if (nowMillis >= instance.nextFrameMillis)
+				{
+					instance.pRenderer->Step(nowMillis);
+
+					// Skip frames the instance fell behind on, instead of stepping it in a burst to catch up.
+					instance.nextFrameMillis += instance.frameMillis;
+					if (instance.nextFrameMillis < nowMillis)
+						instance.nextFrameMillis = nowMillis + instance.frameMillis;
+				}
+
+				nextDueMillis = std::min(nextDueMillis, instance.nextFrameMillis);
+			}
+
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			if (runningCount == 0 && m_PendingInstances.empty())
+			{
+				if (m_IsStopRequested)
+					break;
+
+				// Nothing to step, so wait for an instance to be added or for the shutdown request.
+				m_CV.wait(lock, [this] { return !m_PendingInstances.empty() || m_IsStopRequested; });
+				continue;
+			}
+
+			// Sleep until the earliest due frame, or until a new instance was added.
+			const double sleepMillis = nextDueMillis - m_Timer.ElapsedMillis();
+			if (sleepMillis > 0.0)
+				m_CV.wait_for(lock, std::chrono::duration<double, std::milli>(sleepMillis), [this] { return !m_PendingInstances.empty(); });
+		}
+
+		DEBUG_PRINT("Renderer host loop end.\n");
+	}
+
+	void RendererHost::AttachPending() noexcept
+	{
+		std::vector<Instance> pendingInstances;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			pendingInstances.swap(m_PendingInstances);
+		}
+
+		for (Instance& instance : pendingInstances)
+		{
+			instance.pRenderer->Attach();
+			instance.nextFrameMillis = m_Timer.ElapsedMillis();
+
+			m_Instances.emplace_back(std::move(instance));
+		}
+	}
+	#pragma endregion
+}
@@ -0,0 +1,52 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/SceneFrame.hpp"
+#include "CTMRenderer/DirectX/Graphics/Geometry/DXShape.hpp"
+
+namespace CTMRenderer
+{
+	SceneFrame::SceneFrame(const CTMDirectX::Window::Geometry::WindowArea& targetAreaRef, SceneFramePasses passes) noexcept
+		: m_TargetAreaRef(targetAreaRef)
+	{
+		RUNTIME_ASSERT(passes.Clear != nullptr && passes.Rects != nullptr && passes.Shapes != nullptr, "Only the text pass may be left out.\n");
+
+		const FrameResourceID backBuffer = m_FrameGraph.Import("BackBuffer");
+
+		m_FrameGraph.AddPass("Clear", {}, { backBuffer }, std::move(passes.Clear), Threading::TaskAffinity::CALLER);
+		m_FrameGraph.AddPass("Rects", { backBuffer }, { backBuffer }, std::move(passes.Rects), Threading::TaskAffinity::CALLER);
+		m_FrameGraph.AddPass("Shapes", { backBuffer }, { backBuffer }, std::move(passes.Shapes), Threading::TaskAffinity::CALLER);
+
+		if (passes.Text != nullptr)
+			m_FrameGraph.AddPass("Text", { backBuffer }, { backBuffer }, std::move(passes.Text), Threading::TaskAffinity::CALLER);
+
+		m_FrameGraph.MarkOutput(backBuffer);
+		m_FrameGraph.Compile();
+	}
+
+	#pragma region Public API
+	void SceneFrame::BuildBatches() noexcept
+	{
+		using namespace CTMDirectX::Graphics;
+
+		m_Shapes = {
+			Geometry::DXCircle(850.0f, 220.0f, 90.0f, DXColor(DXColorType::BLUE), 4.0f, DXColor(DXColorType::WHITE)).Instance(),
+			Geometry::DXRoundedRect(150.0f, 400.0f, 400.0f, 560.0f, 24.0f, DXColor(40, 40, 40, 200), 3.0f, DXColor(DXColorType::WHITE)).Instance()
+		};
+	}
+
+	void SceneFrame::Begin(unsigned int bufferAge) noexcept
+	{
+		const DamageRegion& damage = m_Damage.Resolve(m_TargetAreaRef.width, m_TargetAreaRef.height, bufferAge);
+
+		if (damage.isFull)
+			m_DamageRects.assign(1, { 0, 0, (int)m_TargetAreaRef.width, (int)m_TargetAreaRef.height });
+		else
+			m_DamageRects.assign(damage.rects.begin(), damage.rects.end());
+	}
+
+	void SceneFrame::Execute(Threading::WorkerPool& pool) noexcept
+	{
+		m_FrameGraph.Execute(pool);
+	}
+	#pragma endregion
+}
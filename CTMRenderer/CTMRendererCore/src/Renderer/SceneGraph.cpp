@@ -0,0 +1,282 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/SceneGraph.hpp"
+
+namespace CTMRenderer
+{
+	SceneGraph::SceneGraph() noexcept
+	{
+		m_Nodes.emplace_back(); // Root.
+		Relayout();
+	}
+
+	#pragma region Public API
+	SceneNode SceneGraph::Add(SceneNode parent, const Affine2D& local) noexcept
+	{
+		RUNTIME_ASSERT(IsAlive(parent), "Parent node is not alive.\n");
+		RUNTIME_ASSERT(m_Size < S_NO_NODE, "Scene graph is full.\n");
+
+		uint32_t index = m_FirstFreeNode;
+
+		if (index != S_NO_NODE)
+		{
+			Node& node = m_Nodes[index];
+			m_FirstFreeNode = node.nextSibling;
+			node.nextSibling = S_NO_NODE;
+			++node.generation;
+		}
+		else
+		{
+			index = (uint32_t)m_Nodes.size();
+			m_Nodes.emplace_back();
+		}
+
+		m_Nodes[index].local = local;
+		Link(index, parent.index);
+
+		++m_Size;
+		m_IsLayoutDirty = true;
+
+		return { index, m_Nodes[index].generation };
+	}
+
+	bool SceneGraph::Remove(SceneNode node) noexcept
+	{
+		RUNTIME_ASSERT(node.index != 0, "The root cannot be removed.\n");
+
+		if (!IsAlive(node) || node.index == 0)
+			return false;
+
+		Unlink(node.index);
+
+		// Frees the subtree depth first, the next node to visit being read before the current one is freed.
+		uint32_t index = node.index;
+		bool isDone = false;
+
+		while (!isDone)
+		{
+			while (m_Nodes[index].firstChild != S_NO_NODE)
+				index = m_Nodes[index].firstChild;
+
+			// A leaf : frees it, then continues with its next sibling, or frees its parent once the siblings are gone.
+			const Node& leaf = m_Nodes[index];
+			uint32_t next = leaf.nextSibling;
+			const uint32_t parent = leaf.parent;
+			isDone = index == node.index;
+
+			if (!isDone && next == S_NO_NODE)
+			{
+				m_Nodes[parent].firstChild = m_Nodes[parent].lastChild = S_NO_NODE;
+				next = parent;
+			}
+
+			Node& freed = m_Nodes[index];
+			++freed.generation;
+			freed.firstChild = freed.lastChild = freed.previousSibling = S_NO_NODE;
+			freed.nextSibling = m_FirstFreeNode;
+			m_FirstFreeNode = index;
+			--m_Size;
+
+			index = next;
+		}
+
+		m_IsLayoutDirty = true;
+		return true;
+	}
+
+	bool SceneGraph::SetParent(SceneNode node, SceneNode parent) noexcept
+	{
+		if (!IsAlive(node) || !IsAlive(parent) || node.index == 0)
+			return false;
+
+		for (uint32_t ancestor = parent.index; ancestor != 0; ancestor = m_Nodes[ancestor].parent)
+			if (ancestor == node.index)
+				return false;
+
+		Unlink(node.index);
+		Link(node.index, parent.index);
+
+		m_IsLayoutDirty = true;
+		return true;
+	}
+
+	bool SceneGraph::SetLocal(SceneNode node, const Affine2D& local) noexcept
+	{
+		if (!IsAlive(node))
+			return false;
+
+		Node& target = m_Nodes[node.index];
+		target.local = local;
+
+		// A pending relayout recomputes everything anyway, and the node may not have a depth order yet.
+		if (m_IsLayoutDirty)
+			return true;
+
+		m_Locals[target.order] = local;
+
+		if (!m_IsDirty[target.order])
+		{
+			m_IsDirty[target.order] = 1;
+			m_DirtyOrders.push_back(target.order);
+		}
+
+		return true;
+	}
+
+	void SceneGraph::Update() noexcept
+	{
+		m_UpdatedRanges.clear();
+		m_Stats = {};
+
+		if (m_IsLayoutDirty)
+		{
+			Relayout();
+			m_DirtyOrders.clear();
+			m_IsLayoutDirty = false;
+
+			m_Stats.isRelayout = true;
+			m_Stats.updatedNodes = m_Size;
+			m_Stats.updatedRanges = 1;
+			return;
+		}
+
+		// In depth order, a dirty node inside a subtree already recomputed comes before that subtree's end.
+		std::sort(m_DirtyOrders.begin(), m_DirtyOrders.end());
+
+		uint32_t recomputedEnd = 0;
+
+		for (uint32_t order : m_DirtyOrders)
+		{
+			m_IsDirty[order] = 0;
+
+			if (order < recomputedEnd)
+				continue;
+
+			recomputedEnd = m_SubtreeEnds[order];
+			UpdateRange(order, recomputedEnd);
+
+			m_Stats.updatedNodes += (size_t)recomputedEnd - order;
+			++m_Stats.updatedRanges;
+		}
+
+		m_DirtyOrders.clear();
+	}
+
+	void SceneGraph::Reserve(size_t count) noexcept
+	{
+		m_Nodes.reserve(count);
+		m_OrderNodes.reserve(count);
+		m_OrderParents.reserve(count);
+		m_SubtreeEnds.reserve(count);
+		m_Locals.reserve(count);
+		m_Worlds.reserve(count);
+		m_IsDirty.reserve(count);
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void SceneGraph::Link(uint32_t index, uint32_t parent) noexcept
+	{
+		Node& node = m_Nodes[index];
+		Node& parentNode = m_Nodes[parent];
+
+		node.parent = parent;
+		node.previousSibling = parentNode.lastChild;
+		node.nextSibling = S_NO_NODE;
+
+		if (parentNode.lastChild != S_NO_NODE)
+			m_Nodes[parentNode.lastChild].nextSibling = index;
+		else
+			parentNode.firstChild = index;
+
+		parentNode.lastChild = index;
+	}
+
+	void SceneGraph::Unlink(uint32_t index) noexcept
+	{
+		Node& node = m_Nodes[index];
+		Node& parentNode = m_Nodes[node.parent];
+
+		if (node.previousSibling != S_NO_NODE)
+			m_Nodes[node.previousSibling].nextSibling = node.nextSibling;
+		else
+			parentNode.firstChild = node.nextSibling;
+
+		if (node.nextSibling != S_NO_NODE)
+			m_Nodes[node.nextSibling].previousSibling = node.previousSibling;
+		else
+			parentNode.lastChild = node.previousSibling;
+
+		node.previousSibling = node.nextSibling = S_NO_NODE;
+	}
+
+	void SceneGraph::Relayout() noexcept
+	{
+		m_OrderNodes.resize(m_Size);
+		m_OrderParents.resize(m_Size);
+		m_SubtreeEnds.resize(m_Size);
+		m_Locals.resize(m_Size);
+		m_Worlds.resize(m_Size);
+		m_IsDirty.assign(m_Size, 0);
+
+		// Walks the links depth first, without a stack : down through first children, then across to the next
+		// sibling, closing every subtree left on the way back up.
+		uint32_t order = 0, index = 0;
+		bool isDone = false;
+
+		while (!isDone)
+		{
+			Node& node = m_Nodes[index];
+			node.order = order;
+
+			m_OrderNodes[order] = index;
+			m_OrderParents[order] = m_Nodes[node.parent].order;
+			m_Locals[order] = node.local;
+			++order;
+
+			if (node.firstChild != S_NO_NODE)
+			{
+				index = node.firstChild;
+				continue;
+			}
+
+			while (true)
+			{
+				const Node& closed = m_Nodes[index];
+				m_SubtreeEnds[closed.order] = order;
+
+				if (index == 0)
+				{
+					isDone = true;
+					break;
+				}
+
+				if (closed.nextSibling != S_NO_NODE)
+				{
+					index = closed.nextSibling;
+					break;
+				}
+
+				index = closed.parent;
+			}
+		}
+
+		RUNTIME_ASSERT(order == m_Size, "Scene graph links do not reach every live node.\n");
+		UpdateRange(0, (uint32_t)m_Size);
+	}
+
+	void SceneGraph::UpdateRange(uint32_t first, uint32_t end) noexcept
+	{
+		uint32_t order = first;
+
+		if (order == 0)
+			m_Worlds[order++] = m_Locals[0];
+
+		// Parents come first in depth order, so their world transforms are already current.
+		for (; order < end; ++order)
+			m_Worlds[order] = Combine(m_Worlds[m_OrderParents[order]], m_Locals[order]);
+
+		m_UpdatedRanges.push_back({ first, end });
+	}
+	#pragma endregion
+}
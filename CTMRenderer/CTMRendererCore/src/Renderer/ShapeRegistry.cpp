@@ -0,0 +1,153 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/ShapeRegistry.hpp"
+
+namespace CTMRenderer
+{
+	#pragma region Public API
+	ShapeHandle ShapeRegistry::Add(float left, float top, float right, float bottom, const CTMDirectX::Graphics::DXColor& color) noexcept
+	{
+		RUNTIME_ASSERT(right > left, "Right X position must be larger than left X position.\n");
+		RUNTIME_ASSERT(bottom > top, "Bottom Y position must be larger than top Y position.\n");
+		RUNTIME_ASSERT(m_Colors.size() < S_NO_FREE_SLOT, "Shape registry is full.\n");
+
+		uint32_t slotIndex = m_FirstFreeSlot;
+
+		if (slotIndex != S_NO_FREE_SLOT)
+		{
+			Slot& slot = m_Slots[slotIndex];
+			m_FirstFreeSlot = slot.denseIndex;
+			++slot.generation;
+		}
+		else
+		{
+			slotIndex = (uint32_t)m_Slots.size();
+			m_Slots.emplace_back();
+		}
+
+		Slot& slot = m_Slots[slotIndex];
+		slot.denseIndex = (uint32_t)m_Colors.size();
+		slot.sequence = m_NextSequence++;
+
+		m_Lefts.push_back(left);
+		m_Tops.push_back(top);
+		m_Rights.push_back(right);
+		m_Bottoms.push_back(bottom);
+		m_Colors.push_back(color);
+		m_DenseSlots.push_back(slotIndex);
+
+		return { slotIndex, slot.generation };
+	}
+
+	ShapeHandle ShapeRegistry::Add(CTMDirectX::Graphics::Geometry::DXRect& rect) noexcept
+	{
+		const CTMDirectX::Graphics::Geometry::DXAABB& aabb = rect.Aabb();
+		return Add(aabb.left, aabb.top, aabb.right, aabb.bottom, rect.Color());
+	}
+
+	bool ShapeRegistry::Remove(ShapeHandle handle) noexcept
+	{
+		if (!IsAlive(handle))
+			return false;
+
+		Slot& slot = m_Slots[handle.slot];
+		const uint32_t denseIndex = slot.denseIndex;
+		const uint32_t lastIndex = (uint32_t)m_Colors.size() - 1;
+
+		// Moves the last shape into the hole, so the columns stay packed.
+		if (denseIndex != lastIndex)
+		{
+			m_Lefts[denseIndex] = m_Lefts[lastIndex];
+			m_Tops[denseIndex] = m_Tops[lastIndex];
+			m_Rights[denseIndex] = m_Rights[lastIndex];
+			m_Bottoms[denseIndex] = m_Bottoms[lastIndex];
+			m_Colors[denseIndex] = m_Colors[lastIndex];
+			m_DenseSlots[denseIndex] = m_DenseSlots[lastIndex];
+
+			m_Slots[m_DenseSlots[denseIndex]].denseIndex = denseIndex;
+		}
+
+		m_Lefts.pop_back();
+		m_Tops.pop_back();
+		m_Rights.pop_back();
+		m_Bottoms.pop_back();
+		m_Colors.pop_back();
+		m_DenseSlots.pop_back();
+
+		++slot.generation;
+		slot.denseIndex = m_FirstFreeSlot;
+		m_FirstFreeSlot = handle.slot;
+
+		return true;
+	}
+
+	bool ShapeRegistry::SetBounds(ShapeHandle handle, float left, float top, float right, float bottom) noexcept
+	{
+		RUNTIME_ASSERT(right > left, "Right X position must be larger than left X position.\n");
+		RUNTIME_ASSERT(bottom > top, "Bottom Y position must be larger than top Y position.\n");
+
+		if (!IsAlive(handle))
+			return false;
+
+		const uint32_t denseIndex = m_Slots[handle.slot].denseIndex;
+		m_Lefts[denseIndex] = left;
+		m_Tops[denseIndex] = top;
+		m_Rights[denseIndex] = right;
+		m_Bottoms[denseIndex] = bottom;
+
+		return true;
+	}
+
+	bool ShapeRegistry::SetColor(ShapeHandle handle, const CTMDirectX::Graphics::DXColor& color) noexcept
+	{
+		if (!IsAlive(handle))
+			return false;
+
+		m_Colors[m_Slots[handle.slot].denseIndex] = color;
+		return true;
+	}
+
+	void ShapeRegistry::Clear() noexcept
+	{
+		// Frees every live slot instead of dropping the slots, so no generation is ever handed out twice.
+		for (uint32_t slotIndex : m_DenseSlots)
+		{
+			Slot& slot = m_Slots[slotIndex];
+			++slot.generation;
+			slot.denseIndex = m_FirstFreeSlot;
+			m_FirstFreeSlot = slotIndex;
+		}
+
+		m_Lefts.clear();
+		m_Tops.clear();
+		m_Rights.clear();
+		m_Bottoms.clear();
+		m_Colors.clear();
+		m_DenseSlots.clear();
+	}
+
+	void ShapeRegistry::Reserve(size_t count) noexcept
+	{
+		m_Slots.reserve(count);
+		m_Lefts.reserve(count);
+		m_Tops.reserve(count);
+		m_Rights.reserve(count);
+		m_Bottoms.reserve(count);
+		m_Colors.reserve(count);
+		m_DenseSlots.reserve(count);
+	}
+
+	RectBatch ShapeRegistry::Batch() const noexcept
+	{
+		RectBatch batch;
+		batch.pLeft = m_Lefts.data();
+		batch.pTop = m_Tops.data();
+		batch.pRight = m_Rights.data();
+		batch.pBottom = m_Bottoms.data();
+		batch.pColors = m_Colors.data();
+		batch.count = m_Colors.size();
+
+		return batch;
+	}
+	#pragma endregion
+}
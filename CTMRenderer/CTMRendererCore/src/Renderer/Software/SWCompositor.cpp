@@ -0,0 +1,51 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWCompositor.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+#include "Threading/ParallelFor.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		// Rows per band, enough to amortize scheduling while leaving bands for every thread at common resolutions.
+		constexpr unsigned int S_ROWS_PER_BAND = 32;
+
+		// Composites the rows [firstRow, lastRow) of target the layer overlaps.
+		void CompositeRows(SWFramebuffer& target, const SWFramebuffer& layer, int x, int y, unsigned char opacity, int firstRow, int lastRow) noexcept
+		{
+			const int left = std::max(x, 0);
+			const int right = std::min(x + (int)layer.Width(), (int)target.Width());
+			const int top = std::max({ y, 0, firstRow });
+			const int bottom = std::min({ y + (int)layer.Height(), (int)target.Height(), lastRow });
+
+			if (left >= right || top >= bottom || opacity == 0)
+				return;
+
+			const SWSpanKernels& kernels = ActiveSpanKernels();
+			const size_t width = (size_t)(right - left);
+
+			for (int row = top; row < bottom; ++row)
+				kernels.BlendSpan(target.Row((unsigned int)row) + left, layer.Row((unsigned int)(row - y)) + (left - x), width, opacity);
+		}
+	}
+
+	void CompositeOver(SWFramebuffer& target, const SWFramebuffer& layer, int x, int y, unsigned char opacity) noexcept
+	{
+		CompositeRows(target, layer, x, y, opacity, 0, (int)target.Height());
+	}
+
+	void CompositeLayers(Threading::WorkerPool& pool, SWFramebuffer& target, const std::vector<SWLayer>& layers) noexcept
+	{
+		const size_t bandCount = (target.Height() + S_ROWS_PER_BAND - 1) / S_ROWS_PER_BAND;
+
+		Threading::ParallelFor(pool, bandCount, [&](size_t band) {
+			const int firstRow = (int)(band * S_ROWS_PER_BAND);
+			const int lastRow = std::min(firstRow + (int)S_ROWS_PER_BAND, (int)target.Height());
+
+			for (const SWLayer& layer : layers)
+				if (layer.isVisible)
+					CompositeRows(target, layer.pixels, layer.x, layer.y, layer.opacity, firstRow, lastRow);
+		});
+	}
+}
@@ -0,0 +1,91 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWDamageRenderer.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		void DrawShape(SWFramebuffer& target, const RectBatch& batch, size_t denseIndex, const SWPixelRect& clip) noexcept
+		{
+			SWPixelRect rect = CoveredPixels(batch.pLeft[denseIndex], batch.pTop[denseIndex], batch.pRight[denseIndex], batch.pBottom[denseIndex], target.Width(), target.Height());
+			rect.left = std::max(rect.left, clip.left);
+			rect.top = std::max(rect.top, clip.top);
+			rect.right = std::min(rect.right, clip.right);
+			rect.bottom = std::min(rect.bottom, clip.bottom);
+
+			FillRect(target, rect, PackBGRA8(batch.pColors[denseIndex]));
+		}
+	}
+
+	#pragma region Public API
+	void SWDamageRenderer::Draw(SWFramebuffer& target, uint32_t clearBgra, const ShapeRegistry& registry, const SpatialGrid& grid, const DamageRegion& damage) noexcept
+	{
+		RUNTIME_ASSERT(grid.Size() == registry.Size(), "Grid and registry hold different shapes.\n");
+
+		if (damage.isFull)
+		{
+			DrawAll(target, clearBgra, registry);
+			return;
+		}
+
+		Timer::Timer timer;
+
+		const RectBatch batch = registry.Batch();
+		m_Stats = SWDamageStats();
+
+		for (const DamageRect& damageRect : damage.rects)
+		{
+			const SWPixelRect clip = { damageRect.left, damageRect.top, damageRect.right, damageRect.bottom };
+			RUNTIME_ASSERT(clip.right <= (int)target.Width() && clip.bottom <= (int)target.Height(), "Damage is out of bounds.\n");
+
+			FillRect(target, clip, clearBgra);
+
+			m_Hits.clear();
+			grid.QueryRect((float)clip.left, (float)clip.top, (float)clip.right, (float)clip.bottom, m_Hits);
+
+			std::sort(m_Hits.begin(), m_Hits.end(), [&registry](const ShapeHandle& a, const ShapeHandle& b) { return registry.Sequence(a) < registry.Sequence(b); });
+
+			for (const ShapeHandle& hit : m_Hits)
+			{
+				RUNTIME_ASSERT(registry.IsAlive(hit), "Grid holds a removed shape.\n");
+				DrawShape(target, batch, registry.DenseIndex(hit), clip);
+			}
+
+			m_Stats.pixels += damageRect.Area();
+			m_Stats.drawnShapes += m_Hits.size();
+		}
+
+		m_Stats.rects = damage.rects.size();
+		m_Stats.drawMillis = timer.ElapsedMillis();
+	}
+
+	void SWDamageRenderer::DrawAll(SWFramebuffer& target, uint32_t clearBgra, const ShapeRegistry& registry) noexcept
+	{
+		Timer::Timer timer;
+
+		const RectBatch batch = registry.Batch();
+		const SWPixelRect clip = { 0, 0, (int)target.Width(), (int)target.Height() };
+
+		m_DrawOrder.resize(batch.count);
+		for (size_t i = 0; i < batch.count; ++i)
+			m_DrawOrder[i] = { registry.Sequence(registry.Handle(i)), (uint32_t)i };
+
+		std::sort(m_DrawOrder.begin(), m_DrawOrder.end());
+
+		target.Clear(clearBgra);
+
+		for (const auto& [sequence, denseIndex] : m_DrawOrder)
+			DrawShape(target, batch, denseIndex, clip);
+
+		m_Stats = SWDamageStats();
+		m_Stats.isFull = true;
+		m_Stats.rects = 1;
+		m_Stats.pixels = (uint64_t)target.Width() * target.Height();
+		m_Stats.drawnShapes = batch.count;
+		m_Stats.drawMillis = timer.ElapsedMillis();
+	}
+	#pragma endregion
+}
@@ -0,0 +1,340 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWDeltaEncoder.hpp"
+#include "CTMRenderer/Timer.hpp"
+#include "Threading/ParallelFor.hpp"
+
+#include <bit> // std::endian
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		constexpr size_t S_RLE_RUN_SIZE = sizeof(uint16_t) + sizeof(uint32_t);
+		constexpr uint32_t S_MAX_RUN_LENGTH = 0xFFFF;
+
+		// Arbitrary non-zero start, so a tile of zeroes doesn't hash to the lanes' starting value.
+		constexpr uint32_t S_HASH_SEED = 0x2545F491u;
+
+		// Pixels are written in memory order, which matches the stream's byte order on every platform we build for.
+		static_assert(std::endian::native == std::endian::little, "The delta stream assumes a little endian host.");
+
+		inline void Put16(unsigned char* pDst, uint16_t value) noexcept { std::memcpy(pDst, &value, sizeof(value)); }
+		inline void Put32(unsigned char* pDst, uint32_t value) noexcept { std::memcpy(pDst, &value, sizeof(value)); }
+		inline void Put64(unsigned char* pDst, uint64_t value) noexcept { std::memcpy(pDst, &value, sizeof(value)); }
+
+		template<typename T>
+		[[nodiscard]] inline T Get(const unsigned char* pSrc) noexcept
+		{
+			T value;
+			std::memcpy(&value, pSrc, sizeof(value));
+			return value;
+		}
+
+		struct TileRect
+		{
+			unsigned int x, y, width, height;
+		};
+
+		[[nodiscard]] inline TileRect RectOfTile(size_t tile, unsigned int tilesX, unsigned int tileSize, unsigned int width, unsigned int height) noexcept
+		{
+			const unsigned int x = (unsigned int)(tile % tilesX) * tileSize;
+			const unsigned int y = (unsigned int)(tile / tilesX) * tileSize;
+
+			return { x, y, std::min(tileSize, width - x), std::min(tileSize, height - y) };
+		}
+
+		// Appends the RLE encoding of a tile to payload. Returns false, leaving payload partly written, once it's no smaller than maxBytes.
+		[[nodiscard]] bool AppendRLE(std::vector<unsigned char>& payload, const SWFramebuffer& frame, const TileRect& rect, size_t maxBytes) noexcept
+		{
+			const size_t start = payload.size();
+			uint32_t runPixel = frame.Row(rect.y)[rect.x];
+			uint32_t runLength = 0;
+
+			auto flush = [&]() -> bool {
+				if (payload.size() - start + S_RLE_RUN_SIZE >= maxBytes)
+					return false;
+
+				const size_t at = payload.size();
+				payload.resize(at + S_RLE_RUN_SIZE);
+				Put16(payload.data() + at, (uint16_t)runLength);
+				Put32(payload.data() + at + sizeof(uint16_t), runPixel);
+				return true;
+			};
+
+			for (unsigned int y = rect.y; y < rect.y + rect.height; ++y)
+			{
+				const uint32_t* pRow = frame.Row(y) + rect.x;
+
+				for (unsigned int x = 0; x < rect.width; ++x)
+				{
+					if (pRow[x] == runPixel && runLength != S_MAX_RUN_LENGTH)
+					{
+						++runLength;
+						continue;
+					}
+
+					if (!flush())
+						return false;
+
+					runPixel = pRow[x];
+					runLength = 1;
+				}
+			}
+
+			return flush();
+		}
+	}
+
+	SWDeltaEncoder::SWDeltaEncoder(const SWDeltaSettings& settings) noexcept
+		: m_Settings(settings)
+	{
+		RUNTIME_ASSERT(settings.TileSize != 0, "Tile size cannot be zero.\n");
+		RUNTIME_ASSERT(settings.Sink != nullptr, "A delta encoder needs a sink.\n");
+	}
+
+	#pragma region Public API
+	bool SWDeltaEncoder::Encode(Threading::WorkerPool& pool, const SWFramebuffer& frame, uint64_t frameIndex) noexcept
+	{
+		Timer::Timer timer;
+
+		if (frame.Width() != m_Width || frame.Height() != m_Height)
+			Resize(frame.Width(), frame.Height());
+
+		const bool isKeyframe = m_ForceKeyframe || (m_Settings.KeyframeInterval != 0 && frameIndex % m_Settings.KeyframeInterval == 0);
+		const size_t tileCount = m_Payloads.size();
+
+		Threading::ParallelFor(pool, tileCount, [&](size_t tile) {
+			m_Payloads[tile].clear();
+
+			if (UpdateTile(tile, frame, isKeyframe))
+				EncodeTile(tile, frame);
+		});
+
+		size_t packetSize = S_DELTA_HEADER_SIZE;
+		uint32_t changedTiles = 0;
+
+		for (const std::vector<unsigned char>& payload : m_Payloads)
+		{
+			packetSize += payload.size();
+			changedTiles += payload.empty() ? 0 : 1;
+		}
+
+		m_Packet.resize(packetSize);
+		unsigned char* pPacket = m_Packet.data();
+
+		Put32(pPacket, S_DELTA_MAGIC);
+		Put16(pPacket + 4, S_DELTA_VERSION);
+		Put16(pPacket + 6, isKeyframe ? S_DELTA_KEYFRAME : 0);
+		Put64(pPacket + 8, frameIndex);
+		Put32(pPacket + 16, m_Width);
+		Put32(pPacket + 20, m_Height);
+		Put32(pPacket + 24, m_Settings.TileSize);
+		Put32(pPacket + 28, changedTiles);
+		pPacket += S_DELTA_HEADER_SIZE;
+
+		for (const std::vector<unsigned char>& payload : m_Payloads)
+		{
+			if (payload.empty())
+				continue;
+
+			std::memcpy(pPacket, payload.data(), payload.size());
+			pPacket += payload.size();
+
+			if ((SWTileEncoding)payload[4] == SWTileEncoding::RLE)
+				++m_Stats.rleTiles;
+		}
+
+		m_Stats.encodeMillis += timer.ElapsedMillis();
+		timer.Reset();
+
+		const bool isWritten = m_Settings.Sink->Write(m_Packet.data(), m_Packet.size());
+
+		m_Stats.sinkMillis += timer.ElapsedMillis();
+		++m_Stats.frames;
+		m_Stats.keyframes += isKeyframe ? 1 : 0;
+		m_Stats.tiles += tileCount;
+		m_Stats.changedTiles += changedTiles;
+		m_Stats.frameBytes += (uint64_t)m_Width * m_Height * sizeof(uint32_t);
+
+		// The consumer missed this frame's changes, only a keyframe gets it back in sync.
+		m_ForceKeyframe = !isWritten;
+
+		if (isWritten)
+			m_Stats.bytes += m_Packet.size();
+		else
+			++m_Stats.failedWrites;
+
+		return isWritten;
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void SWDeltaEncoder::Resize(unsigned int width, unsigned int height) noexcept
+	{
+		const unsigned int tileSize = m_Settings.TileSize;
+
+		m_Width = width;
+		m_Height = height;
+		m_TilesX = (width + tileSize - 1) / tileSize;
+		m_TilesY = (height + tileSize - 1) / tileSize;
+
+		const size_t tileCount = (size_t)m_TilesX * m_TilesY;
+		m_Hashes.assign(m_Settings.Compare == SWDeltaCompare::HASH ? tileCount : 0, TileHash{});
+		m_Payloads.resize(tileCount);
+
+		if (m_Settings.Compare == SWDeltaCompare::MEMCMP)
+			m_Previous.Resize(width, height);
+
+		// What was kept describes a different frame size, so every tile is sent.
+		m_ForceKeyframe = true;
+	}
+
+	bool SWDeltaEncoder::UpdateTile(size_t tile, const SWFramebuffer& frame, bool isKeyframe) noexcept
+	{
+		const TileRect rect = RectOfTile(tile, m_TilesX, m_Settings.TileSize, m_Width, m_Height);
+
+		if (m_Settings.Compare == SWDeltaCompare::HASH)
+		{
+			const SWSpanKernels& kernels = ActiveSpanKernels();
+
+			TileHash hash;
+			hash.fill(S_HASH_SEED);
+
+			for (unsigned int y = rect.y; y < rect.y + rect.height; ++y)
+				kernels.HashSpan(hash.data(), frame.Row(y) + rect.x, rect.width);
+
+			const bool isChanged = isKeyframe || hash != m_Hashes[tile];
+			m_Hashes[tile] = hash;
+
+			return isChanged;
+		}
+
+		const size_t rowBytes = (size_t)rect.width * sizeof(uint32_t);
+		bool isChanged = isKeyframe;
+
+		// Rows are only copied from the first difference on, the rows before it already match.
+		for (unsigned int y = rect.y; y < rect.y + rect.height; ++y)
+		{
+			const uint32_t* pRow = frame.Row(y) + rect.x;
+			uint32_t* pPrevious = m_Previous.Row(y) + rect.x;
+
+			if (isChanged || std::memcmp(pRow, pPrevious, rowBytes) != 0)
+			{
+				std::memcpy(pPrevious, pRow, rowBytes);
+				isChanged = true;
+			}
+		}
+
+		return isChanged;
+	}
+
+	void SWDeltaEncoder::EncodeTile(size_t tile, const SWFramebuffer& frame) noexcept
+	{
+		const TileRect rect = RectOfTile(tile, m_TilesX, m_Settings.TileSize, m_Width, m_Height);
+		const size_t rawBytes = (size_t)rect.width * rect.height * sizeof(uint32_t);
+		std::vector<unsigned char>& payload = m_Payloads[tile];
+
+		payload.resize(S_DELTA_TILE_HEADER_SIZE);
+		Put32(payload.data(), (uint32_t)tile);
+
+		SWTileEncoding encoding = SWTileEncoding::RLE;
+
+		if (!AppendRLE(payload, frame, rect, rawBytes))
+		{
+			encoding = SWTileEncoding::RAW;
+			payload.resize(S_DELTA_TILE_HEADER_SIZE + rawBytes);
+
+			unsigned char* pDst = payload.data() + S_DELTA_TILE_HEADER_SIZE;
+			const size_t rowBytes = (size_t)rect.width * sizeof(uint32_t);
+
+			for (unsigned int y = rect.y; y < rect.y + rect.height; ++y, pDst += rowBytes)
+				std::memcpy(pDst, frame.Row(y) + rect.x, rowBytes);
+		}
+
+		payload[4] = (unsigned char)encoding;
+		Put32(payload.data() + 5, (uint32_t)(payload.size() - S_DELTA_TILE_HEADER_SIZE));
+	}
+	#pragma endregion
+
+	bool ApplyDeltaPacket(const unsigned char* pData, size_t size, SWFramebuffer& target) noexcept
+	{
+		if (pData == nullptr || size < S_DELTA_HEADER_SIZE || Get<uint32_t>(pData) != S_DELTA_MAGIC || Get<uint16_t>(pData + 4) != S_DELTA_VERSION)
+			return false;
+
+		const bool isKeyframe = (Get<uint16_t>(pData + 6) & S_DELTA_KEYFRAME) != 0;
+		const unsigned int width = Get<uint32_t>(pData + 16);
+		const unsigned int height = Get<uint32_t>(pData + 20);
+		const unsigned int tileSize = Get<uint32_t>(pData + 24);
+		const uint32_t tileCount = Get<uint32_t>(pData + 28);
+
+		if (tileSize == 0 || width > S_DELTA_MAX_DIMENSION || height > S_DELTA_MAX_DIMENSION)
+			return false;
+
+		if (isKeyframe && (target.Width() != width || target.Height() != height))
+			target.Resize(width, height);
+		else if (target.Width() != width || target.Height() != height)
+			return false;
+
+		const unsigned int tilesX = (width + tileSize - 1) / tileSize;
+		const size_t maxTile = (size_t)tilesX * ((height + tileSize - 1) / tileSize);
+		size_t offset = S_DELTA_HEADER_SIZE;
+
+		for (uint32_t i = 0; i < tileCount; ++i)
+		{
+			if (size - offset < S_DELTA_TILE_HEADER_SIZE)
+				return false;
+
+			const uint32_t tile = Get<uint32_t>(pData + offset);
+			const SWTileEncoding encoding = (SWTileEncoding)pData[offset + 4];
+			const size_t payloadBytes = Get<uint32_t>(pData + offset + 5);
+			offset += S_DELTA_TILE_HEADER_SIZE;
+
+			if (tile >= maxTile || size - offset < payloadBytes)
+				return false;
+
+			const TileRect rect = RectOfTile(tile, tilesX, tileSize, width, height);
+			const unsigned char* pPayload = pData + offset;
+			offset += payloadBytes;
+
+			if (encoding == SWTileEncoding::RAW)
+			{
+				const size_t rowBytes = (size_t)rect.width * sizeof(uint32_t);
+
+				if (payloadBytes != rowBytes * rect.height)
+					return false;
+
+				for (unsigned int y = rect.y; y < rect.y + rect.height; ++y, pPayload += rowBytes)
+					std::memcpy(target.Row(y) + rect.x, pPayload, rowBytes);
+			}
+			else if (encoding == SWTileEncoding::RLE)
+			{
+				if (payloadBytes % S_RLE_RUN_SIZE != 0)
+					return false;
+
+				const unsigned char* pEnd = pPayload + payloadBytes;
+				const size_t tilePixels = (size_t)rect.width * rect.height;
+				size_t pixel = 0;
+
+				for (; pPayload != pEnd; pPayload += S_RLE_RUN_SIZE)
+				{
+					const uint16_t runLength = Get<uint16_t>(pPayload);
+					const uint32_t runPixel = Get<uint32_t>(pPayload + sizeof(uint16_t));
+
+					if (tilePixels - pixel < runLength)
+						return false;
+
+					for (size_t end = pixel + runLength; pixel < end; ++pixel)
+						target.Row(rect.y + (unsigned int)(pixel / rect.width))[rect.x + pixel % rect.width] = runPixel;
+				}
+
+				if (pixel != tilePixels)
+					return false;
+			}
+			else
+				return false;
+		}
+
+		return offset == size;
+	}
+}
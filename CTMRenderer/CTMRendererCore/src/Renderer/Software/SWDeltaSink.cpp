@@ -0,0 +1,137 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWDeltaSink.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CTM_UNIX_SOCKETS
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace CTMRenderer::CTMSoftware
+{
+	#pragma region FileDeltaSink
+	FileDeltaSink::FileDeltaSink(const std::filesystem::path& path) noexcept
+		: m_File(path, std::ios::binary)
+	{
+		if (!m_File)
+			DEBUG_PRINT_ERROR("Failed to open " << path << " for writing.\n");
+	}
+
+	bool FileDeltaSink::Write(const unsigned char* pData, size_t size) noexcept
+	{
+		m_File.write((const char*)pData, (std::streamsize)size);
+		return (bool)m_File;
+	}
+	#pragma endregion
+
+	#pragma region UnixSocketDeltaSink
+	#ifdef CTM_UNIX_SOCKETS
+	UnixSocketDeltaSink::UnixSocketDeltaSink(const std::string& socketPath) noexcept
+	{
+		sockaddr_un address = {};
+		address.sun_family = AF_UNIX;
+
+		if (socketPath.size() >= sizeof(address.sun_path))
+		{
+			DEBUG_PRINT_ERROR("Socket path " << socketPath << " is too long.\n");
+			return;
+		}
+
+		std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+		m_Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (m_Socket < 0)
+		{
+			DEBUG_PRINT_ERROR("Failed to create a socket.\n");
+			return;
+		}
+
+		if (connect(m_Socket, (const sockaddr*)&address, sizeof(address)) != 0)
+		{
+			DEBUG_PRINT_ERROR("Failed to connect to " << socketPath << ".\n");
+			close(m_Socket);
+			m_Socket = -1;
+		}
+	}
+
+	UnixSocketDeltaSink::~UnixSocketDeltaSink() noexcept
+	{
+		if (m_Socket >= 0)
+			close(m_Socket);
+	}
+
+	bool UnixSocketDeltaSink::Write(const unsigned char* pData, size_t size) noexcept
+	{
+		if (m_Socket < 0)
+			return false;
+
+		// The rest of an earlier packet goes first. If the reader still hasn't made room for it, this packet is dropped.
+		if (!Send(m_Pending.data(), m_Pending.size(), m_PendingOffset) || m_PendingOffset != m_Pending.size())
+			return false;
+
+		size_t sent = 0;
+
+		if (!Send(pData, size, sent) || (sent == 0 && size != 0))
+			return false;
+
+		// Dropping a partly sent packet would break the stream's framing, so what's left is sent before the next one.
+		m_Pending.assign(pData + sent, pData + size);
+		m_PendingOffset = 0;
+
+		return true;
+	}
+
+	bool UnixSocketDeltaSink::Send(const unsigned char* pData, size_t size, size_t& offset) noexcept
+	{
+		while (offset < size)
+		{
+			// MSG_NOSIGNAL, so a reader going away fails the write instead of killing the process.
+			const ssize_t sent = send(m_Socket, pData + offset, size - offset, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+			if (sent < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+					return true;
+
+				DEBUG_PRINT_ERROR("Failed to send a delta packet, the socket is closed.\n");
+				close(m_Socket);
+				m_Socket = -1;
+				return false;
+			}
+
+			offset += (size_t)sent;
+		}
+
+		return true;
+	}
+	#else
+	UnixSocketDeltaSink::UnixSocketDeltaSink(const std::string&) noexcept
+	{
+		DEBUG_PRINT_ERROR("Unix sockets aren't supported on this platform.\n");
+	}
+
+	UnixSocketDeltaSink::~UnixSocketDeltaSink() noexcept
+	{
+	}
+
+	bool UnixSocketDeltaSink::Write(const unsigned char*, size_t) noexcept
+	{
+		return false;
+	}
+	#endif
+	#pragma endregion
+
+	#pragma region MemoryDeltaSink
+	bool MemoryDeltaSink::Write(const unsigned char* pData, size_t size) noexcept
+	{
+		m_Packets.emplace_back(pData, pData + size);
+		return true;
+	}
+	#pragma endregion
+}
@@ -0,0 +1,146 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWFrameCapture.hpp"
+#include "CTMRenderer/Timer.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	SWFrameCapture::SWFrameCapture(const SWCaptureSettings& settings) noexcept
+		: m_Settings(settings), m_Buffers(std::max(settings.QueueCapacity, 1u))
+	{
+		for (size_t i = m_Buffers.size(); i-- > 0;)
+			m_FreeBuffers.emplace_back(i);
+
+		std::error_code error;
+		std::filesystem::create_directories(m_Settings.Directory, error);
+
+		if (error)
+			DEBUG_PRINT_ERROR("Failed to create the capture directory " << m_Settings.Directory << " : " << error.message() << '\n');
+
+		m_WriterThread = std::thread(&SWFrameCapture::WriterLoop, this);
+	}
+
+	SWFrameCapture::~SWFrameCapture() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_ShouldRun = false;
+		}
+
+		m_QueueCV.notify_one();
+		m_WriterThread.join();
+
+		m_Y4MWriter.Close();
+	}
+
+	#pragma region Public API
+	bool SWFrameCapture::Submit(const SWFramebuffer& frame, uint64_t frameIndex) noexcept
+	{
+		size_t bufferIndex = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			++m_Stats.submitted;
+
+			if (m_FreeBuffers.empty())
+			{
+				++m_Stats.dropped;
+				return false;
+			}
+
+			bufferIndex = m_FreeBuffers.back();
+			m_FreeBuffers.pop_back();
+		}
+
+		// The buffer is owned by this call until queued, so the copy runs without the lock.
+		Timer::Timer copyTimer;
+
+		SWFramebuffer& buffer = m_Buffers[bufferIndex];
+		if (buffer.Width() != frame.Width() || buffer.Height() != frame.Height())
+			buffer.Resize(frame.Width(), frame.Height());
+
+		BlitNearest(frame, buffer);
+
+		const double copyMillis = copyTimer.ElapsedMillis();
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stats.copyMillis += copyMillis;
+			m_Queue.push_back({ bufferIndex, frameIndex });
+		}
+
+		m_QueueCV.notify_one();
+		return true;
+	}
+
+	void SWFrameCapture::Flush() noexcept
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_IdleCV.wait(lock, [this] { return m_Queue.empty() && !m_IsWriting; });
+	}
+
+	SWCaptureStats SWFrameCapture::Stats() const noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void SWFrameCapture::WriterLoop() noexcept
+	{
+		Threading::ApplyThreadPlacement(m_Settings.WriterThread);
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		while (true)
+		{
+			m_QueueCV.wait(lock, [this] { return !m_Queue.empty() || !m_ShouldRun; });
+
+			// Drain remaining frames before shutting down.
+			if (m_Queue.empty())
+				return;
+
+			const QueuedFrame queued = m_Queue.front();
+			m_Queue.pop_front();
+			m_IsWriting = true;
+
+			lock.unlock();
+
+			Timer::Timer encodeTimer;
+			const bool isWritten = Write(m_Buffers[queued.bufferIndex], queued.frameIndex);
+			const double encodeMillis = encodeTimer.ElapsedMillis();
+
+			lock.lock();
+
+			m_Stats.encodeMillis += encodeMillis;
+			++(isWritten ? m_Stats.written : m_Stats.failed);
+
+			m_FreeBuffers.emplace_back(queued.bufferIndex);
+			m_IsWriting = false;
+
+			if (m_Queue.empty())
+				m_IdleCV.notify_all();
+		}
+	}
+
+	bool SWFrameCapture::Write(const SWFramebuffer& frame, uint64_t frameIndex) noexcept
+	{
+		switch (m_Settings.Format)
+		{
+		case SWCaptureFormat::PPM_SEQUENCE:
+			return WritePPM(frame, m_Settings.Directory / ("frame_" + std::to_string(frameIndex) + ".ppm"));
+		case SWCaptureFormat::PNG_SEQUENCE:
+			return WritePNG(frame, m_Settings.Directory / ("frame_" + std::to_string(frameIndex) + ".png"));
+		case SWCaptureFormat::Y4M_STREAM:
+			// The stream takes the size of its first frame.
+			if (!m_Y4MWriter.IsOpen() && !m_Y4MWriter.Open(m_Settings.Directory / "capture.y4m", frame.Width(), frame.Height(), m_Settings.FrameRate))
+				return false;
+
+			return m_Y4MWriter.WriteFrame(frame);
+		}
+
+		return false;
+	}
+	#pragma endregion
+}
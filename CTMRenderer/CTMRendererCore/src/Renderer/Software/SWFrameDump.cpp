@@ -0,0 +1,290 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWFrameDump.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		#pragma region PNG
+		// CRC-32 as used by PNG chunks. (Polynomial 0xEDB88320)
+		struct Crc32Table
+		{
+			constexpr Crc32Table() noexcept
+			{
+				for (uint32_t i = 0; i < 256; ++i)
+				{
+					uint32_t crc = i;
+					for (int bit = 0; bit < 8; ++bit)
+						crc = (crc & 1) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+
+					values[i] = crc;
+				}
+			}
+
+			uint32_t values[256] = {};
+		};
+
+		constexpr Crc32Table S_CRC32_TABLE;
+
+		uint32_t UpdateCrc32(uint32_t crc, const unsigned char* pData, size_t size) noexcept
+		{
+			for (size_t i = 0; i < size; ++i)
+				crc = S_CRC32_TABLE.values[(crc ^ pData[i]) & 0xFF] ^ (crc >> 8);
+
+			return crc;
+		}
+
+		void AppendBigEndian(std::vector<unsigned char>& bytes, uint32_t value) noexcept
+		{
+			bytes.push_back((unsigned char)(value >> 24));
+			bytes.push_back((unsigned char)(value >> 16));
+			bytes.push_back((unsigned char)(value >> 8));
+			bytes.push_back((unsigned char)value);
+		}
+
+		void WriteChunk(std::ofstream& file, const char (&type)[5], const std::vector<unsigned char>& data) noexcept
+		{
+			std::vector<unsigned char> header;
+			AppendBigEndian(header, (uint32_t)data.size());
+			header.insert(header.end(), type, type + 4);
+
+			uint32_t crc = UpdateCrc32(0xFFFFFFFFu, header.data() + 4, 4);
+			crc = UpdateCrc32(crc, data.data(), data.size()) ^ 0xFFFFFFFFu;
+
+			std::vector<unsigned char> footer;
+			AppendBigEndian(footer, crc);
+
+			file.write((const char*)header.data(), (std::streamsize)header.size());
+			file.write((const char*)data.data(), (std::streamsize)data.size());
+			file.write((const char*)footer.data(), (std::streamsize)footer.size());
+		}
+		#pragma endregion
+
+		// BT.601 limited range, in 8 bit fixed point.
+		inline unsigned char ToY(int r, int g, int b) noexcept { return (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16); }
+		inline unsigned char ToU(int r, int g, int b) noexcept { return (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128); }
+		inline unsigned char ToV(int r, int g, int b) noexcept { return (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128); }
+	}
+
+	bool WritePPM(const SWFramebuffer& framebuffer, const std::filesystem::path& path) noexcept
+	{
+		RUNTIME_ASSERT(framebuffer.Width() != 0 && framebuffer.Height() != 0, "Framebuffer is empty.\n");
+
+		std::ofstream file(path, std::ios::binary);
+
+		if (!file)
+		{
+			DEBUG_PRINT_ERROR("Failed to open " << path << " for writing.\n");
+			return false;
+		}
+
+		file << "P6\n" << framebuffer.Width() << ' ' << framebuffer.Height() << "\n255\n";
+
+		// Converted a row at a time, so a dump never allocates a second full frame.
+		std::vector<unsigned char> rgbRow((size_t)framebuffer.Width() * 3);
+
+		for (unsigned int y = 0; y < framebuffer.Height(); ++y)
+		{
+			const uint32_t* pRow = framebuffer.Row(y);
+
+			for (unsigned int x = 0; x < framebuffer.Width(); ++x)
+			{
+				rgbRow[x * 3 + 0] = (unsigned char)(pRow[x] >> 16);
+				rgbRow[x * 3 + 1] = (unsigned char)(pRow[x] >> 8);
+				rgbRow[x * 3 + 2] = (unsigned char)pRow[x];
+			}
+
+			file.write((const char*)rgbRow.data(), (std::streamsize)rgbRow.size());
+		}
+
+		if (!file)
+		{
+			DEBUG_PRINT_ERROR("Failed to write " << path << ".\n");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool WritePNG(const SWFramebuffer& framebuffer, const std::filesystem::path& path) noexcept
+	{
+		RUNTIME_ASSERT(framebuffer.Width() != 0 && framebuffer.Height() != 0, "Framebuffer is empty.\n");
+
+		std::ofstream file(path, std::ios::binary);
+
+		if (!file)
+		{
+			DEBUG_PRINT_ERROR("Failed to open " << path << " for writing.\n");
+			return false;
+		}
+
+		static constexpr unsigned char S_SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		file.write((const char*)S_SIGNATURE, sizeof(S_SIGNATURE));
+
+		std::vector<unsigned char> header;
+		AppendBigEndian(header, framebuffer.Width());
+		AppendBigEndian(header, framebuffer.Height());
+		header.insert(header.end(), { 8, 2, 0, 0, 0 }); // 8 bit depth, RGB, deflate, adaptive filtering, no interlace.
+		WriteChunk(file, "IHDR", header);
+
+		// Every row is a filter type byte (0, none) followed by its RGB bytes.
+		const size_t rowSize = 1 + (size_t)framebuffer.Width() * 3;
+		const size_t rawSize = rowSize * framebuffer.Height();
+
+		constexpr size_t S_MAX_STORED_BLOCK = 65535;
+		const size_t blockCount = (rawSize + S_MAX_STORED_BLOCK - 1) / S_MAX_STORED_BLOCK;
+
+		std::vector<unsigned char> zlib;
+		zlib.reserve(2 + rawSize + blockCount * 5 + 4);
+		zlib.insert(zlib.end(), { 0x78, 0x01 }); // Deflate with a 32K window, no preset dictionary.
+
+		std::vector<unsigned char> raw(rawSize);
+		for (unsigned int y = 0; y < framebuffer.Height(); ++y)
+		{
+			unsigned char* pRaw = raw.data() + (size_t)y * rowSize;
+			const uint32_t* pRow = framebuffer.Row(y);
+
+			pRaw[0] = 0;
+			for (unsigned int x = 0; x < framebuffer.Width(); ++x)
+			{
+				pRaw[1 + x * 3 + 0] = (unsigned char)(pRow[x] >> 16);
+				pRaw[1 + x * 3 + 1] = (unsigned char)(pRow[x] >> 8);
+				pRaw[1 + x * 3 + 2] = (unsigned char)pRow[x];
+			}
+		}
+
+		for (size_t offset = 0; offset < rawSize; offset += S_MAX_STORED_BLOCK)
+		{
+			const size_t length = std::min(S_MAX_STORED_BLOCK, rawSize - offset);
+			const bool isFinal = offset + length == rawSize;
+
+			zlib.push_back(isFinal ? 1 : 0); // Stored block.
+			zlib.push_back((unsigned char)length);
+			zlib.push_back((unsigned char)(length >> 8));
+			zlib.push_back((unsigned char)~length);
+			zlib.push_back((unsigned char)(~length >> 8));
+			zlib.insert(zlib.end(), raw.begin() + (std::ptrdiff_t)offset, raw.begin() + (std::ptrdiff_t)(offset + length));
+		}
+
+		// Adler-32 of the raw data, with the sums reduced lazily. (5552 is the longest run that can't overflow)
+		uint32_t adlerA = 1, adlerB = 0;
+		size_t sinceReduce = 0;
+
+		for (size_t i = 0; i < rawSize; ++i)
+		{
+			adlerA += raw[i];
+			adlerB += adlerA;
+
+			if (++sinceReduce == 5552)
+			{
+				adlerA %= 65521;
+				adlerB %= 65521;
+				sinceReduce = 0;
+			}
+		}
+
+		AppendBigEndian(zlib, ((adlerB % 65521) << 16) | (adlerA % 65521));
+		WriteChunk(file, "IDAT", zlib);
+		WriteChunk(file, "IEND", {});
+
+		if (!file)
+		{
+			DEBUG_PRINT_ERROR("Failed to write " << path << ".\n");
+			return false;
+		}
+
+		return true;
+	}
+
+	#pragma region SWY4MWriter
+	bool SWY4MWriter::Open(const std::filesystem::path& path, unsigned int width, unsigned int height, unsigned int frameRate) noexcept
+	{
+		RUNTIME_ASSERT(!IsOpen(), "Y4M stream is already open.\n");
+		RUNTIME_ASSERT(width != 0 && height != 0, "Y4M frames can't be empty.\n");
+
+		m_File.open(path, std::ios::binary);
+
+		if (!m_File)
+		{
+			DEBUG_PRINT_ERROR("Failed to open " << path << " for writing.\n");
+			return false;
+		}
+
+		m_Width = width;
+		m_Height = height;
+
+		const size_t chromaSize = (size_t)((width + 1) / 2) * ((height + 1) / 2);
+		m_Planes.resize((size_t)width * height + chromaSize * 2);
+
+		m_File << "YUV4MPEG2 W" << width << " H" << height << " F" << (frameRate != 0 ? frameRate : 60) << ":1 Ip A1:1 C420jpeg XCOLORRANGE=LIMITED\n";
+		return (bool)m_File;
+	}
+
+	bool SWY4MWriter::WriteFrame(const SWFramebuffer& framebuffer) noexcept
+	{
+		RUNTIME_ASSERT(IsOpen(), "Y4M stream isn't open.\n");
+
+		if (framebuffer.Width() != m_Width || framebuffer.Height() != m_Height)
+		{
+			DEBUG_PRINT_ERROR("Frame size " << framebuffer.Width() << 'x' << framebuffer.Height() << " doesn't match the Y4M stream.\n");
+			return false;
+		}
+
+		const unsigned int chromaWidth = (m_Width + 1) / 2;
+		const unsigned int chromaHeight = (m_Height + 1) / 2;
+
+		unsigned char* pY = m_Planes.data();
+		unsigned char* pU = pY + (size_t)m_Width * m_Height;
+		unsigned char* pV = pU + (size_t)chromaWidth * chromaHeight;
+
+		for (unsigned int y = 0; y < m_Height; ++y)
+		{
+			const uint32_t* pRow = framebuffer.Row(y);
+
+			for (unsigned int x = 0; x < m_Width; ++x)
+				pY[(size_t)y * m_Width + x] = ToY((pRow[x] >> 16) & 0xFF, (pRow[x] >> 8) & 0xFF, pRow[x] & 0xFF);
+		}
+
+		// Chroma of every 2x2 block, from its averaged color. Odd edges reuse their last row or column.
+		for (unsigned int y = 0; y < chromaHeight; ++y)
+		{
+			const uint32_t* pTop = framebuffer.Row(y * 2);
+			const uint32_t* pBottom = framebuffer.Row(std::min(y * 2 + 1, m_Height - 1));
+
+			for (unsigned int x = 0; x < chromaWidth; ++x)
+			{
+				const unsigned int left = x * 2;
+				const unsigned int right = std::min(left + 1, m_Width - 1);
+				const uint32_t pixels[4] = { pTop[left], pTop[right], pBottom[left], pBottom[right] };
+
+				int r = 0, g = 0, b = 0;
+				for (uint32_t pixel : pixels)
+				{
+					r += (pixel >> 16) & 0xFF;
+					g += (pixel >> 8) & 0xFF;
+					b += pixel & 0xFF;
+				}
+
+				r = (r + 2) / 4;
+				g = (g + 2) / 4;
+				b = (b + 2) / 4;
+
+				pU[(size_t)y * chromaWidth + x] = ToU(r, g, b);
+				pV[(size_t)y * chromaWidth + x] = ToV(r, g, b);
+			}
+		}
+
+		m_File << "FRAME\n";
+		m_File.write((const char*)m_Planes.data(), (std::streamsize)m_Planes.size());
+
+		return (bool)m_File;
+	}
+
+	void SWY4MWriter::Close() noexcept
+	{
+		if (IsOpen())
+			m_File.close();
+	}
+	#pragma endregion
+}
@@ -0,0 +1,86 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWFrameRing.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	#pragma region SWFrameFence
+	void SWFrameFence::Signal(uint64_t value) noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Value.store(value, std::memory_order_release);
+		}
+
+		m_CV.notify_all();
+	}
+
+	void SWFrameFence::Wait(uint64_t value) const noexcept
+	{
+		if (CompletedValue() >= value)
+			return;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_CV.wait(lock, [this, value] { return CompletedValue() >= value; });
+	}
+	#pragma endregion
+
+	#pragma region SWFrameRing
+	SWFrameRing::SWFrameRing(const std::vector<uint32_t*>& slotPixels, unsigned int width, unsigned int height, unsigned int stride,
+		SWRingReuse reuse, ReadyCallback readyCallback) noexcept
+		: m_pIsHeld(std::make_unique<std::atomic_bool[]>(slotPixels.size())),
+		  m_pSlotFrames(std::make_unique<std::atomic<uint64_t>[]>(slotPixels.size())), m_Width(width), m_Height(height),
+		  m_Reuse(reuse), m_ReadyCallback(std::move(readyCallback))
+	{
+		RUNTIME_ASSERT(!slotPixels.empty(), "A frame ring needs at least one slot.\n");
+
+		m_Slots.reserve(slotPixels.size());
+		for (size_t i = 0; i < slotPixels.size(); ++i)
+		{
+			m_Slots.emplace_back(slotPixels[i], width, height, stride);
+			m_pIsHeld[i].store(false, std::memory_order_relaxed);
+			m_pSlotFrames[i].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	SWFramebuffer* SWFrameRing::Acquire() noexcept
+	{
+		RUNTIME_ASSERT(m_AcquiredSlot == SIZE_MAX, "The previously acquired slot wasn't published.\n");
+
+		// Slots are taken strictly in order, so consumers always see frames in the order they were rendered.
+		if (m_Reuse == SWRingReuse::ON_RELEASE && m_pIsHeld[m_NextSlot].load(std::memory_order_acquire))
+		{
+			m_SkippedFrames.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		m_AcquiredSlot = m_NextSlot;
+		m_NextSlot = (m_NextSlot + 1) % m_Slots.size();
+
+		return &m_Slots[m_AcquiredSlot];
+	}
+
+	void SWFrameRing::Publish(uint64_t frameIndex) noexcept
+	{
+		RUNTIME_ASSERT(m_AcquiredSlot != SIZE_MAX, "No slot was acquired.\n");
+
+		const size_t slot = m_AcquiredSlot;
+		m_AcquiredSlot = SIZE_MAX;
+
+		m_pIsHeld[slot].store(true, std::memory_order_release);
+		m_pSlotFrames[slot].store(frameIndex, std::memory_order_release);
+		m_LatestSlot.store(slot, std::memory_order_release);
+		m_Fence.Signal(frameIndex);
+
+		if (m_ReadyCallback != nullptr)
+			m_ReadyCallback(slot, frameIndex, m_Slots[slot]);
+	}
+
+	void SWFrameRing::Release(size_t slot) noexcept
+	{
+		RUNTIME_ASSERT(slot < m_Slots.size(), "Released slot is out of range.\n");
+
+		m_pIsHeld[slot].store(false, std::memory_order_release);
+	}
+	#pragma endregion
+}
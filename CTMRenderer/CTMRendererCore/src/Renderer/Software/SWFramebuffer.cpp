@@ -0,0 +1,79 @@
+#include "Core/CorePCH.hpp"
+#include "CTMRenderer/Software/SWFramebuffer.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	SWFramebuffer::SWFramebuffer(unsigned int width, unsigned int height) noexcept
+	{
+		Resize(width, height);
+	}
+
+	SWFramebuffer::SWFramebuffer(uint32_t* pExternalPixels, unsigned int width, unsigned int height, unsigned int stride) noexcept
+		: m_pExternalPixels(pExternalPixels), m_Width(width), m_Height(height), m_Stride(stride)
+	{
+		RUNTIME_ASSERT(pExternalPixels != nullptr, "External pixels are nullptr.\n");
+		RUNTIME_ASSERT(width != 0 && height != 0, "Framebuffer size cannot be zero.\n");
+		RUNTIME_ASSERT(stride >= width, "Stride must be at least the width.\n");
+	}
+
+	void SWFramebuffer::Resize(unsigned int width, unsigned int height) noexcept
+	{
+		RUNTIME_ASSERT(!IsExternal(), "Framebuffers wrapping external memory can't be resized.\n");
+		RUNTIME_ASSERT(width != 0, "Width cannot be zero.\n");
+		RUNTIME_ASSERT(height != 0, "Height cannot be zero.\n");
+
+		const size_t pixels = (size_t)width * height;
+		if (m_Pixels.size() < pixels)
+			m_Pixels.resize(pixels);
+
+		m_Width = width;
+		m_Height = height;
+		m_Stride = width;
+	}
+
+	void SWFramebuffer::Clear(uint32_t bgra) noexcept
+	{
+		ActiveSpanKernels().FillRect(Data(), m_Stride, m_Width, m_Height, bgra);
+	}
+
+	void BlitNearest(const SWFramebuffer& src, SWFramebuffer& dst) noexcept
+	{
+		RUNTIME_ASSERT(src.Width() != 0 && src.Height() != 0, "Source framebuffer is empty.\n");
+
+		if (src.Width() == dst.Width() && src.Height() == dst.Height())
+		{
+			for (unsigned int y = 0; y < dst.Height(); ++y)
+				std::memcpy(dst.Row(y), src.Row(y), (size_t)dst.Width() * sizeof(uint32_t));
+			return;
+		}
+
+		// 16.16 fixed point steps through the source, sampling at destination pixel centers.
+		const uint32_t stepX = (uint32_t)(((uint64_t)src.Width() << 16) / dst.Width());
+		const uint32_t stepY = (uint32_t)(((uint64_t)src.Height() << 16) / dst.Height());
+
+		uint32_t srcY = stepY >> 1;
+		const uint32_t* pPrevSrcRow = nullptr;
+		uint32_t* pPrevDstRow = nullptr;
+
+		for (unsigned int y = 0; y < dst.Height(); ++y, srcY += stepY)
+		{
+			const uint32_t* pSrcRow = src.Row(srcY >> 16);
+			uint32_t* pDstRow = dst.Row(y);
+
+			// Upscaling repeats source rows, so copy the previously expanded row instead of resampling it.
+			if (pSrcRow == pPrevSrcRow)
+			{
+				std::memcpy(pDstRow, pPrevDstRow, (size_t)dst.Width() * sizeof(uint32_t));
+				continue;
+			}
+
+			uint32_t srcX = stepX >> 1;
+			for (unsigned int x = 0; x < dst.Width(); ++x, srcX += stepX)
+				pDstRow[x] = pSrcRow[srcX >> 16];
+
+			pPrevSrcRow = pSrcRow;
+			pPrevDstRow = pDstRow;
+		}
+	}
+}
@@ -0,0 +1,91 @@
+#include "Core/CorePCH.hpp"
+#include "CTMRenderer/Software/SWRasterizer.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		// Index of the first pixel whose center is at or right of the edge. (Top-left rule)
+		inline int EdgeToPixel(float edge, int max) noexcept
+		{
+			const float pixel = std::ceil(edge - 0.5f);
+
+			if (pixel <= 0.0f)
+				return 0;
+			if (pixel >= (float)max)
+				return max;
+
+			return (int)pixel;
+		}
+	}
+
+	SWRasterizer::SWRasterizer(const CTMDirectX::Window::Geometry::WindowArea& screenAreaRef) noexcept
+		: m_ScreenAreaRef(screenAreaRef),
+		  m_QuadRight((float)screenAreaRef.width), m_QuadBottom((float)screenAreaRef.height)
+	{
+	}
+
+	void SWRasterizer::SetBaseQuad(const CTMDirectX::Graphics::Geometry::DXAABB& baseQuad) noexcept
+	{
+		m_QuadLeft = baseQuad.left;
+		m_QuadTop = baseQuad.top;
+		m_QuadRight = baseQuad.right;
+		m_QuadBottom = baseQuad.bottom;
+	}
+
+	void SWRasterizer::DrawInstances(SWFramebuffer& target, const CTMDirectX::Graphics::InstanceData* pInstances, size_t count) const noexcept
+	{
+		RUNTIME_ASSERT(pInstances != nullptr || count == 0, "Instances are nullptr.\n");
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const SWPixelRect rect = PixelBounds(pInstances[i], target.Width(), target.Height());
+
+			if (!rect.IsEmpty())
+				FillRect(target, rect, PackBGRA8(pInstances[i].color));
+		}
+	}
+
+	SWPixelRect SWRasterizer::PixelBounds(const CTMDirectX::Graphics::InstanceData& instance, unsigned int targetWidth, unsigned int targetHeight) const noexcept
+	{
+		// Screen space to target pixels. (The viewport transform)
+		const float toTargetX = (float)targetWidth / m_ScreenAreaRef.width;
+		const float toTargetY = (float)targetHeight / m_ScreenAreaRef.height;
+
+		float left = (m_QuadLeft * instance.scalarXY.x + instance.offsetXY.x) * toTargetX;
+		float right = (m_QuadRight * instance.scalarXY.x + instance.offsetXY.x) * toTargetX;
+		float top = (m_QuadTop * instance.scalarXY.y + instance.offsetXY.y) * toTargetY;
+		float bottom = (m_QuadBottom * instance.scalarXY.y + instance.offsetXY.y) * toTargetY;
+
+		// Negative scalars mirror the quad.
+		if (left > right)
+			std::swap(left, right);
+		if (top > bottom)
+			std::swap(top, bottom);
+
+		return CoveredPixels(left, top, right, bottom, targetWidth, targetHeight);
+	}
+
+	SWPixelRect CoveredPixels(float left, float top, float right, float bottom, unsigned int targetWidth, unsigned int targetHeight) noexcept
+	{
+		SWPixelRect rect;
+		rect.left = EdgeToPixel(left, (int)targetWidth);
+		rect.right = EdgeToPixel(right, (int)targetWidth);
+		rect.top = EdgeToPixel(top, (int)targetHeight);
+		rect.bottom = EdgeToPixel(bottom, (int)targetHeight);
+		return rect;
+	}
+
+	void FillRect(SWFramebuffer& target, const SWPixelRect& rect, uint32_t bgra) noexcept
+	{
+		RUNTIME_ASSERT(rect.left >= 0 && rect.top >= 0, "Rect is out of bounds.\n");
+		RUNTIME_ASSERT(rect.right <= (int)target.Width() && rect.bottom <= (int)target.Height(), "Rect is out of bounds.\n");
+
+		if (rect.IsEmpty())
+			return;
+
+		ActiveSpanKernels().FillRect(target.Row((unsigned int)rect.top) + rect.left, target.Stride(),
+			(size_t)(rect.right - rect.left), (size_t)(rect.bottom - rect.top), bgra);
+	}
+}
@@ -0,0 +1,183 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWRenderer.hpp"
+#include "CTMRenderer/Software/SWFrameDump.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		// Fills in TargetFPS' frame budget, unless the caller set its own. Unpaced renderers never scale, so any budget does.
+		DynamicResolutionSettings BudgetedSettings(const SWRendererSettings& settings) noexcept
+		{
+			DynamicResolutionSettings dynamicResolution = settings.DynamicResolution;
+
+			if (dynamicResolution.TargetFrameMillis == 0.0)
+				dynamicResolution.TargetFrameMillis = settings.TargetFPS != 0 ? 1000.0 / settings.TargetFPS : DynamicResolutionSettings().TargetFrameMillis;
+
+			return dynamicResolution;
+		}
+	}
+
+	SWRenderer::SWRenderer(const SWRendererSettings& settings)
+		: IRenderer(settings.Threads), m_Settings(settings), m_ScreenArea(settings.Width, settings.Height),
+		  m_Rasterizer(m_ScreenArea), m_TiledRasterizer(m_Rasterizer, settings.TileSize != 0 ? settings.TileSize : SWTiledRasterizer::S_DEFAULT_TILE_SIZE),
+		  m_ScaledTarget(m_ScreenArea, BudgetedSettings(settings)),
+		  m_ClearColor(PackBGRA8(CTMDirectX::Graphics::DXNormColor(0, 0, .1f, 1.0f)))
+	{
+		RUNTIME_ASSERT(settings.OutputRing == nullptr || (settings.OutputRing->Width() == settings.Width && settings.OutputRing->Height() == settings.Height),
+			"The output ring's size must match the renderer's.\n");
+	}
+
+	SWRenderer::SWRenderer(const SWRendererSettings& settings, Threading::WorkerPool& sharedWorkerPool)
+		: IRenderer(sharedWorkerPool), m_Settings(settings), m_ScreenArea(settings.Width, settings.Height),
+		  m_Rasterizer(m_ScreenArea), m_TiledRasterizer(m_Rasterizer, settings.TileSize != 0 ? settings.TileSize : SWTiledRasterizer::S_DEFAULT_TILE_SIZE),
+		  m_ScaledTarget(m_ScreenArea, BudgetedSettings(settings)),
+		  m_ClearColor(PackBGRA8(CTMDirectX::Graphics::DXNormColor(0, 0, .1f, 1.0f)))
+	{
+		RUNTIME_ASSERT(settings.OutputRing == nullptr || (settings.OutputRing->Width() == settings.Width && settings.OutputRing->Height() == settings.Height),
+			"The output ring's size must match the renderer's.\n");
+	}
+
+	#pragma region Public API
+	void SWRenderer::Step(double) noexcept
+	{
+		if (m_RendererStarted.load(std::memory_order_acquire) && IsRunning())
+		{
+			// A ring slot still held by its consumer skips the frame, rather than waiting or rendering elsewhere and copying.
+			SWFramebuffer* pOutput = m_Settings.OutputRing != nullptr ? m_Settings.OutputRing->Acquire() : &m_Framebuffer;
+
+			if (pOutput != nullptr)
+			{
+				m_pFrameOutput = pOutput;
+
+				m_FrameGraph.Execute(m_WorkerPool);
+
+				// Captured and streamed before publishing, as the consumer may reuse the slot as soon as it's published.
+				if (m_Settings.OutputRing != nullptr)
+					m_Settings.OutputRing->Publish(m_FrameCount);
+
+				if (m_Settings.MaxFrames != 0 && m_FrameCount == m_Settings.MaxFrames)
+					m_EventSystem.Dispatcher().QueueEvent<Event::EndEvent>(1738u);
+			}
+		}
+
+		DispatchQueuedEvents();
+	}
+
+	bool SWRenderer::DumpFrame(const std::filesystem::path& path) const noexcept
+	{
+		RUNTIME_ASSERT(m_FrameCount != 0, "No frame has been rendered yet.\n");
+
+		return WritePPM(*m_pLastFrame, path);
+	}
+	#pragma endregion
+
+	#pragma region Protected Functions
+	void SWRenderer::OnStart([[maybe_unused]] const Event::StartEvent* pStartEvent) noexcept
+	{
+		RUNTIME_ASSERT(pStartEvent != nullptr, "Start event is nullptr. How TF did this happen?\n");
+		RUNTIME_ASSERT(m_RendererStarted.load(std::memory_order_acquire) == false, "Renderer has already started.\n");
+
+		DEBUG_PRINT("Start args : " << pStartEvent->PlaceholderArgs() << '\n');
+
+		Threading::TaskGraph startupGraph;
+		startupGraph.Add("SetBaseQuad", [this] { m_Rasterizer.SetBaseQuad(ToAABB(S_TEST_SCENE.baseQuad)); });
+		if (m_Settings.OutputRing == nullptr)
+			startupGraph.Add("AllocateFramebuffer", [this] { m_Framebuffer.Resize(m_ScreenArea.width, m_ScreenArea.height); });
+
+		if (m_Settings.Capture.Interval != 0)
+			startupGraph.Add("StartCapture", [this] { m_pCapture = std::make_unique<SWFrameCapture>(m_Settings.Capture); });
+
+		if (m_Settings.Delta.Sink != nullptr)
+			m_pDeltaEncoder = std::make_unique<SWDeltaEncoder>(m_Settings.Delta);
+
+		startupGraph.Run(m_WorkerPool);
+		m_StartupTimeline = startupGraph.Timeline();
+
+		BuildFrameGraph();
+
+		IF_DEBUG(startupGraph.PrintTimeline(std::cout));
+		IF_DEBUG(m_FrameGraph.PrintReport(std::cout));
+
+		m_RendererStarted.store(true, std::memory_order_release);
+
+		DEBUG_PRINT("Renderer started.\n");
+	}
+
+	void SWRenderer::OnEnd(const Event::EndEvent* pEndEvent) noexcept
+	{
+		// Writes out every queued frame, so captures are complete once the renderer ended.
+		if (m_pCapture != nullptr)
+		{
+			m_pCapture->Flush();
+			m_CaptureStats = m_pCapture->Stats();
+			m_pCapture.reset();
+
+			DEBUG_PRINT("Captured " << m_CaptureStats.written << " frames, dropped " << m_CaptureStats.dropped << ", failed " << m_CaptureStats.failed << ".\n");
+		}
+
+		if (m_pDeltaEncoder != nullptr)
+		{
+			m_DeltaStats = m_pDeltaEncoder->Stats();
+			m_pDeltaEncoder.reset();
+
+			DEBUG_PRINT("Streamed " << m_DeltaStats.bytes << " bytes for " << m_DeltaStats.frameBytes << " bytes of frames.\n");
+		}
+
+		IRenderer::OnEnd(pEndEvent);
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void SWRenderer::BuildFrameGraph() noexcept
+	{
+		const FrameResourceID frame = m_FrameGraph.Import("Frame");
+		const FrameResourceID captureQueue = m_FrameGraph.Import("CaptureQueue");
+		const FrameResourceID deltaStream = m_FrameGraph.Import("DeltaStream");
+
+		// Rasterization fans out over the pool by itself, and dynamic resolution times it on this thread.
+		m_FrameGraph.AddPass("Scene", {}, { frame }, [this] { DoFrame(*m_pFrameOutput); }, Threading::TaskAffinity::CALLER);
+
+		// Never blocks, a frame the writer has no room for is dropped.
+		m_FrameGraph.AddPass("Capture", { frame }, { captureQueue }, [this] {
+			if (m_pCapture->ShouldCapture(m_FrameCount))
+				m_pCapture->Submit(*m_pFrameOutput, m_FrameCount);
+		});
+
+		m_FrameGraph.AddPass("Delta", { frame }, { deltaStream }, [this] { m_pDeltaEncoder->Encode(m_WorkerPool, *m_pFrameOutput, m_FrameCount); });
+
+		m_FrameGraph.MarkOutput(frame);
+
+		if (m_pCapture != nullptr)
+			m_FrameGraph.MarkOutput(captureQueue);
+		if (m_pDeltaEncoder != nullptr)
+			m_FrameGraph.MarkOutput(deltaStream);
+
+		m_FrameGraph.Compile();
+	}
+
+	void SWRenderer::DoFrame(SWFramebuffer& output) noexcept
+	{
+		const double frameStartMillis = m_Timer.ElapsedMillis();
+
+		// Dynamic resolution needs a budget to scale against, so unpaced renderers always render at full size.
+		const bool scaled = m_Settings.UseDynamicResolution && m_Settings.TargetFPS != 0;
+		SWFramebuffer& target = scaled ? m_ScaledTarget.BeginFrame(output) : output;
+
+		if (m_Settings.TileSize != 0)
+			m_TiledRasterizer.Draw(m_WorkerPool, target, m_ClearColor, S_TEST_SCENE.instances.data(), S_TEST_SCENE.instances.size());
+		else
+		{
+			target.Clear(m_ClearColor);
+			m_Rasterizer.DrawInstances(target, S_TEST_SCENE.instances.data(), S_TEST_SCENE.instances.size());
+		}
+
+		if (scaled)
+			m_ScaledTarget.EndFrame(output, m_Timer.ElapsedMillis() - frameStartMillis);
+
+		m_pLastFrame = &output;
+		++m_FrameCount;
+	}
+	#pragma endregion
+}
@@ -0,0 +1,34 @@
+#include "Core/CorePCH.hpp"
+#include "CTMRenderer/Software/SWScaledTarget.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	SWScaledTarget::SWScaledTarget(const CTMDirectX::Window::Geometry::WindowArea& windowAreaRef, const DynamicResolutionSettings& settings) noexcept
+		: m_WindowAreaRef(windowAreaRef), m_Controller(settings)
+	{
+	}
+
+	SWFramebuffer& SWScaledTarget::BeginFrame(SWFramebuffer& output) noexcept
+	{
+		const CTMDirectX::Window::Geometry::WindowArea scaledArea = m_Controller.ScaledArea(m_WindowAreaRef);
+
+		m_RenderingOffscreen = scaledArea.width != output.Width() || scaledArea.height != output.Height();
+
+		if (!m_RenderingOffscreen)
+			return output;
+
+		if (m_Offscreen.Width() != scaledArea.width || m_Offscreen.Height() != scaledArea.height)
+			m_Offscreen.Resize(scaledArea.width, scaledArea.height);
+
+		return m_Offscreen;
+	}
+
+	void SWScaledTarget::EndFrame(SWFramebuffer& output, double frameMillis) noexcept
+	{
+		if (m_RenderingOffscreen)
+			BlitNearest(m_Offscreen, output);
+
+		if (m_Controller.Update(frameMillis))
+			DEBUG_PRINT("Render scale changed to " << m_Controller.Scale() << " (average frame time : " << m_Controller.AverageMillis() << "ms)\n");
+	}
+}
@@ -0,0 +1,226 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWShapeRasterizer.hpp"
+#include "CTMRenderer/Software/SWCompositor.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+#include "Threading/ParallelFor.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		constexpr unsigned int S_BAND_HEIGHT = 32;
+
+		// Pixels of translucent interiors are blended from a constant source row this wide at a time.
+		constexpr size_t S_SOURCE_SPAN = 256;
+
+		// Keeps pixels whose distance is within rounding of the interior's edge on the exact path.
+		constexpr float S_INTERIOR_EPSILON = 1.0f / 1024.0f;
+
+		// A shape with its parameters clamped and colors premultiplied, shared by every row.
+		struct PreparedShape
+		{
+			float centerX, centerY;
+			float halfWidth, halfHeight;
+			float radius;
+			float border;
+			float fill[4], stroke[4]; // Premultiplied B, G, R, A in [0, 255].
+			uint32_t fillBgra;        // Premultiplied.
+			int left, top, right, bottom; // Pixels that may be covered, exclusive.
+		};
+
+		[[nodiscard]] PreparedShape Prepare(const CTMDirectX::Graphics::ShapeInstanceData& shape) noexcept
+		{
+			PreparedShape prepared = {};
+			prepared.centerX = shape.centerXY.x;
+			prepared.centerY = shape.centerXY.y;
+			prepared.halfWidth = std::max(shape.halfSizeXY.x, 0.0f);
+			prepared.halfHeight = std::max(shape.halfSizeXY.y, 0.0f);
+
+			const float smallerHalf = std::min(prepared.halfWidth, prepared.halfHeight);
+			prepared.radius = std::clamp(shape.cornerRadius, 0.0f, smallerHalf);
+			prepared.border = std::clamp(shape.borderWidth, 0.0f, smallerHalf);
+
+			prepared.fillBgra = PremultiplyBGRA8(PackBGRA8(shape.fillColor));
+			const uint32_t strokeBgra = PremultiplyBGRA8(PackBGRA8(shape.borderColor));
+
+			for (unsigned int channel = 0; channel < 4; ++channel)
+			{
+				prepared.fill[channel] = (float)((prepared.fillBgra >> (channel * 8)) & 0xFF);
+				prepared.stroke[channel] = (float)((strokeBgra >> (channel * 8)) & 0xFF);
+			}
+
+			// Coverage reaches half a pixel past the edge, pixel centers are half a pixel into their pixel.
+			prepared.left = (int)std::floor(prepared.centerX - prepared.halfWidth - 1.0f);
+			prepared.top = (int)std::floor(prepared.centerY - prepared.halfHeight - 1.0f);
+			prepared.right = (int)std::ceil(prepared.centerX + prepared.halfWidth + 1.0f);
+			prepared.bottom = (int)std::ceil(prepared.centerY + prepared.halfHeight + 1.0f);
+
+			return prepared;
+		}
+
+		// Returns the premultiplied color a shape adds at a pixel center, relative to the shape's center. 0 when uncovered.
+		[[nodiscard]] uint32_t ShadePixel(const PreparedShape& shape, float x, float y) noexcept
+		{
+			const float outerCoverage = std::clamp(0.5f - RoundedBoxDistance(x, y, shape.halfWidth, shape.halfHeight, shape.radius), 0.0f, 1.0f);
+
+			if (outerCoverage <= 0.0f)
+				return 0;
+
+			float innerCoverage = outerCoverage;
+
+			if (shape.border > 0.0f)
+			{
+				const float innerHalfWidth = shape.halfWidth - shape.border, innerHalfHeight = shape.halfHeight - shape.border;
+
+				innerCoverage = innerHalfWidth > 0.0f && innerHalfHeight > 0.0f
+					? std::clamp(0.5f - RoundedBoxDistance(x, y, innerHalfWidth, innerHalfHeight, std::max(shape.radius - shape.border, 0.0f)), 0.0f, 1.0f)
+					: 0.0f;
+			}
+
+			uint32_t result = 0;
+
+			for (unsigned int channel = 0; channel < 4; ++channel)
+			{
+				const float value = shape.fill[channel] * innerCoverage + shape.stroke[channel] * (outerCoverage - innerCoverage);
+				result |= (uint32_t)(value + 0.5f) << (channel * 8);
+			}
+
+			return result;
+		}
+
+		// Half width of a rounded box's row at distance y from its center, or -1 if the row misses the box.
+		[[nodiscard]] float RowHalfWidth(float y, float halfWidth, float halfHeight, float radius) noexcept
+		{
+			y = std::fabs(y);
+
+			if (y > halfHeight || halfWidth <= 0.0f)
+				return -1.0f;
+			if (y <= halfHeight - radius)
+				return halfWidth;
+
+			const float dy = y - (halfHeight - radius);
+			return halfWidth - radius + std::sqrt(radius * radius - dy * dy);
+		}
+
+		void DrawShapeRows(SWFramebuffer& target, const PreparedShape& shape, const SWPixelRect& bounds, bool useSpans) noexcept
+		{
+			const int left = std::max(shape.left, bounds.left);
+			const int right = std::min(shape.right, bounds.right);
+			const bool isOpaque = (shape.fillBgra >> 24) == 255;
+			const SWSpanKernels& kernels = ActiveSpanKernels();
+
+			// Pixels fully covered by the fill have their whole pixel within the fill, which is the shape inset by border + half a pixel.
+			const float inset = shape.border + 0.5f + S_INTERIOR_EPSILON;
+			const float interiorHalfWidth = shape.halfWidth - inset, interiorHalfHeight = shape.halfHeight - inset;
+			const float interiorRadius = std::max(shape.radius - inset, 0.0f);
+
+			// Pixels with any coverage have their center within the shape grown by half a pixel.
+			const float outset = 0.5f + S_INTERIOR_EPSILON;
+
+			uint32_t fillSource[S_SOURCE_SPAN];
+			if (useSpans && !isOpaque && shape.fillBgra != 0)
+				std::fill(std::begin(fillSource), std::end(fillSource), shape.fillBgra);
+
+			// Returns the pixels whose centers lie within [center - halfWidth, center + halfWidth], clipped to [left, right).
+			auto pixelsWithin = [&](float halfWidth, int& first, int& last) {
+				first = std::max((int)std::ceil(shape.centerX - halfWidth - 0.5f), left);
+				last = std::max(std::min((int)std::floor(shape.centerX + halfWidth - 0.5f) + 1, right), first);
+			};
+
+			for (int y = std::max(shape.top, bounds.top); y < std::min(shape.bottom, bounds.bottom); ++y)
+			{
+				uint32_t* pRow = target.Row((unsigned int)y);
+				const float localY = (float)y + 0.5f - shape.centerY;
+
+				int first = left, last = right;
+				int interiorFirst = right, interiorLast = right;
+
+				if (useSpans)
+				{
+					const float outerHalfWidth = RowHalfWidth(localY, shape.halfWidth + outset, shape.halfHeight + outset, shape.radius + outset);
+					if (outerHalfWidth < 0.0f)
+						continue;
+
+					pixelsWithin(outerHalfWidth, first, last);
+
+					if (interiorHalfWidth > 0.0f && interiorHalfHeight > 0.0f)
+					{
+						const float halfWidth = RowHalfWidth(localY, interiorHalfWidth, interiorHalfHeight, interiorRadius);
+
+						if (halfWidth >= 0.0f)
+							pixelsWithin(halfWidth, interiorFirst, interiorLast);
+					}
+				}
+
+				for (int x = first; x < last; ++x)
+				{
+					if (x == interiorFirst && interiorLast > interiorFirst)
+					{
+						if (isOpaque)
+							kernels.FillSpan(pRow + x, (size_t)(interiorLast - interiorFirst), shape.fillBgra);
+						else if (shape.fillBgra != 0)
+							for (int i = interiorFirst; i < interiorLast; i += (int)S_SOURCE_SPAN)
+								kernels.BlendSpan(pRow + i, fillSource, std::min((size_t)(interiorLast - i), S_SOURCE_SPAN), 255);
+
+						x = interiorLast - 1;
+						continue;
+					}
+
+					const uint32_t color = ShadePixel(shape, (float)x + 0.5f - shape.centerX, localY);
+
+					if (color != 0)
+						pRow[x] = BlendOverReference(pRow[x], color);
+				}
+			}
+		}
+
+		// Draws the shapes' pixels within bounds, which must be within the target.
+		void DrawShapesInRect(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count, const SWPixelRect& bounds, bool useSpans) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const PreparedShape shape = Prepare(pShapes[i]);
+
+				if (shape.bottom > bounds.top && shape.top < bounds.bottom && shape.right > bounds.left && shape.left < bounds.right)
+					DrawShapeRows(target, shape, bounds, useSpans);
+			}
+		}
+	}
+
+	void DrawShapes(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept
+	{
+		RUNTIME_ASSERT(pShapes != nullptr || count == 0, "Shapes are nullptr.\n");
+
+		DrawShapesInRect(target, pShapes, count, { 0, 0, (int)target.Width(), (int)target.Height() }, true);
+	}
+
+	void DrawShapes(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count, const SWPixelRect& scissor) noexcept
+	{
+		RUNTIME_ASSERT(pShapes != nullptr || count == 0, "Shapes are nullptr.\n");
+
+		const SWPixelRect bounds = { std::max(scissor.left, 0), std::max(scissor.top, 0), std::min(scissor.right, (int)target.Width()), std::min(scissor.bottom, (int)target.Height()) };
+
+		if (!bounds.IsEmpty())
+			DrawShapesInRect(target, pShapes, count, bounds, true);
+	}
+
+	void DrawShapes(Threading::WorkerPool& pool, SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept
+	{
+		RUNTIME_ASSERT(pShapes != nullptr || count == 0, "Shapes are nullptr.\n");
+
+		const size_t bandCount = (target.Height() + S_BAND_HEIGHT - 1) / S_BAND_HEIGHT;
+
+		Threading::ParallelFor(pool, bandCount, [&](size_t band) {
+			const int top = (int)(band * S_BAND_HEIGHT);
+			DrawShapesInRect(target, pShapes, count, { 0, top, (int)target.Width(), std::min(top + (int)S_BAND_HEIGHT, (int)target.Height()) }, true);
+		});
+	}
+
+	void DrawShapesReference(SWFramebuffer& target, const CTMDirectX::Graphics::ShapeInstanceData* pShapes, size_t count) noexcept
+	{
+		RUNTIME_ASSERT(pShapes != nullptr || count == 0, "Shapes are nullptr.\n");
+
+		DrawShapesInRect(target, pShapes, count, { 0, 0, (int)target.Width(), (int)target.Height() }, false);
+	}
+}
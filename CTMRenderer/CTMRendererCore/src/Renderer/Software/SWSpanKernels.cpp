@@ -0,0 +1,504 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Core/CpuFeatures.hpp"
+#include "CTMRenderer/Software/SWSpanKernels.hpp"
+#include "CTMRenderer/Software/SWCompositor.hpp"
+
+#ifdef CTM_X86
+#include <immintrin.h>
+#endif
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		#pragma region Scalar
+		void FillSpanScalar(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+				pDst[i] = bgra;
+		}
+
+		void FillRectScalar(uint32_t* pDst, size_t stride, size_t width, size_t height, uint32_t bgra) noexcept
+		{
+			for (size_t y = 0; y < height; ++y, pDst += stride)
+				FillSpanScalar(pDst, width, bgra);
+		}
+
+		void BlendSpanScalar(uint32_t* pDst, const uint32_t* pSrc, size_t count, unsigned char opacity) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+				pDst[i] = BlendOverReference(pDst[i], pSrc[i], opacity);
+		}
+
+		// Odd, so the multiply is invertible. (2^32 / golden ratio)
+		constexpr uint32_t S_HASH_MULTIPLIER = 0x9E3779B1u;
+
+		inline uint32_t HashStep(uint32_t lane, uint32_t pixel) noexcept
+		{
+			lane = (lane ^ pixel) * S_HASH_MULTIPLIER;
+			return (lane << 13) | (lane >> 19);
+		}
+
+		void HashSpanScalar(uint32_t* pLanes, const uint32_t* pSrc, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+				pLanes[i % S_HASH_LANES] = HashStep(pLanes[i % S_HASH_LANES], pSrc[i]);
+		}
+		#pragma endregion
+
+		#ifdef CTM_X86
+		#pragma region SSE2
+		CTM_TARGET("sse2") inline void FillSpanSSE2Inline(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			// Pixels are 4 byte aligned, so at most 3 scalar stores reach 16 byte alignment.
+			for (; count != 0 && ((uintptr_t)pDst & 15) != 0; --count)
+				*pDst++ = bgra;
+
+			const __m128i value = _mm_set1_epi32((int)bgra);
+
+			for (; count >= 16; count -= 16, pDst += 16)
+			{
+				_mm_store_si128((__m128i*)pDst, value);
+				_mm_store_si128((__m128i*)(pDst + 4), value);
+				_mm_store_si128((__m128i*)(pDst + 8), value);
+				_mm_store_si128((__m128i*)(pDst + 12), value);
+			}
+
+			for (; count >= 4; count -= 4, pDst += 4)
+				_mm_store_si128((__m128i*)pDst, value);
+
+			for (; count != 0; --count)
+				*pDst++ = bgra;
+		}
+
+		CTM_TARGET("sse2") void FillSpanSSE2(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			FillSpanSSE2Inline(pDst, count, bgra);
+		}
+
+		CTM_TARGET("sse2") void FillRectSSE2(uint32_t* pDst, size_t stride, size_t width, size_t height, uint32_t bgra) noexcept
+		{
+			if (stride == width)
+				return FillSpanSSE2Inline(pDst, width * height, bgra);
+
+			for (size_t y = 0; y < height; ++y, pDst += stride)
+				FillSpanSSE2Inline(pDst, width, bgra);
+		}
+
+		// Rounded x / 255 of 16 bit lanes, the same rounding as Div255 for every product of two bytes.
+		CTM_TARGET("sse2") inline __m128i Div255SSE2(__m128i x) noexcept
+		{
+			x = _mm_add_epi16(x, _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+		}
+
+		// Blends two pixels widened to 16 bit lanes. (B, G, R, A per pixel)
+		CTM_TARGET("sse2") inline __m128i BlendOver16SSE2(__m128i dst16, __m128i src16, __m128i opacity16, bool isOpaque) noexcept
+		{
+			if (!isOpaque)
+				src16 = Div255SSE2(_mm_mullo_epi16(src16, opacity16));
+
+			const __m128i alpha16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			const __m128i inverseAlpha16 = _mm_xor_si128(alpha16, _mm_set1_epi16(0xFF));
+
+			return _mm_add_epi16(src16, Div255SSE2(_mm_mullo_epi16(dst16, inverseAlpha16)));
+		}
+
+		CTM_TARGET("sse2") inline __m128i BlendOver4SSE2(__m128i dst, __m128i src, __m128i opacity16, bool isOpaque) noexcept
+		{
+			const __m128i zero = _mm_setzero_si128();
+
+			const __m128i low = BlendOver16SSE2(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(src, zero), opacity16, isOpaque);
+			const __m128i high = BlendOver16SSE2(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(src, zero), opacity16, isOpaque);
+
+			// Saturates to 255, same as the reference.
+			return _mm_packus_epi16(low, high);
+		}
+
+		CTM_TARGET("sse2") void BlendSpanSSE2(uint32_t* pDst, const uint32_t* pSrc, size_t count, unsigned char opacity) noexcept
+		{
+			const __m128i opacity16 = _mm_set1_epi16(opacity);
+			const bool isOpaque = opacity == 255;
+			size_t i = 0;
+
+			// 8 pixels per iteration, as two independent halves.
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i srcLow = _mm_loadu_si128((const __m128i*)(pSrc + i));
+				const __m128i srcHigh = _mm_loadu_si128((const __m128i*)(pSrc + i + 4));
+
+				// Fully transparent sources leave the destination untouched.
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_or_si128(srcLow, srcHigh), _mm_setzero_si128())) == 0xFFFF)
+					continue;
+
+				const __m128i dstLow = _mm_loadu_si128((const __m128i*)(pDst + i));
+				const __m128i dstHigh = _mm_loadu_si128((const __m128i*)(pDst + i + 4));
+
+				_mm_storeu_si128((__m128i*)(pDst + i), BlendOver4SSE2(dstLow, srcLow, opacity16, isOpaque));
+				_mm_storeu_si128((__m128i*)(pDst + i + 4), BlendOver4SSE2(dstHigh, srcHigh, opacity16, isOpaque));
+			}
+
+			for (; i < count; ++i)
+				pDst[i] = BlendOverReference(pDst[i], pSrc[i], opacity);
+		}
+		// SSE2 has no 32-bit multiply keeping the low halves, so even and odd lanes are multiplied separately.
+		CTM_TARGET("sse2") inline __m128i HashStepSSE2(__m128i lanes, __m128i pixels, __m128i multiplier) noexcept
+		{
+			lanes = _mm_xor_si128(lanes, pixels);
+
+			const __m128i even = _mm_mul_epu32(lanes, multiplier);
+			const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lanes, 32), multiplier);
+			lanes = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+
+			return _mm_or_si128(_mm_slli_epi32(lanes, 13), _mm_srli_epi32(lanes, 19));
+		}
+
+		CTM_TARGET("sse2") void HashSpanSSE2(uint32_t* pLanes, const uint32_t* pSrc, size_t count) noexcept
+		{
+			constexpr size_t S_REGISTERS = S_HASH_LANES / 4;
+
+			const __m128i multiplier = _mm_set1_epi32((int)S_HASH_MULTIPLIER);
+			__m128i lanes[S_REGISTERS];
+			size_t i = 0;
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				lanes[r] = _mm_loadu_si128((const __m128i*)(pLanes + r * 4));
+
+			for (; i + S_HASH_LANES <= count; i += S_HASH_LANES)
+				for (size_t r = 0; r < S_REGISTERS; ++r)
+					lanes[r] = HashStepSSE2(lanes[r], _mm_loadu_si128((const __m128i*)(pSrc + i + r * 4)), multiplier);
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				_mm_storeu_si128((__m128i*)(pLanes + r * 4), lanes[r]);
+
+			// i is a multiple of S_HASH_LANES, so the tail starts at lane 0.
+			HashSpanScalar(pLanes, pSrc + i, count - i);
+		}
+		#pragma endregion
+
+		#pragma region AVX2
+		CTM_TARGET("avx2") inline void FillSpanAVX2Inline(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			const __m256i value = _mm256_set1_epi32((int)bgra);
+
+			if (count < 8)
+			{
+				const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+				_mm256_maskstore_epi32((int*)pDst, mask, value);
+				return;
+			}
+
+			uint32_t* const pEnd = pDst + count;
+
+			// Filling is idempotent, so the unaligned head and tail may overlap the aligned body instead of needing scalar loops.
+			_mm256_storeu_si256((__m256i*)pDst, value);
+			pDst = (uint32_t*)(((uintptr_t)pDst + 32) & ~(uintptr_t)31);
+
+			for (; pDst + 32 <= pEnd; pDst += 32)
+			{
+				_mm256_store_si256((__m256i*)pDst, value);
+				_mm256_store_si256((__m256i*)(pDst + 8), value);
+				_mm256_store_si256((__m256i*)(pDst + 16), value);
+				_mm256_store_si256((__m256i*)(pDst + 24), value);
+			}
+
+			for (; pDst + 8 <= pEnd; pDst += 8)
+				_mm256_store_si256((__m256i*)pDst, value);
+
+			_mm256_storeu_si256((__m256i*)(pEnd - 8), value);
+		}
+
+		CTM_TARGET("avx2") void FillSpanAVX2(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			FillSpanAVX2Inline(pDst, count, bgra);
+		}
+
+		CTM_TARGET("avx2") void FillRectAVX2(uint32_t* pDst, size_t stride, size_t width, size_t height, uint32_t bgra) noexcept
+		{
+			if (stride == width)
+				return FillSpanAVX2Inline(pDst, width * height, bgra);
+
+			for (size_t y = 0; y < height; ++y, pDst += stride)
+				FillSpanAVX2Inline(pDst, width, bgra);
+		}
+
+		CTM_TARGET("avx2") inline __m256i Div255AVX2(__m256i x) noexcept
+		{
+			x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+			return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+		}
+
+		CTM_TARGET("avx2") inline __m256i BlendOver16AVX2(__m256i dst16, __m256i src16, __m256i opacity16, bool isOpaque) noexcept
+		{
+			if (!isOpaque)
+				src16 = Div255AVX2(_mm256_mullo_epi16(src16, opacity16));
+
+			const __m256i alpha16 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			const __m256i inverseAlpha16 = _mm256_xor_si256(alpha16, _mm256_set1_epi16(0xFF));
+
+			return _mm256_add_epi16(src16, Div255AVX2(_mm256_mullo_epi16(dst16, inverseAlpha16)));
+		}
+
+		CTM_TARGET("avx2") void BlendSpanAVX2(uint32_t* pDst, const uint32_t* pSrc, size_t count, unsigned char opacity) noexcept
+		{
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+			const __m256i opacity16 = _mm256_set1_epi16(opacity);
+			const bool isOpaque = opacity == 255;
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256i src = _mm256_loadu_si256((const __m256i*)(pSrc + i));
+
+				if (_mm256_testz_si256(src, src))
+					continue;
+
+				// Opaque sources replace the destination, as the reference yields src + dst * 0.
+				if (isOpaque && _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(src, alphaMask), alphaMask)) == -1)
+				{
+					_mm256_storeu_si256((__m256i*)(pDst + i), src);
+					continue;
+				}
+
+				const __m256i dst = _mm256_loadu_si256((const __m256i*)(pDst + i));
+
+				// Unpacking and packing both work per 128 bit lane, so pixels end up back in place.
+				const __m256i low = BlendOver16AVX2(_mm256_unpacklo_epi8(dst, zero), _mm256_unpacklo_epi8(src, zero), opacity16, isOpaque);
+				const __m256i high = BlendOver16AVX2(_mm256_unpackhi_epi8(dst, zero), _mm256_unpackhi_epi8(src, zero), opacity16, isOpaque);
+
+				_mm256_storeu_si256((__m256i*)(pDst + i), _mm256_packus_epi16(low, high));
+			}
+
+			for (; i < count; ++i)
+				pDst[i] = BlendOverReference(pDst[i], pSrc[i], opacity);
+		}
+		CTM_TARGET("avx2") void HashSpanAVX2(uint32_t* pLanes, const uint32_t* pSrc, size_t count) noexcept
+		{
+			constexpr size_t S_REGISTERS = S_HASH_LANES / 8;
+
+			const __m256i multiplier = _mm256_set1_epi32((int)S_HASH_MULTIPLIER);
+			__m256i lanes[S_REGISTERS];
+			size_t i = 0;
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				lanes[r] = _mm256_loadu_si256((const __m256i*)(pLanes + r * 8));
+
+			for (; i + S_HASH_LANES <= count; i += S_HASH_LANES)
+			{
+				for (size_t r = 0; r < S_REGISTERS; ++r)
+				{
+					__m256i lane = _mm256_mullo_epi32(_mm256_xor_si256(lanes[r], _mm256_loadu_si256((const __m256i*)(pSrc + i + r * 8))), multiplier);
+					lanes[r] = _mm256_or_si256(_mm256_slli_epi32(lane, 13), _mm256_srli_epi32(lane, 19));
+				}
+			}
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				_mm256_storeu_si256((__m256i*)(pLanes + r * 8), lanes[r]);
+
+			HashSpanScalar(pLanes, pSrc + i, count - i);
+		}
+		#pragma endregion
+
+		#pragma region AVX512
+		CTM_TARGET("avx512f") inline void FillSpanAVX512Inline(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			const __m512i value = _mm512_set1_epi32((int)bgra);
+
+			if (count < 16)
+			{
+				_mm512_mask_storeu_epi32(pDst, (__mmask16)((1u << count) - 1), value);
+				return;
+			}
+
+			uint32_t* const pEnd = pDst + count;
+
+			_mm512_storeu_si512(pDst, value);
+			pDst = (uint32_t*)(((uintptr_t)pDst + 64) & ~(uintptr_t)63);
+
+			for (; pDst + 64 <= pEnd; pDst += 64)
+			{
+				_mm512_store_si512(pDst, value);
+				_mm512_store_si512(pDst + 16, value);
+				_mm512_store_si512(pDst + 32, value);
+				_mm512_store_si512(pDst + 48, value);
+			}
+
+			for (; pDst + 16 <= pEnd; pDst += 16)
+				_mm512_store_si512(pDst, value);
+
+			_mm512_storeu_si512(pEnd - 16, value);
+		}
+
+		CTM_TARGET("avx512f") void FillSpanAVX512(uint32_t* pDst, size_t count, uint32_t bgra) noexcept
+		{
+			FillSpanAVX512Inline(pDst, count, bgra);
+		}
+
+		CTM_TARGET("avx512f") void FillRectAVX512(uint32_t* pDst, size_t stride, size_t width, size_t height, uint32_t bgra) noexcept
+		{
+			if (stride == width)
+				return FillSpanAVX512Inline(pDst, width * height, bgra);
+
+			for (size_t y = 0; y < height; ++y, pDst += stride)
+				FillSpanAVX512Inline(pDst, width, bgra);
+		}
+
+		CTM_TARGET("avx512f,avx512bw") inline __m512i Div255AVX512(__m512i x) noexcept
+		{
+			x = _mm512_add_epi16(x, _mm512_set1_epi16(128));
+			return _mm512_srli_epi16(_mm512_add_epi16(x, _mm512_srli_epi16(x, 8)), 8);
+		}
+
+		CTM_TARGET("avx512f,avx512bw") inline __m512i BlendOver16AVX512(__m512i dst16, __m512i src16, __m512i opacity16, bool isOpaque) noexcept
+		{
+			if (!isOpaque)
+				src16 = Div255AVX512(_mm512_mullo_epi16(src16, opacity16));
+
+			const __m512i alpha16 = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(src16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			const __m512i inverseAlpha16 = _mm512_xor_si512(alpha16, _mm512_set1_epi16(0xFF));
+
+			return _mm512_add_epi16(src16, Div255AVX512(_mm512_mullo_epi16(dst16, inverseAlpha16)));
+		}
+
+		CTM_TARGET("avx512f,avx512bw") inline void BlendOver16PixelsAVX512(uint32_t* pDst, const uint32_t* pSrc, __mmask16 mask, __m512i opacity16, bool isOpaque) noexcept
+		{
+			const __m512i zero = _mm512_setzero_si512();
+			const __m512i alphaMask = _mm512_set1_epi32((int)0xFF000000);
+
+			const __m512i src = _mm512_maskz_loadu_epi32(mask, pSrc);
+
+			if (_mm512_test_epi32_mask(src, src) == 0)
+				return;
+
+			if (isOpaque && _mm512_mask_cmpeq_epi32_mask(mask, _mm512_and_si512(src, alphaMask), alphaMask) == mask)
+			{
+				_mm512_mask_storeu_epi32(pDst, mask, src);
+				return;
+			}
+
+			const __m512i dst = _mm512_maskz_loadu_epi32(mask, pDst);
+
+			const __m512i low = BlendOver16AVX512(_mm512_unpacklo_epi8(dst, zero), _mm512_unpacklo_epi8(src, zero), opacity16, isOpaque);
+			const __m512i high = BlendOver16AVX512(_mm512_unpackhi_epi8(dst, zero), _mm512_unpackhi_epi8(src, zero), opacity16, isOpaque);
+
+			_mm512_mask_storeu_epi32(pDst, mask, _mm512_packus_epi16(low, high));
+		}
+
+		CTM_TARGET("avx512f,avx512bw") void BlendSpanAVX512(uint32_t* pDst, const uint32_t* pSrc, size_t count, unsigned char opacity) noexcept
+		{
+			const __m512i opacity16 = _mm512_set1_epi16(opacity);
+			const bool isOpaque = opacity == 255;
+			size_t i = 0;
+
+			for (; i + 16 <= count; i += 16)
+				BlendOver16PixelsAVX512(pDst + i, pSrc + i, (__mmask16)0xFFFF, opacity16, isOpaque);
+
+			// Masked loads and stores handle the tail, without touching pixels past the span.
+			if (i < count)
+				BlendOver16PixelsAVX512(pDst + i, pSrc + i, (__mmask16)((1u << (count - i)) - 1), opacity16, isOpaque);
+		}
+
+		CTM_TARGET("avx512f") void HashSpanAVX512(uint32_t* pLanes, const uint32_t* pSrc, size_t count) noexcept
+		{
+			constexpr size_t S_REGISTERS = S_HASH_LANES / 16;
+
+			const __m512i multiplier = _mm512_set1_epi32((int)S_HASH_MULTIPLIER);
+			__m512i lanes[S_REGISTERS];
+			size_t i = 0;
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				lanes[r] = _mm512_loadu_si512(pLanes + r * 16);
+
+			// The masked rotate merges into the lanes themselves, where the unmasked one starts from an undefined register
+			// that GCC warns about. With every lane selected, both are the same instruction.
+			for (; i + S_HASH_LANES <= count; i += S_HASH_LANES)
+				for (size_t r = 0; r < S_REGISTERS; ++r)
+				{
+					const __m512i mixed = _mm512_mullo_epi32(_mm512_xor_si512(lanes[r], _mm512_loadu_si512(pSrc + i + r * 16)), multiplier);
+					lanes[r] = _mm512_mask_rol_epi32(lanes[r], (__mmask16)0xFFFF, mixed, 13);
+				}
+
+			for (size_t r = 0; r < S_REGISTERS; ++r)
+				_mm512_storeu_si512(pLanes + r * 16, lanes[r]);
+
+			HashSpanScalar(pLanes, pSrc + i, count - i);
+		}
+		#pragma endregion
+		#endif
+
+		constexpr SWSpanKernels S_KERNELS[] = {
+			{ SWKernelISA::SCALAR, "Scalar", FillSpanScalar, FillRectScalar, BlendSpanScalar, HashSpanScalar },
+			#ifdef CTM_X86
+			{ SWKernelISA::SSE2, "SSE2", FillSpanSSE2, FillRectSSE2, BlendSpanSSE2, HashSpanSSE2 },
+			{ SWKernelISA::AVX2, "AVX2", FillSpanAVX2, FillRectAVX2, BlendSpanAVX2, HashSpanAVX2 },
+			{ SWKernelISA::AVX512, "AVX-512", FillSpanAVX512, FillRectAVX512, BlendSpanAVX512, HashSpanAVX512 },
+			#endif
+		};
+
+		bool IsSupported(SWKernelISA isa) noexcept
+		{
+			const Core::CpuFeatures& features = Core::DetectCpuFeatures();
+
+			switch (isa)
+			{
+			case SWKernelISA::SCALAR: return true;
+			case SWKernelISA::SSE2:   return features.sse2;
+			case SWKernelISA::AVX2:   return features.avx2;
+			case SWKernelISA::AVX512: return features.avx512f && features.avx512bw;
+			}
+
+			return false;
+		}
+
+		const SWSpanKernels& SelectBest() noexcept
+		{
+			const SWKernelISA preferred[] = { SWKernelISA::AVX512, SWKernelISA::AVX2, SWKernelISA::SSE2 };
+
+			for (SWKernelISA isa : preferred)
+				if (const SWSpanKernels* pKernels = SpanKernels(isa))
+					return *pKernels;
+
+			return S_KERNELS[0];
+		}
+
+		std::atomic<const SWSpanKernels*> s_pActiveKernels = nullptr;
+	}
+
+	const SWSpanKernels& ActiveSpanKernels() noexcept
+	{
+		const SWSpanKernels* pKernels = s_pActiveKernels.load(std::memory_order_acquire);
+
+		if (pKernels == nullptr)
+		{
+			// Racing first calls all select the same kernels, so whichever store lands is fine.
+			pKernels = &SelectBest();
+			s_pActiveKernels.store(pKernels, std::memory_order_release);
+
+			DEBUG_PRINT("Selected " << pKernels->name << " span kernels.\n");
+		}
+
+		return *pKernels;
+	}
+
+	const SWSpanKernels* SpanKernels(SWKernelISA isa) noexcept
+	{
+		for (const SWSpanKernels& kernels : S_KERNELS)
+			if (kernels.isa == isa)
+				return IsSupported(isa) ? &kernels : nullptr;
+
+		return nullptr;
+	}
+
+	bool SelectSpanKernels(SWKernelISA isa) noexcept
+	{
+		const SWSpanKernels* pKernels = SpanKernels(isa);
+
+		if (pKernels == nullptr)
+			return false;
+
+		s_pActiveKernels.store(pKernels, std::memory_order_release);
+		return true;
+	}
+}
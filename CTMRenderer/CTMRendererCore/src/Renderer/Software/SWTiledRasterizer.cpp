@@ -0,0 +1,163 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/Software/SWTiledRasterizer.hpp"
+#include "CTMRenderer/Timer.hpp"
+#include "Threading/ParallelFor.hpp"
+
+namespace CTMRenderer::CTMSoftware
+{
+	namespace
+	{
+		// Below this many instances per chunk, binning costs more in scheduling than it saves.
+		constexpr size_t S_MIN_INSTANCES_PER_BIN_JOB = 2048;
+
+		// Chunks per thread, so threads finishing early can pick up the remaining chunks.
+		constexpr size_t S_BIN_JOBS_PER_THREAD = 4;
+	}
+
+	SWTiledRasterizer::SWTiledRasterizer(const SWRasterizer& rasterizerRef, unsigned int tileSize) noexcept
+		: m_RasterizerRef(rasterizerRef), m_TileSize(tileSize)
+	{
+		RUNTIME_ASSERT(tileSize != 0, "Tile size cannot be zero.\n");
+	}
+
+	#pragma region Public API
+	void SWTiledRasterizer::Draw(Threading::WorkerPool& pool, SWFramebuffer& target, uint32_t clearBgra, const CTMDirectX::Graphics::InstanceData* pInstances, size_t count) noexcept
+	{
+		RUNTIME_ASSERT(pInstances != nullptr || count == 0, "Instances are nullptr.\n");
+
+		Timer::Timer timer;
+
+		const size_t threadCount = (size_t)pool.ThreadCount() + 1;
+		const size_t binJobs = std::clamp<size_t>(count / S_MIN_INSTANCES_PER_BIN_JOB, 1, threadCount * S_BIN_JOBS_PER_THREAD);
+		const size_t instancesPerJob = (count + binJobs - 1) / binJobs;
+
+		Resize(target.Width(), target.Height(), binJobs);
+
+		Threading::ParallelFor(pool, binJobs, [&](size_t job) {
+			const size_t first = std::min(job * instancesPerJob, count);
+			const size_t last = std::min(first + instancesPerJob, count);
+
+			BinChunk(job, target.Width(), target.Height(), pInstances, first, last);
+		});
+
+		m_Stats.binMillis = timer.ElapsedMillis();
+		timer.Reset();
+
+		Threading::ParallelFor(pool, m_TileCount, [&](size_t tile) { RasterTile(tile, target, clearBgra); });
+
+		m_Stats.rasterMillis = timer.ElapsedMillis();
+		m_Stats.binJobs = binJobs;
+		m_Stats.tiles = m_TileCount;
+		m_Stats.binnedRects = 0;
+		m_Stats.occludedRects = 0;
+
+		// Bins past this frame's jobs and tiles are only kept for their capacity, and may hold stale rects.
+		for (size_t bin = 0; bin < m_BinJobs * m_TileCount; ++bin)
+			m_Stats.binnedRects += m_Bins[bin].size();
+		for (size_t occluded : m_OccludedPerTile)
+			m_Stats.occludedRects += occluded;
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	void SWTiledRasterizer::Resize(unsigned int targetWidth, unsigned int targetHeight, size_t binJobs) noexcept
+	{
+		m_TilesX = (targetWidth + m_TileSize - 1) / m_TileSize;
+		m_TilesY = (targetHeight + m_TileSize - 1) / m_TileSize;
+		m_TileCount = (size_t)m_TilesX * m_TilesY;
+		m_BinJobs = binJobs;
+
+		// Only grown, so a stable frame setup keeps every bin's capacity.
+		if (m_Bins.size() < m_BinJobs * m_TileCount)
+			m_Bins.resize(m_BinJobs * m_TileCount);
+
+		m_OccludedPerTile.assign(m_TileCount, 0);
+	}
+
+	void SWTiledRasterizer::BinChunk(size_t job, unsigned int targetWidth, unsigned int targetHeight, const CTMDirectX::Graphics::InstanceData* pInstances, size_t first, size_t last) noexcept
+	{
+		for (size_t tile = 0; tile < m_TileCount; ++tile)
+			Bin(job, tile).clear();
+
+		for (size_t i = first; i < last; ++i)
+		{
+			const SWPixelRect rect = m_RasterizerRef.PixelBounds(pInstances[i], targetWidth, targetHeight);
+
+			if (rect.IsEmpty())
+				continue;
+
+			const BinnedRect binned = { rect, PackBGRA8(pInstances[i].color) };
+
+			const unsigned int firstTileX = (unsigned int)rect.left / m_TileSize;
+			const unsigned int lastTileX = (unsigned int)(rect.right - 1) / m_TileSize;
+			const unsigned int firstTileY = (unsigned int)rect.top / m_TileSize;
+			const unsigned int lastTileY = (unsigned int)(rect.bottom - 1) / m_TileSize;
+
+			for (unsigned int tileY = firstTileY; tileY <= lastTileY; ++tileY)
+				for (unsigned int tileX = firstTileX; tileX <= lastTileX; ++tileX)
+					Bin(job, (size_t)tileY * m_TilesX + tileX).emplace_back(binned);
+		}
+	}
+
+	void SWTiledRasterizer::RasterTile(size_t tile, SWFramebuffer& target, uint32_t clearBgra) noexcept
+	{
+		SWPixelRect tileRect;
+		tileRect.left = (int)((tile % m_TilesX) * m_TileSize);
+		tileRect.top = (int)((tile / m_TilesX) * m_TileSize);
+		tileRect.right = std::min(tileRect.left + (int)m_TileSize, (int)target.Width());
+		tileRect.bottom = std::min(tileRect.top + (int)m_TileSize, (int)target.Height());
+
+		auto coversTile = [&tileRect](const SWPixelRect& rect) {
+			return rect.left <= tileRect.left && rect.top <= tileRect.top && rect.right >= tileRect.right && rect.bottom >= tileRect.bottom;
+		};
+
+		// Everything drawn before the last rect covering the whole tile is overdrawn, the clear included.
+		size_t startJob = 0, startIndex = 0;
+		bool isCovered = false;
+
+		for (size_t job = m_BinJobs; job-- > 0 && !isCovered;)
+		{
+			const std::vector<BinnedRect>& bin = Bin(job, tile);
+
+			for (size_t i = bin.size(); i-- > 0;)
+			{
+				if (coversTile(bin[i].rect))
+				{
+					startJob = job;
+					startIndex = i;
+					isCovered = true;
+					break;
+				}
+			}
+		}
+
+		if (isCovered)
+		{
+			size_t occluded = startIndex;
+			for (size_t job = 0; job < startJob; ++job)
+				occluded += Bin(job, tile).size();
+
+			m_OccludedPerTile[tile] = occluded;
+		}
+		else
+			FillRect(target, tileRect, clearBgra);
+
+		for (size_t job = startJob; job < m_BinJobs; ++job)
+		{
+			const std::vector<BinnedRect>& bin = Bin(job, tile);
+
+			for (size_t i = job == startJob ? startIndex : 0; i < bin.size(); ++i)
+			{
+				SWPixelRect clipped;
+				clipped.left = std::max(bin[i].rect.left, tileRect.left);
+				clipped.top = std::max(bin[i].rect.top, tileRect.top);
+				clipped.right = std::min(bin[i].rect.right, tileRect.right);
+				clipped.bottom = std::min(bin[i].rect.bottom, tileRect.bottom);
+
+				FillRect(target, clipped, bin[i].bgra);
+			}
+		}
+	}
+	#pragma endregion
+}
@@ -0,0 +1,198 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "CTMRenderer/SpatialGrid.hpp"
+
+namespace CTMRenderer
+{
+	namespace
+	{
+		template <typename CellEntryTy>
+		void EraseSlot(std::vector<CellEntryTy>& cell, uint32_t slot) noexcept
+		{
+			for (size_t i = 0; i < cell.size(); ++i)
+			{
+				if (cell[i].handle.slot == slot)
+				{
+					cell[i] = cell.back();
+					cell.pop_back();
+					return;
+				}
+			}
+
+			RUNTIME_ASSERT(false, "Shape is missing from a cell it covers.\n");
+		}
+	}
+
+	SpatialGrid::SpatialGrid(float width, float height, float cellSize) noexcept
+		: m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize)
+	{
+		RUNTIME_ASSERT(width > 0 && height > 0, "Grid area cannot be empty.\n");
+		RUNTIME_ASSERT(cellSize > 0, "Cell size must be greater than 0.\n");
+
+		m_CellsX = std::max((int)std::ceil(width / cellSize), 1);
+		m_CellsY = std::max((int)std::ceil(height / cellSize), 1);
+		m_Cells.resize((size_t)m_CellsX * m_CellsY);
+	}
+
+	#pragma region Public API
+	void SpatialGrid::Insert(ShapeHandle handle, float left, float top, float right, float bottom) noexcept
+	{
+		RUNTIME_ASSERT(right > left, "Right X position must be larger than left X position.\n");
+		RUNTIME_ASSERT(bottom > top, "Bottom Y position must be larger than top Y position.\n");
+		RUNTIME_ASSERT(!Contains(handle), "Shape is already in the grid.\n");
+
+		if (m_Entries.size() <= handle.slot)
+			m_Entries.resize((size_t)handle.slot + 1);
+
+		Entry& entry = m_Entries[handle.slot];
+		RUNTIME_ASSERT(!entry.isPresent, "Another shape of the same slot is still in the grid.\n");
+
+		entry.handle = handle;
+		entry.cells = Cells(left, top, right, bottom);
+		entry.isPresent = true;
+
+		const CellEntry cellEntry = { left, top, right, bottom, handle };
+
+		for (int y = entry.cells.firstY; y <= entry.cells.lastY; ++y)
+			for (int x = entry.cells.firstX; x <= entry.cells.lastX; ++x)
+				Cell(x, y).push_back(cellEntry);
+
+		++m_Size;
+	}
+
+	void SpatialGrid::Insert(ShapeHandle handle, const CTMDirectX::Graphics::Geometry::DXAABB& aabb) noexcept
+	{
+		Insert(handle, aabb.left, aabb.top, aabb.right, aabb.bottom);
+	}
+
+	bool SpatialGrid::Update(ShapeHandle handle, float left, float top, float right, float bottom) noexcept
+	{
+		RUNTIME_ASSERT(right > left, "Right X position must be larger than left X position.\n");
+		RUNTIME_ASSERT(bottom > top, "Bottom Y position must be larger than top Y position.\n");
+
+		if (!Contains(handle))
+			return false;
+
+		Entry& entry = m_Entries[handle.slot];
+		const CellRange oldCells = entry.cells;
+		const CellRange newCells = Cells(left, top, right, bottom);
+		const CellEntry cellEntry = { left, top, right, bottom, handle };
+
+		auto covers = [](const CellRange& cells, int x, int y) {
+			return x >= cells.firstX && x <= cells.lastX && y >= cells.firstY && y <= cells.lastY;
+		};
+
+		// Walks both ranges at once, so cells the shape stays in are rewritten in place instead of being left and re-entered.
+		const int firstX = std::min(oldCells.firstX, newCells.firstX), lastX = std::max(oldCells.lastX, newCells.lastX);
+		const int firstY = std::min(oldCells.firstY, newCells.firstY), lastY = std::max(oldCells.lastY, newCells.lastY);
+
+		for (int y = firstY; y <= lastY; ++y)
+		{
+			for (int x = firstX; x <= lastX; ++x)
+			{
+				const bool wasCovered = covers(oldCells, x, y);
+				const bool isCovered = covers(newCells, x, y);
+
+				if (wasCovered && isCovered)
+				{
+					for (CellEntry& existing : Cell(x, y))
+					{
+						if (existing.handle.slot == handle.slot)
+						{
+							existing = cellEntry;
+							break;
+						}
+					}
+				}
+				else if (wasCovered)
+					EraseSlot(Cell(x, y), handle.slot);
+				else if (isCovered)
+					Cell(x, y).push_back(cellEntry);
+			}
+		}
+
+		entry.cells = newCells;
+		return true;
+	}
+
+	bool SpatialGrid::Remove(ShapeHandle handle) noexcept
+	{
+		if (!Contains(handle))
+			return false;
+
+		Entry& entry = m_Entries[handle.slot];
+
+		for (int y = entry.cells.firstY; y <= entry.cells.lastY; ++y)
+			for (int x = entry.cells.firstX; x <= entry.cells.lastX; ++x)
+				EraseSlot(Cell(x, y), handle.slot);
+
+		entry.isPresent = false;
+		--m_Size;
+
+		return true;
+	}
+
+	void SpatialGrid::Clear() noexcept
+	{
+		for (std::vector<CellEntry>& cell : m_Cells)
+			cell.clear();
+
+		m_Entries.clear();
+		m_Size = 0;
+	}
+
+	size_t SpatialGrid::QueryPoint(float x, float y, std::vector<ShapeHandle>& hits) const noexcept
+	{
+		const size_t firstHit = hits.size();
+
+		for (const CellEntry& cellEntry : Cell(CellX(x), CellY(y)))
+			if (x >= cellEntry.left && x < cellEntry.right && y >= cellEntry.top && y < cellEntry.bottom)
+				hits.push_back(cellEntry.handle);
+
+		return hits.size() - firstHit;
+	}
+
+	size_t SpatialGrid::QueryRect(float left, float top, float right, float bottom, std::vector<ShapeHandle>& hits) const noexcept
+	{
+		const size_t firstHit = hits.size();
+		const CellRange cells = Cells(left, top, right, bottom);
+
+		for (int y = cells.firstY; y <= cells.lastY; ++y)
+		{
+			for (int x = cells.firstX; x <= cells.lastX; ++x)
+			{
+				for (const CellEntry& cellEntry : Cell(x, y))
+				{
+					if (cellEntry.left >= right || cellEntry.right <= left || cellEntry.top >= bottom || cellEntry.bottom <= top)
+						continue;
+
+					// A shape covering several of the cells is only reported from the one holding the top left corner of its overlap with the rect.
+					if (CellX(std::max(left, cellEntry.left)) == x && CellY(std::max(top, cellEntry.top)) == y)
+						hits.push_back(cellEntry.handle);
+				}
+			}
+		}
+
+		return hits.size() - firstHit;
+	}
+	#pragma endregion
+
+	#pragma region Private Functions
+	int SpatialGrid::CellX(float x) const noexcept
+	{
+		return (int)std::clamp(std::floor(x * m_InverseCellSize), 0.0f, (float)(m_CellsX - 1));
+	}
+
+	int SpatialGrid::CellY(float y) const noexcept
+	{
+		return (int)std::clamp(std::floor(y * m_InverseCellSize), 0.0f, (float)(m_CellsY - 1));
+	}
+
+	SpatialGrid::CellRange SpatialGrid::Cells(float left, float top, float right, float bottom) const noexcept
+	{
+		// A right or bottom edge exactly on a cell boundary also covers the next cell. That costs an entry, but keeps
+		// every cell a point inside the shape can map to covered, however the division rounds.
+		return { CellX(left), CellY(top), CellX(right), CellY(bottom) };
+	}
+	#pragma endregion
+}
@@ -0,0 +1,65 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Threading/ParallelFor.hpp"
+
+namespace CTMRenderer::Threading
+{
+	namespace
+	{
+		// Shared with the helper tasks, which may only start after the call already returned.
+		struct ParallelForState
+		{
+			const std::function<void(size_t)>* pFunc = nullptr; // Only dereferenced while items remain, so never dangling.
+			size_t count = 0;
+			std::atomic<size_t> nextIndex = 0;
+			std::atomic<size_t> completedCount = 0;
+			std::mutex mutex;
+			std::condition_variable cv;
+		};
+
+		void Drain(ParallelForState& state) noexcept
+		{
+			size_t completed = 0;
+
+			for (size_t i = state.nextIndex.fetch_add(1, std::memory_order_relaxed); i < state.count; i = state.nextIndex.fetch_add(1, std::memory_order_relaxed))
+			{
+				(*state.pFunc)(i);
+				++completed;
+			}
+
+			if (completed != 0 && state.completedCount.fetch_add(completed, std::memory_order_acq_rel) + completed == state.count)
+			{
+				std::lock_guard<std::mutex> lock(state.mutex);
+				state.cv.notify_all();
+			}
+		}
+	}
+
+	void ParallelFor(WorkerPool& pool, size_t count, const std::function<void(size_t)>& func) noexcept
+	{
+		RUNTIME_ASSERT(func != nullptr, "ParallelFor function is empty.\n");
+
+		if (count == 0)
+			return;
+
+		if (count == 1)
+		{
+			func(0);
+			return;
+		}
+
+		std::shared_ptr<ParallelForState> pState = std::make_shared<ParallelForState>();
+		pState->pFunc = &func;
+		pState->count = count;
+
+		// The caller takes items as well, so one helper less than items is enough.
+		const size_t helperCount = std::min<size_t>(pool.ThreadCount(), count - 1);
+		for (size_t i = 0; i < helperCount; ++i)
+			pool.Submit([pState] { Drain(*pState); });
+
+		Drain(*pState);
+
+		std::unique_lock<std::mutex> lock(pState->mutex);
+		pState->cv.wait(lock, [&pState] { return pState->completedCount.load(std::memory_order_acquire) == pState->count; });
+	}
+}
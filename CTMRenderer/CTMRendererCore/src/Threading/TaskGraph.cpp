@@ -0,0 +1,124 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Threading/TaskGraph.hpp"
+
+namespace CTMRenderer::Threading
+{
+	TaskID TaskGraph::Add(std::string_view name, std::function<void()> func, std::initializer_list<TaskID> dependencies, TaskAffinity affinity) noexcept
+	{
+		return AddTask(name, std::move(func), dependencies.begin(), dependencies.size(), affinity);
+	}
+
+	TaskID TaskGraph::Add(std::string_view name, std::function<void()> func, const std::vector<TaskID>& dependencies, TaskAffinity affinity) noexcept
+	{
+		return AddTask(name, std::move(func), dependencies.data(), dependencies.size(), affinity);
+	}
+
+	void TaskGraph::Run(WorkerPool& pool) noexcept
+	{
+		RUNTIME_ASSERT(!m_HasRun, "A task graph can only be run once.\n");
+		m_HasRun = true;
+
+		m_RunTimer.Reset();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		for (TaskID id = 0; id < m_Tasks.size(); ++id)
+		{
+			m_Tasks[id].remainingDependencies = m_Tasks[id].dependencyCount;
+
+			if (m_Tasks[id].dependencyCount == 0)
+				Schedule(id, pool);
+		}
+
+		// Run caller tasks as they become ready, until everything finished.
+		while (m_CompletedTasks < m_Tasks.size())
+		{
+			m_CV.wait(lock, [this] { return !m_CallerQueue.empty() || m_CompletedTasks == m_Tasks.size(); });
+
+			while (!m_CallerQueue.empty())
+			{
+				const TaskID id = m_CallerQueue.front();
+				m_CallerQueue.pop_front();
+
+				lock.unlock();
+				Execute(id, pool);
+				lock.lock();
+			}
+		}
+
+		m_TotalMillis = m_RunTimer.ElapsedMillis();
+	}
+
+	void TaskGraph::PrintTimeline(std::ostream& stream) const noexcept
+	{
+		stream << "Task timeline (" << m_TotalMillis << "ms total) :\n";
+
+		for (const TaskRecord& record : m_Timeline)
+		{
+			stream << "  " << record.name << " : " << record.startMillis << "ms -> " << record.endMillis << "ms ("
+				<< (record.endMillis - record.startMillis) << "ms) on ";
+
+			if (record.workerIndex < 0)
+				stream << "caller\n";
+			else
+				stream << "worker " << record.workerIndex << '\n';
+		}
+	}
+
+	TaskID TaskGraph::AddTask(std::string_view name, std::function<void()> func, const TaskID* pDependencies, size_t dependencyCount, TaskAffinity affinity) noexcept
+	{
+		RUNTIME_ASSERT(!m_HasRun, "Tasks can't be added to a graph that already ran.\n");
+		RUNTIME_ASSERT(func != nullptr, "Task function is empty.\n");
+
+		const TaskID id = m_Tasks.size();
+
+		Task& task = m_Tasks.emplace_back();
+		task.func = std::move(func);
+		task.affinity = affinity;
+		task.dependencyCount = (unsigned int)dependencyCount;
+
+		for (size_t i = 0; i < dependencyCount; ++i)
+		{
+			const TaskID dependency = pDependencies[i];
+
+			RUNTIME_ASSERT(dependency < id, "Tasks can only depend on previously added tasks.\n");
+			m_Tasks[dependency].dependents.emplace_back(id);
+		}
+
+		m_Timeline.emplace_back().name = name;
+		return id;
+	}
+
+	void TaskGraph::Schedule(TaskID id, WorkerPool& pool) noexcept
+	{
+		if (m_Tasks[id].affinity == TaskAffinity::CALLER)
+		{
+			m_CallerQueue.emplace_back(id);
+			m_CV.notify_one();
+		}
+		else
+			pool.Submit([this, id, &pool] { Execute(id, pool); });
+	}
+
+	void TaskGraph::Execute(TaskID id, WorkerPool& pool) noexcept
+	{
+		// Each task only ever writes its own record, so the timeline needs no locking.
+		TaskRecord& record = m_Timeline[id];
+		record.workerIndex = WorkerPool::CurrentWorkerIndex();
+		record.startMillis = m_RunTimer.ElapsedMillis();
+
+		m_Tasks[id].func();
+
+		record.endMillis = m_RunTimer.ElapsedMillis();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		for (TaskID dependent : m_Tasks[id].dependents)
+			if (--m_Tasks[dependent].remainingDependencies == 0)
+				Schedule(dependent, pool);
+
+		++m_CompletedTasks;
+		m_CV.notify_all();
+	}
+}
@@ -0,0 +1,266 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Threading/ThreadConfig.hpp"
+#include "Threading/WorkerPool.hpp"
+
+#if defined(_WIN32)
+#include <processthreadsapi.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <fstream>
+#endif
+
+#include <charconv>
+
+namespace CTMRenderer::Threading
+{
+#pragma region Platform
+#if defined(_WIN32)
+	static void SetCurrentThreadName(const std::string& name) noexcept
+	{
+		// Thread names are plain ASCII, a direct widen is enough.
+		const std::wstring wideName(name.begin(), name.end());
+
+		if (FAILED(SetThreadDescription(GetCurrentThread(), wideName.c_str())))
+			DEBUG_PRINT_ERROR("Failed to set the name of thread " << name << ".\n");
+	}
+
+	static void SetCurrentThreadCores(const std::vector<unsigned int>& cores) noexcept
+	{
+		// A thread can only run in a single processor group of 64 cores, the group of the first core is used.
+		GROUP_AFFINITY groupAffinity = {};
+		groupAffinity.Group = (WORD)(cores.front() / 64);
+
+		for (unsigned int core : cores)
+		{
+			if (core / 64 == groupAffinity.Group)
+				groupAffinity.Mask |= (KAFFINITY)1 << (core % 64);
+			else
+				DEBUG_PRINT_ERROR("Core " << core << " is outside of processor group " << groupAffinity.Group << " and is ignored.\n");
+		}
+
+		if (!SetThreadGroupAffinity(GetCurrentThread(), &groupAffinity, nullptr))
+			DEBUG_PRINT_ERROR("Failed to set thread affinity.\n");
+	}
+
+	static void SetCurrentThreadPriority(ThreadPriority priority) noexcept
+	{
+		int winPriority = THREAD_PRIORITY_NORMAL;
+
+		switch (priority)
+		{
+		case ThreadPriority::LOWEST:        winPriority = THREAD_PRIORITY_LOWEST; break;
+		case ThreadPriority::BELOW_NORMAL:  winPriority = THREAD_PRIORITY_BELOW_NORMAL; break;
+		case ThreadPriority::NORMAL:        winPriority = THREAD_PRIORITY_NORMAL; break;
+		case ThreadPriority::ABOVE_NORMAL:  winPriority = THREAD_PRIORITY_ABOVE_NORMAL; break;
+		case ThreadPriority::HIGHEST:       winPriority = THREAD_PRIORITY_HIGHEST; break;
+		case ThreadPriority::TIME_CRITICAL: winPriority = THREAD_PRIORITY_TIME_CRITICAL; break;
+		}
+
+		if (!SetThreadPriority(GetCurrentThread(), winPriority))
+			DEBUG_PRINT_ERROR("Failed to set thread priority.\n");
+	}
+
+	unsigned int NumaNodeCount() noexcept
+	{
+		ULONG highestNode = 0;
+
+		return GetNumaHighestNodeNumber(&highestNode) ? (unsigned int)highestNode + 1 : 1;
+	}
+
+	std::vector<unsigned int> CoresOfNumaNode(unsigned int node) noexcept
+	{
+		std::vector<unsigned int> cores;
+		GROUP_AFFINITY groupAffinity = {};
+
+		if (!GetNumaNodeProcessorMaskEx((USHORT)node, &groupAffinity))
+			return cores;
+
+		for (unsigned int bit = 0; bit < 64; ++bit)
+			if (groupAffinity.Mask & ((KAFFINITY)1 << bit))
+				cores.emplace_back(groupAffinity.Group * 64u + bit);
+
+		return cores;
+	}
+#elif defined(__linux__)
+	static void SetCurrentThreadName(const std::string& name) noexcept
+	{
+		// Linux limits thread names to 15 characters.
+		const std::string shortName = name.substr(0, 15);
+
+		if (pthread_setname_np(pthread_self(), shortName.c_str()) != 0)
+			DEBUG_PRINT_ERROR("Failed to set the name of thread " << name << ".\n");
+	}
+
+	static void SetCurrentThreadCores(const std::vector<unsigned int>& cores) noexcept
+	{
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (unsigned int core : cores)
+			if (core < CPU_SETSIZE)
+				CPU_SET(core, &cpuSet);
+
+		if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+			DEBUG_PRINT_ERROR("Failed to set thread affinity.\n");
+	}
+
+	static void SetCurrentThreadPriority(ThreadPriority priority) noexcept
+	{
+		// The default scheduler only knows per-thread nice values. Raising priority requires CAP_SYS_NICE.
+		int niceValue = 0;
+
+		switch (priority)
+		{
+		case ThreadPriority::LOWEST:        niceValue = 10; break;
+		case ThreadPriority::BELOW_NORMAL:  niceValue = 5; break;
+		case ThreadPriority::NORMAL:        niceValue = 0; break;
+		case ThreadPriority::ABOVE_NORMAL:  niceValue = -5; break;
+		case ThreadPriority::HIGHEST:       niceValue = -10; break;
+		case ThreadPriority::TIME_CRITICAL: niceValue = -20; break;
+		}
+
+		if (setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), niceValue) != 0)
+			DEBUG_PRINT_ERROR("Failed to set thread priority (nice " << niceValue << ").\n");
+	}
+
+	unsigned int NumaNodeCount() noexcept
+	{
+		return NumaNodeCount("/sys/devices/system/node");
+	}
+
+	std::vector<unsigned int> CoresOfNumaNode(unsigned int node) noexcept
+	{
+		std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+		std::string list;
+
+		if (!std::getline(file, list))
+			return {};
+
+		// Cores a cpu_set_t can't hold are dropped.
+		return ParseCpuList(list, (unsigned int)CPU_SETSIZE - 1);
+	}
+#else
+	static void SetCurrentThreadName(const std::string&) noexcept {}
+	static void SetCurrentThreadCores(const std::vector<unsigned int>&) noexcept {}
+	static void SetCurrentThreadPriority(ThreadPriority) noexcept {}
+
+	unsigned int NumaNodeCount() noexcept { return 1; }
+	std::vector<unsigned int> CoresOfNumaNode(unsigned int) noexcept { return {}; }
+#endif
+#pragma endregion
+
+	unsigned int NumaNodeCount(const std::filesystem::path& nodeDirectory) noexcept
+	{
+		unsigned int nodeCount = 0;
+
+		std::error_code error;
+
+		while (std::filesystem::exists(nodeDirectory / ("node" + std::to_string(nodeCount)), error))
+			++nodeCount;
+
+		return nodeCount != 0 ? nodeCount : 1;
+	}
+
+	std::vector<unsigned int> ParseCpuList(std::string_view list, unsigned int maxCore) noexcept
+	{
+		// Parses a whole entry as a number, rejecting empty, partial or out of range text.
+		auto parseCore = [](std::string_view text, unsigned int& core) {
+			const char* pEnd = text.data() + text.size();
+			const std::from_chars_result result = std::from_chars(text.data(), pEnd, core);
+
+			return !text.empty() && result.ec == std::errc() && result.ptr == pEnd;
+		};
+
+		std::vector<unsigned int> cores;
+		size_t position = 0;
+
+		while (position < list.size())
+		{
+			size_t end = list.find(',', position);
+			if (end == std::string_view::npos)
+				end = list.size();
+
+			const std::string_view range = list.substr(position, end - position);
+			const size_t dash = range.find('-');
+			position = end + 1;
+
+			unsigned int first = 0, last = 0;
+
+			if (!parseCore(range.substr(0, dash), first))
+				continue;
+
+			if (dash == std::string_view::npos)
+				last = first;
+			else if (!parseCore(range.substr(dash + 1), last))
+				continue;
+
+			last = std::min(last, maxCore);
+			if (first > last)
+				continue;
+
+			// Stops on the last core rather than past it, which wouldn't exist for UINT_MAX.
+			for (unsigned int core = first;; ++core)
+			{
+				cores.emplace_back(core);
+
+				if (core == last)
+					break;
+			}
+		}
+
+		return cores;
+	}
+
+	void ApplyThreadPlacement(const ThreadPlacement& placement, int index) noexcept
+	{
+		if (!placement.Name.empty())
+			SetCurrentThreadName(index >= 0 ? placement.Name + ' ' + std::to_string(index) : placement.Name);
+
+		std::vector<unsigned int> cores = ResolveCores(placement);
+
+		if (!cores.empty())
+		{
+			if (placement.PinEachToOneCore && index >= 0)
+				cores = { cores[(size_t)index % cores.size()] };
+
+			SetCurrentThreadCores(cores);
+		}
+
+		if (placement.Priority != ThreadPriority::NORMAL)
+			SetCurrentThreadPriority(placement.Priority);
+	}
+
+	std::vector<unsigned int> ResolveCores(const ThreadPlacement& placement) noexcept
+	{
+		if (!placement.Cores.empty())
+			return placement.Cores;
+
+		if (placement.NumaNode >= 0)
+		{
+			std::vector<unsigned int> cores = CoresOfNumaNode((unsigned int)placement.NumaNode);
+
+			if (cores.empty())
+				DEBUG_PRINT_ERROR("NUMA node " << placement.NumaNode << " has no cores, placement is left to the OS.\n");
+
+			return cores;
+		}
+
+		return {};
+	}
+
+	unsigned int ResolveWorkerCount(const ThreadTopology& topology) noexcept
+	{
+		if (topology.WorkerCount != 0)
+			return topology.WorkerCount;
+
+		// Without an explicit count, a pool restricted to a core set gets one worker per core.
+		const std::vector<unsigned int> cores = ResolveCores(topology.Workers);
+
+		return cores.empty() ? WorkerPool::DefaultThreadCount() : (unsigned int)cores.size();
+	}
+}
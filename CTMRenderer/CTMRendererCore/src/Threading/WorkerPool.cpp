@@ -0,0 +1,85 @@
+#include "Core/CorePCH.hpp"
+#include "Core/CoreMacros.hpp"
+#include "Threading/WorkerPool.hpp"
+
+namespace CTMRenderer::Threading
+{
+	static thread_local int t_WorkerIndex = -1;
+
+	WorkerPool::WorkerPool(unsigned int threadCount, ThreadPlacement placement) noexcept
+		: m_Placement(std::move(placement))
+	{
+		RUNTIME_ASSERT(threadCount != 0, "A worker pool needs at least one thread.\n");
+
+		m_Threads.reserve(threadCount);
+		for (unsigned int i = 0; i < threadCount; ++i)
+			m_Threads.emplace_back(&WorkerPool::WorkerLoop, this, i);
+	}
+
+	WorkerPool::WorkerPool(const ThreadTopology& topology) noexcept
+		: WorkerPool(ResolveWorkerCount(topology), topology.Workers)
+	{
+	}
+
+	WorkerPool::~WorkerPool() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_ShouldRun = false;
+		}
+
+		m_CV.notify_all();
+
+		for (std::thread& thread : m_Threads)
+			thread.join();
+	}
+
+	void WorkerPool::Submit(std::function<void()> task) noexcept
+	{
+		RUNTIME_ASSERT(task != nullptr, "Submitted task is empty.\n");
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Tasks.emplace_back(std::move(task));
+		}
+
+		m_CV.notify_one();
+	}
+
+	unsigned int WorkerPool::DefaultThreadCount() noexcept
+	{
+		const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	int WorkerPool::CurrentWorkerIndex() noexcept
+	{
+		return t_WorkerIndex;
+	}
+
+	void WorkerPool::WorkerLoop(unsigned int workerIndex) noexcept
+	{
+		t_WorkerIndex = (int)workerIndex;
+		ApplyThreadPlacement(m_Placement, (int)workerIndex);
+
+		while (true)
+		{
+			std::function<void()> task;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_CV.wait(lock, [this] { return !m_Tasks.empty() || !m_ShouldRun; });
+
+				// Drain remaining tasks before shutting down.
+				if (m_Tasks.empty())
+					return;
+
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
@@ -23,6 +23,11 @@ workspace "CTMRenderer"
 		optimize "On"
 	filter{} -- clear filters
 
+	-- Linux builds are headless. (CTM_NULL backend only)
+	filter "system:linux"
+		defines { "CTM_NO_DX" }
+	filter{} -- clear filters
+
 	project "CTMRendererApp"
 		locationdir = "CTMRenderer/CTMRendererApp/"
 
@@ -32,8 +37,35 @@ workspace "CTMRenderer"
 		files { locationdir .. "src/**.cpp", locationdir .. "include/**.hpp" }
 		includedirs { locationdir .. "include/" }
 
-		links { "CTMRendererCore.lib" }
-		libdirs { "bin/out/" .. outputdir .. "/CTMRendererCore/" }
+		filter "system:windows"
+			links { "CTMRendererCore.lib" }
+			libdirs { "bin/out/" .. outputdir .. "/CTMRendererCore/" }
+		filter{} -- clear filters.
+
+		filter "system:linux"
+			links { "CTMRendererCore", "pthread" }
+		filter{} -- clear filters.
+
+		dependson { "CTMRendererCore" }
+		includedirs { "CTMRenderer/CTMRendererCore/include" }
+
+	project "CTMRendererBench"
+		locationdir = "CTMRenderer/CTMRendererBench/"
+
+		location (locationdir)
+		kind "ConsoleApp" -- Set the subsystem as a console application.
+
+		files { locationdir .. "src/**.cpp", locationdir .. "include/**.hpp" }
+		includedirs { locationdir .. "include/" }
+
+		filter "system:windows"
+			links { "CTMRendererCore.lib" }
+			libdirs { "bin/out/" .. outputdir .. "/CTMRendererCore/" }
+		filter{} -- clear filters.
+
+		filter "system:linux"
+			links { "CTMRendererCore", "pthread" }
+		filter{} -- clear filters.
 
 		dependson { "CTMRendererCore" }
 		includedirs { "CTMRenderer/CTMRendererCore/include" }
@@ -65,6 +97,16 @@ workspace "CTMRenderer"
 
 		includedirs { locationdir .. "include/" }
 
+		-- Everything using Win32 or Direct3D. (The geometry helpers are shared with the other backends)
+		filter "system:linux"
+			removefiles {
+				locationdir .. "src/Renderer/DirectX/*.cpp",
+				locationdir .. "src/Renderer/DirectX/Window/**.cpp",
+				locationdir .. "src/Renderer/DirectX/Graphics/*.cpp",
+				shaderdir .. "/**.hlsl"
+			}
+		filter{} -- clear filters.
+
 		-- These are currently included via #pragma comment's. in RendererCore.hpp.
 		-- links { "d3d11.lib", "d3dcompiler.lib", "D2d1.lib", "dwrite.lib" }
 